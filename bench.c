@@ -0,0 +1,628 @@
+/*
+ * Copyright 2026 by the luit contributors
+ *
+ * All Rights Reserved
+ *
+ * Permission to use, copy, modify, and distribute this software and its
+ * documentation for any purpose and without fee is hereby granted,
+ * provided that the above copyright notice appear in all copies and that
+ * both that copyright notice and this permission notice appear in
+ * supporting documentation, and that the name of the above listed
+ * copyright holder(s) not be used in advertising or publicity pertaining
+ * to distribution of the software without specific, written prior
+ * permission.
+ *
+ * THE ABOVE LISTED COPYRIGHT HOLDER(S) DISCLAIM ALL WARRANTIES WITH REGARD
+ * TO THIS SOFTWARE, INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS, IN NO EVENT SHALL THE ABOVE LISTED COPYRIGHT HOLDER(S) BE
+ * LIABLE FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * luit-bench measures copyOut() and copyIn() for each encoding known to luit,
+ * over synthetic corpora:
+ *
+ *	ascii	plain ASCII text
+ *	native	text in the encoding's own script
+ *	mixed	ASCII and native words
+ *	ansi	mixed text with SGR colors
+ *	redraw	full-screen updates as ncurses writes them, with line-drawing
+ *	jis	7-bit JIS mail/news text, JIS X 0208 between ESC $ B and ESC ( B
+ *		(only for encodings such as eucJP, whose GR is JIS X 0208)
+ *
+ * The native characters for an encoding are found by converting a sample of
+ * Unicode with copyIn(), keeping those which copyOut() converts back.  Output
+ * goes to /dev/null.
+ *
+ * Results are written to the standard output as tab-separated lines, one per
+ * encoding, corpus and direction, after a header line starting with "#".
+ */
+
+#include <luit.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+
+#ifdef HAVE_SYS_TIME_H
+#include <sys/time.h>
+#endif
+
+#include <sys.h>
+#include <iso2022.h>
+
+#define BENCH_FORMAT 1		/* change when the columns change */
+
+static Iso2022Ptr inputState = NULL, outputState = NULL;
+
+/*
+ * With glibc, count calls to malloc, calloc and realloc by interposing on
+ * them.  Elsewhere the count is reported as "-".
+ */
+#if defined(__GLIBC__) && !defined(__SANITIZE_ADDRESS__)
+#define COUNT_ALLOCS 1
+
+extern void *__libc_malloc(size_t);
+extern void *__libc_calloc(size_t, size_t);
+extern void *__libc_realloc(void *, size_t);
+
+static unsigned long alloc_count;
+
+void *
+malloc(size_t size)
+{
+    ++alloc_count;
+    return __libc_malloc(size);
+}
+
+void *
+calloc(size_t count, size_t size)
+{
+    ++alloc_count;
+    return __libc_calloc(count, size);
+}
+
+void *
+realloc(void *ptr, size_t size)
+{
+    ++alloc_count;
+    return __libc_realloc(ptr, size);
+}
+#endif
+
+typedef struct {
+    unsigned char *data;
+    size_t used;
+    size_t size;
+} Buffer;
+
+static void
+addBytes(Buffer * b, const unsigned char *data, size_t count)
+{
+    if (b->used + count > b->size) {
+	b->size = (b->used + count) * 2 + BUFFER_SIZE;
+	b->data = realloc(b->data, b->size);
+	if (b->data == NULL)
+	    FatalError("Couldn't grow buffer.\n");
+    }
+    memcpy(b->data + b->used, data, count);
+    b->used += count;
+}
+
+static void
+addText(Buffer * b, const char *text)
+{
+    addBytes(b, (const unsigned char *) text, strlen(text));
+}
+
+static void
+freeBuffer(Buffer * b)
+{
+    if (b->data != NULL)
+	free(b->data);
+    memset(b, 0, sizeof(*b));
+}
+
+/*
+ * A corpus is built in parallel in the encoding (for copyOut) and in UTF-8
+ * (for copyIn).  A native character is one which converts both ways.
+ */
+typedef struct {
+    unsigned char text[8];
+    unsigned char size;
+} Piece;
+
+typedef struct {
+    Piece local;
+    Piece utf8;
+} NativeChar;
+
+typedef struct {
+    Buffer local;
+    Buffer utf8;
+} Corpus;
+
+static void
+addPlain(Corpus * c, const char *text)
+{
+    addText(&c->local, text);
+    addText(&c->utf8, text);
+}
+
+static void
+addNative(Corpus * c, const NativeChar * ch)
+{
+    addBytes(&c->local, ch->local.text, (size_t) ch->local.size);
+    addBytes(&c->utf8, ch->utf8.text, (size_t) ch->utf8.size);
+}
+
+/* a fixed generator, so that corpora are the same on every platform */
+static unsigned long random_state;
+
+static unsigned
+nextRandom(unsigned limit)
+{
+    random_state = random_state * 1103515245UL + 12345UL;
+    return (unsigned) ((random_state >> 16) & 0x7FFF) % limit;
+}
+
+static const char *const words[] =
+{
+    "the", "quick", "brown", "fox", "jumps", "over", "lazy", "dog",
+    "terminal", "locale", "encoding", "charset", "buffer", "output",
+    "input", "convert", "luit", "xterm", "screen", "window", "a", "of",
+    "to", "and", "is", "in", "that", "for", "with", "on", "as", "by"
+};
+
+static const char *
+randomWord(void)
+{
+    return words[nextRandom((unsigned) SizeOf(words))];
+}
+
+/*
+ * Unicode ranges sampled for native characters, with a step for the large
+ * ones.
+ */
+/* *INDENT-OFF* */
+static const struct {
+    unsigned first;
+    unsigned last;
+    unsigned step;
+} probes[] = {
+    { 0x00A1, 0x00FF,  1 },	/* Latin-1 */
+    { 0x0100, 0x017F,  1 },	/* Latin Extended-A */
+    { 0x0391, 0x03C9,  1 },	/* Greek */
+    { 0x0401, 0x045F,  1 },	/* Cyrillic */
+    { 0x05D0, 0x05EA,  1 },	/* Hebrew */
+    { 0x0621, 0x064A,  1 },	/* Arabic */
+    { 0x0E01, 0x0E5B,  1 },	/* Thai */
+    { 0x1EA0, 0x1EF9,  1 },	/* Vietnamese */
+    { 0x20AC, 0x20AC,  1 },	/* euro sign */
+    { 0x2500, 0x257F,  1 },	/* box drawing */
+    { 0x3041, 0x3093,  1 },	/* Hiragana */
+    { 0x30A1, 0x30F6,  1 },	/* Katakana */
+    { 0x4E00, 0x9FA5, 13 },	/* CJK ideographs */
+    { 0xAC00, 0xD7A3, 11 },	/* Hangul */
+    { 0xFF61, 0xFF9F,  1 },	/* halfwidth Katakana */
+};
+/* *INDENT-ON* */
+
+static Piece
+toUtf8(unsigned c)
+{
+    Piece result;
+
+    if (c < 0x80) {
+	result.text[0] = UChar(c);
+	result.size = 1;
+    } else if (c < 0x800) {
+	result.text[0] = UChar(0xC0 | (c >> 6));
+	result.text[1] = UChar(0x80 | (c & 0x3F));
+	result.size = 2;
+    } else {
+	result.text[0] = UChar(0xE0 | (c >> 12));
+	result.text[1] = UChar(0x80 | ((c >> 6) & 0x3F));
+	result.text[2] = UChar(0x80 | (c & 0x3F));
+	result.size = 3;
+    }
+    return result;
+}
+
+/*
+ * Read what a conversion wrote into the pipe.  Returns false if it does not
+ * fit in a piece.
+ */
+static int
+readPiece(int fd, Piece * p)
+{
+    unsigned char temp[BUFFER_SIZE];
+    ssize_t got;
+    int result = 1;
+
+    p->size = 0;
+    while ((got = read(fd, temp, sizeof(temp))) > 0) {
+	if (p->size + (size_t) got > sizeof(p->text)) {
+	    result = 0;
+	} else if (result) {
+	    memcpy(p->text + p->size, temp, (size_t) got);
+	    p->size = UChar(p->size + got);
+	}
+    }
+    return result && (p->size != 0);
+}
+
+static NativeChar *
+findNativeChars(size_t *countp)
+{
+    NativeChar *result = NULL;
+    size_t count = 0;
+    size_t limit = 0;
+    unsigned n;
+    int sink[2];
+
+    if (pipe(sink) != 0)
+	FatalError("Couldn't open pipe: %s\n", strerror(errno));
+    (void) fcntl(sink[0], F_SETFL, O_NONBLOCK);
+
+    for (n = 0; n < SizeOf(probes); ++n) {
+	unsigned c;
+
+	for (c = probes[n].first; c <= probes[n].last; c += probes[n].step) {
+	    NativeChar item;
+	    Piece back;
+
+	    item.utf8 = toUtf8(c);
+	    copyIn(inputState, sink[1], item.utf8.text, (int) item.utf8.size);
+	    if (!readPiece(sink[0], &item.local))
+		continue;
+	    copyOut(outputState, sink[1], item.local.text, item.local.size);
+	    if (!readPiece(sink[0], &back)
+		|| back.size != item.utf8.size
+		|| memcmp(back.text, item.utf8.text, (size_t) back.size))
+		continue;
+
+	    if (count >= limit) {
+		limit = (limit * 2) + 256;
+		result = realloc(result, limit * sizeof(NativeChar));
+		if (result == NULL)
+		    FatalError("Couldn't grow native characters.\n");
+	    }
+	    result[count++] = item;
+	}
+    }
+    close(sink[0]);
+    close(sink[1]);
+
+    *countp = count;
+    return result;
+}
+
+#define CORPUS_ASCII	0
+#define CORPUS_NATIVE	1
+#define CORPUS_MIXED	2
+#define CORPUS_ANSI	3
+#define CORPUS_REDRAW	4
+#define CORPUS_JIS	5
+
+static const char *const corpusNames[] =
+{
+    "ascii", "native", "mixed", "ansi", "redraw", "jis"
+};
+
+/*
+ * A native character which is a JIS X 0208 pair in GR, and can be written in
+ * GL after ESC $ B.
+ */
+static int
+isJisPair(const NativeChar * ch)
+{
+    return (ch->local.size == 2
+	    && ch->local.text[0] >= 0xA1 && ch->local.text[0] <= 0xFE
+	    && ch->local.text[1] >= 0xA1 && ch->local.text[1] <= 0xFE);
+}
+
+static int
+hasJisPairs(const NativeChar * chars, size_t count)
+{
+    const CharsetRec *gr = GR(outputState);
+    size_t n;
+
+    if (OTHER(outputState) == NULL
+	&& gr->type == T_9494
+	&& gr->final == 'B') {
+	for (n = 0; n < count; ++n) {
+	    if (isJisPair(&chars[n]))
+		return 1;
+	}
+    }
+    return 0;
+}
+
+static void
+addJisWord(Corpus * c, const NativeChar * chars, size_t count)
+{
+    unsigned length = 1 + nextRandom(12);
+
+    addText(&c->local, "\033$B");
+    while (length != 0) {
+	const NativeChar *ch = &chars[nextRandom((unsigned) count)];
+
+	if (isJisPair(ch)) {
+	    unsigned char pair[2];
+
+	    pair[0] = UChar(ch->local.text[0] & 0x7F);
+	    pair[1] = UChar(ch->local.text[1] & 0x7F);
+	    addBytes(&c->local, pair, sizeof(pair));
+	    addBytes(&c->utf8, ch->utf8.text, (size_t) ch->utf8.size);
+	    --length;
+	}
+    }
+    addText(&c->local, "\033(B");
+}
+
+static void
+addNativeWord(Corpus * c, const NativeChar * chars, size_t count)
+{
+    unsigned length = 1 + nextRandom(6);
+
+    while (length-- != 0)
+	addNative(c, &chars[nextRandom((unsigned) count)]);
+}
+
+static void
+addWord(Corpus * c, int which, const NativeChar * chars, size_t count)
+{
+    switch (which) {
+    case CORPUS_ASCII:
+	addPlain(c, randomWord());
+	break;
+    case CORPUS_NATIVE:
+	addNativeWord(c, chars, count);
+	break;
+    case CORPUS_JIS:
+	if (nextRandom(4))
+	    addJisWord(c, chars, count);
+	else
+	    addPlain(c, randomWord());
+	break;
+    default:
+	if (nextRandom(2))
+	    addNativeWord(c, chars, count);
+	else
+	    addPlain(c, randomWord());
+	break;
+    }
+}
+
+static void
+addLine(Corpus * c, int which, const NativeChar * chars, size_t count)
+{
+    unsigned n;
+
+    for (n = 0; n < 10; ++n) {
+	if (n != 0)
+	    addPlain(c, " ");
+	if (which == CORPUS_ANSI && nextRandom(3) == 0) {
+	    char color[20];
+
+	    sprintf(color, "\033[%u;3%um", nextRandom(2), 1 + nextRandom(7));
+	    addPlain(c, color);
+	    addWord(c, which, chars, count);
+	    addPlain(c, "\033[0m");
+	} else {
+	    addWord(c, which, chars, count);
+	}
+    }
+}
+
+static void
+makeCorpus(Corpus * c, int which, size_t size,
+	   const NativeChar * chars, size_t count)
+{
+    random_state = (unsigned long) which + 1;
+    while (c->local.used < size) {
+	if (which == CORPUS_REDRAW) {
+	    unsigned row;
+
+	    addPlain(c, "\033[H\033(0lqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqk\033(B");
+	    for (row = 2; row < 24; ++row) {
+		char move[20];
+
+		sprintf(move, "\033[%u;1H\033(0x\033(B ", row);
+		addPlain(c, move);
+		addLine(c, CORPUS_MIXED, chars, count);
+		addPlain(c, "\033[K\033(0x\033(B");
+	    }
+	    addPlain(c, "\033[24;1H\033(0mqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqj\033(B");
+	} else {
+	    addLine(c, which, chars, count);
+	    addPlain(c, "\r\n");
+	}
+    }
+}
+
+static double
+getSeconds(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return (double) tv.tv_sec + ((double) tv.tv_usec / 1e6);
+}
+
+/*
+ * Convert the text repeatedly, a block at a time as luit reads it, until
+ * at least "minimum" seconds have passed.
+ */
+static void
+measure(const char *charset, const char *corpus, const char *direction,
+	Buffer * text, int fd, size_t block, double minimum)
+{
+    unsigned long passes = 0;
+    double started;
+    double elapsed;
+    double total;
+#ifdef COUNT_ALLOCS
+    unsigned long allocs = alloc_count;
+#endif
+
+    started = getSeconds();
+    do {
+	size_t offset;
+
+	for (offset = 0; offset < text->used; offset += block) {
+	    size_t count = text->used - offset;
+
+	    if (count > block)
+		count = block;
+	    if (*direction == 'o')
+		copyOut(outputState, fd, text->data + offset, (unsigned) count);
+	    else
+		copyIn(inputState, fd, text->data + offset, (int) count);
+	}
+	++passes;
+	elapsed = getSeconds() - started;
+    } while (elapsed < minimum);
+
+    total = (double) text->used * (double) passes;
+    printf("%s\t%s\t%s\t%lu\t%lu\t%.6f\t%.2f\t%.3f\t",
+	   charset, corpus, direction,
+	   (unsigned long) text->used, passes, elapsed,
+	   total / elapsed / 1e6,
+	   elapsed * 1e9 / total);
+#ifdef COUNT_ALLOCS
+    printf("%.1f\n", (double) (alloc_count - allocs) / (double) passes);
+#else
+    printf("-\n");
+#endif
+    fflush(stdout);
+}
+
+static int
+benchCharset(const char *charset, int fd, size_t size, size_t block,
+	     double minimum)
+{
+    NativeChar *chars;
+    size_t count;
+    int which;
+
+    inputState = allocIso2022();
+    outputState = allocIso2022();
+    if (inputState == NULL || outputState == NULL)
+	FatalError("Couldn't create states\n");
+
+    if (initIso2022(NULL, charset, outputState) < 0
+	|| mergeIso2022(inputState, outputState) < 0) {
+	Warning("couldn't initialize %s\n", charset);
+	destroyIso2022(inputState);
+	destroyIso2022(outputState);
+	return 0;
+    }
+
+    chars = findNativeChars(&count);
+    for (which = 0; which < (int) SizeOf(corpusNames); ++which) {
+	Corpus corpus;
+
+	if (which != CORPUS_ASCII && count == 0)
+	    continue;
+	if (which == CORPUS_JIS && !hasJisPairs(chars, count))
+	    continue;
+	memset(&corpus, 0, sizeof(corpus));
+	makeCorpus(&corpus, which, size, chars, count);
+	measure(charset, corpusNames[which], "out",
+		&corpus.local, fd, block, minimum);
+	measure(charset, corpusNames[which], "in",
+		&corpus.utf8, fd, block, minimum);
+	freeBuffer(&corpus.local);
+	freeBuffer(&corpus.utf8);
+    }
+    if (chars != NULL)
+	free(chars);
+
+    destroyIso2022(inputState);
+    destroyIso2022(outputState);
+    inputState = outputState = NULL;
+    return 1;
+}
+
+static void
+usage(void)
+{
+    static const char *const msg[] =
+    {
+	"Usage: luit-bench [options] [encoding...]",
+	"",
+	"Measure luit's conversions for the given encodings, or for all",
+	"known encodings.",
+	"",
+	"Options:",
+	"  -b bytes    size of each block passed to copyOut/copyIn (512)",
+	"  -s bytes    size of each corpus (1048576)",
+	"  -t seconds  minimum time for each measurement (0.2)",
+    };
+    unsigned n;
+
+    for (n = 0; n < SizeOf(msg); ++n)
+	fprintf(stderr, "%s\n", msg[n]);
+    ExitFailure();
+}
+
+int
+main(int argc, char **argv)
+{
+    size_t size = 1024 * 1024;
+    size_t block = BUFFER_SIZE;
+    double minimum = 0.2;
+    int fd;
+    int n;
+
+    for (n = 1; n < argc && *argv[n] == '-'; ++n) {
+	if (n + 1 >= argc)
+	    usage();
+	if (!strcmp(argv[n], "-b"))
+	    block = (size_t) atol(argv[++n]);
+	else if (!strcmp(argv[n], "-s"))
+	    size = (size_t) atol(argv[++n]);
+	else if (!strcmp(argv[n], "-t"))
+	    minimum = atof(argv[++n]);
+	else
+	    usage();
+    }
+    if (block == 0 || size == 0)
+	usage();
+
+    if ((fd = open("/dev/null", O_WRONLY)) < 0)
+	FatalError("Couldn't open /dev/null: %s\n", strerror(errno));
+
+    printf("# luit-bench %d\tencoding\tcorpus\tdirection\tbytes\tpasses"
+	   "\tseconds\tMB/s\tns/byte\tallocs/pass\n", BENCH_FORMAT);
+    if (n < argc) {
+	while (n < argc)
+	    benchCharset(argv[n++], fd, size, block, minimum);
+    } else {
+	unsigned k;
+	const char *name;
+
+	for (k = 0; (name = localeCharsetEntry(k)) != NULL; ++k)
+	    benchCharset(name, fd, size, block, minimum);
+    }
+    close(fd);
+
+    ExitSuccess();
+    return 0;
+}
+
+#ifdef NO_LEAKS
+void
+luit_leaks(void)
+{
+    if (inputState != NULL)
+	destroyIso2022(inputState);
+    if (outputState != NULL)
+	destroyIso2022(outputState);
+}
+#endif
@@ -1,5 +1,5 @@
 /*
- * $XTermId: builtin.c,v 1.2 2013/01/28 10:00:55 tom Exp $
+ * $XTermId$
  * This file was generated by ./make-tables
  */
 #include <other.h>
@@ -43,6 +43,302 @@ static const BuiltInMapping dec_special[] =
     {0x7E, 0x00b7},	/* middle dot */
 };
 
+static const MappingData dec_special_utf8[] =
+{
+    {0x0000, 0, {0}},	/* 00 */
+    {0x0001, 0, {0}},	/* 01 */
+    {0x0002, 0, {0}},	/* 02 */
+    {0x0003, 0, {0}},	/* 03 */
+    {0x0004, 0, {0}},	/* 04 */
+    {0x0005, 0, {0}},	/* 05 */
+    {0x0006, 0, {0}},	/* 06 */
+    {0x0007, 0, {0}},	/* 07 */
+    {0x0008, 0, {0}},	/* 08 */
+    {0x0009, 0, {0}},	/* 09 */
+    {0x000a, 0, {0}},	/* 0A */
+    {0x000b, 0, {0}},	/* 0B */
+    {0x000c, 0, {0}},	/* 0C */
+    {0x000d, 0, {0}},	/* 0D */
+    {0x000e, 0, {0}},	/* 0E */
+    {0x000f, 0, {0}},	/* 0F */
+    {0x0010, 0, {0}},	/* 10 */
+    {0x0011, 0, {0}},	/* 11 */
+    {0x0012, 0, {0}},	/* 12 */
+    {0x0013, 0, {0}},	/* 13 */
+    {0x0014, 0, {0}},	/* 14 */
+    {0x0015, 0, {0}},	/* 15 */
+    {0x0016, 0, {0}},	/* 16 */
+    {0x0017, 0, {0}},	/* 17 */
+    {0x0018, 0, {0}},	/* 18 */
+    {0x0019, 0, {0}},	/* 19 */
+    {0x001a, 0, {0}},	/* 1A */
+    {0x001b, 0, {0}},	/* 1B */
+    {0x001c, 0, {0}},	/* 1C */
+    {0x001d, 0, {0}},	/* 1D */
+    {0x001e, 0, {0}},	/* 1E */
+    {0x001f, 0, {0}},	/* 1F */
+    {0x0000, 0, {0}},	/* 20 */
+    {0x0000, 0, {0}},	/* 21 */
+    {0x0000, 0, {0}},	/* 22 */
+    {0x0000, 0, {0}},	/* 23 */
+    {0x0000, 0, {0}},	/* 24 */
+    {0x0000, 0, {0}},	/* 25 */
+    {0x0000, 0, {0}},	/* 26 */
+    {0x0000, 0, {0}},	/* 27 */
+    {0x0000, 0, {0}},	/* 28 */
+    {0x0000, 0, {0}},	/* 29 */
+    {0x0000, 0, {0}},	/* 2A */
+    {0x0000, 0, {0}},	/* 2B */
+    {0x0000, 0, {0}},	/* 2C */
+    {0x0000, 0, {0}},	/* 2D */
+    {0x0000, 0, {0}},	/* 2E */
+    {0x0000, 0, {0}},	/* 2F */
+    {0x0000, 0, {0}},	/* 30 */
+    {0x0000, 0, {0}},	/* 31 */
+    {0x0000, 0, {0}},	/* 32 */
+    {0x0000, 0, {0}},	/* 33 */
+    {0x0000, 0, {0}},	/* 34 */
+    {0x0000, 0, {0}},	/* 35 */
+    {0x0000, 0, {0}},	/* 36 */
+    {0x0000, 0, {0}},	/* 37 */
+    {0x0000, 0, {0}},	/* 38 */
+    {0x0000, 0, {0}},	/* 39 */
+    {0x0000, 0, {0}},	/* 3A */
+    {0x0000, 0, {0}},	/* 3B */
+    {0x0000, 0, {0}},	/* 3C */
+    {0x0000, 0, {0}},	/* 3D */
+    {0x0000, 0, {0}},	/* 3E */
+    {0x0000, 0, {0}},	/* 3F */
+    {0x0000, 0, {0}},	/* 40 */
+    {0x0000, 0, {0}},	/* 41 */
+    {0x0000, 0, {0}},	/* 42 */
+    {0x0000, 0, {0}},	/* 43 */
+    {0x0000, 0, {0}},	/* 44 */
+    {0x0000, 0, {0}},	/* 45 */
+    {0x0000, 0, {0}},	/* 46 */
+    {0x0000, 0, {0}},	/* 47 */
+    {0x0000, 0, {0}},	/* 48 */
+    {0x0000, 0, {0}},	/* 49 */
+    {0x0000, 0, {0}},	/* 4A */
+    {0x0000, 0, {0}},	/* 4B */
+    {0x0000, 0, {0}},	/* 4C */
+    {0x0000, 0, {0}},	/* 4D */
+    {0x0000, 0, {0}},	/* 4E */
+    {0x0000, 0, {0}},	/* 4F */
+    {0x0000, 0, {0}},	/* 50 */
+    {0x0000, 0, {0}},	/* 51 */
+    {0x0000, 0, {0}},	/* 52 */
+    {0x0000, 0, {0}},	/* 53 */
+    {0x0000, 0, {0}},	/* 54 */
+    {0x0000, 0, {0}},	/* 55 */
+    {0x0000, 0, {0}},	/* 56 */
+    {0x0000, 0, {0}},	/* 57 */
+    {0x0000, 0, {0}},	/* 58 */
+    {0x0000, 0, {0}},	/* 59 */
+    {0x0000, 0, {0}},	/* 5A */
+    {0x0000, 0, {0}},	/* 5B */
+    {0x0000, 0, {0}},	/* 5C */
+    {0x0000, 0, {0}},	/* 5D */
+    {0x0000, 0, {0}},	/* 5E */
+    {0x25ae, 3, {0xe2, 0x96, 0xae}},	/* 5F */
+    {0x25c6, 3, {0xe2, 0x97, 0x86}},	/* 60 */
+    {0x2592, 3, {0xe2, 0x96, 0x92}},	/* 61 */
+    {0x2409, 3, {0xe2, 0x90, 0x89}},	/* 62 */
+    {0x240c, 3, {0xe2, 0x90, 0x8c}},	/* 63 */
+    {0x240d, 3, {0xe2, 0x90, 0x8d}},	/* 64 */
+    {0x240a, 3, {0xe2, 0x90, 0x8a}},	/* 65 */
+    {0x00b0, 2, {0xc2, 0xb0}},	/* 66 */
+    {0x00b1, 2, {0xc2, 0xb1}},	/* 67 */
+    {0x2424, 3, {0xe2, 0x90, 0xa4}},	/* 68 */
+    {0x240b, 3, {0xe2, 0x90, 0x8b}},	/* 69 */
+    {0x2518, 3, {0xe2, 0x94, 0x98}},	/* 6A */
+    {0x2510, 3, {0xe2, 0x94, 0x90}},	/* 6B */
+    {0x250c, 3, {0xe2, 0x94, 0x8c}},	/* 6C */
+    {0x2514, 3, {0xe2, 0x94, 0x94}},	/* 6D */
+    {0x253c, 3, {0xe2, 0x94, 0xbc}},	/* 6E */
+    {0x23ba, 3, {0xe2, 0x8e, 0xba}},	/* 6F */
+    {0x23bb, 3, {0xe2, 0x8e, 0xbb}},	/* 70 */
+    {0x2500, 3, {0xe2, 0x94, 0x80}},	/* 71 */
+    {0x23bc, 3, {0xe2, 0x8e, 0xbc}},	/* 72 */
+    {0x23bd, 3, {0xe2, 0x8e, 0xbd}},	/* 73 */
+    {0x251c, 3, {0xe2, 0x94, 0x9c}},	/* 74 */
+    {0x2524, 3, {0xe2, 0x94, 0xa4}},	/* 75 */
+    {0x2534, 3, {0xe2, 0x94, 0xb4}},	/* 76 */
+    {0x252c, 3, {0xe2, 0x94, 0xac}},	/* 77 */
+    {0x2502, 3, {0xe2, 0x94, 0x82}},	/* 78 */
+    {0x2264, 3, {0xe2, 0x89, 0xa4}},	/* 79 */
+    {0x2265, 3, {0xe2, 0x89, 0xa5}},	/* 7A */
+    {0x03c0, 2, {0xcf, 0x80}},	/* 7B */
+    {0x2260, 3, {0xe2, 0x89, 0xa0}},	/* 7C */
+    {0x00a3, 2, {0xc2, 0xa3}},	/* 7D */
+    {0x00b7, 2, {0xc2, 0xb7}},	/* 7E */
+    {0x0000, 0, {0}},	/* 7F */
+    {0x0000, 0, {0}},	/* 80 */
+    {0x0000, 0, {0}},	/* 81 */
+    {0x0000, 0, {0}},	/* 82 */
+    {0x0000, 0, {0}},	/* 83 */
+    {0x0000, 0, {0}},	/* 84 */
+    {0x0000, 0, {0}},	/* 85 */
+    {0x0000, 0, {0}},	/* 86 */
+    {0x0000, 0, {0}},	/* 87 */
+    {0x0000, 0, {0}},	/* 88 */
+    {0x0000, 0, {0}},	/* 89 */
+    {0x0000, 0, {0}},	/* 8A */
+    {0x0000, 0, {0}},	/* 8B */
+    {0x0000, 0, {0}},	/* 8C */
+    {0x0000, 0, {0}},	/* 8D */
+    {0x0000, 0, {0}},	/* 8E */
+    {0x0000, 0, {0}},	/* 8F */
+    {0x0000, 0, {0}},	/* 90 */
+    {0x0000, 0, {0}},	/* 91 */
+    {0x0000, 0, {0}},	/* 92 */
+    {0x0000, 0, {0}},	/* 93 */
+    {0x0000, 0, {0}},	/* 94 */
+    {0x0000, 0, {0}},	/* 95 */
+    {0x0000, 0, {0}},	/* 96 */
+    {0x0000, 0, {0}},	/* 97 */
+    {0x0000, 0, {0}},	/* 98 */
+    {0x0000, 0, {0}},	/* 99 */
+    {0x0000, 0, {0}},	/* 9A */
+    {0x0000, 0, {0}},	/* 9B */
+    {0x0000, 0, {0}},	/* 9C */
+    {0x0000, 0, {0}},	/* 9D */
+    {0x0000, 0, {0}},	/* 9E */
+    {0x0000, 0, {0}},	/* 9F */
+    {0x0000, 0, {0}},	/* A0 */
+    {0x0000, 0, {0}},	/* A1 */
+    {0x0000, 0, {0}},	/* A2 */
+    {0x0000, 0, {0}},	/* A3 */
+    {0x0000, 0, {0}},	/* A4 */
+    {0x0000, 0, {0}},	/* A5 */
+    {0x0000, 0, {0}},	/* A6 */
+    {0x0000, 0, {0}},	/* A7 */
+    {0x0000, 0, {0}},	/* A8 */
+    {0x0000, 0, {0}},	/* A9 */
+    {0x0000, 0, {0}},	/* AA */
+    {0x0000, 0, {0}},	/* AB */
+    {0x0000, 0, {0}},	/* AC */
+    {0x0000, 0, {0}},	/* AD */
+    {0x0000, 0, {0}},	/* AE */
+    {0x0000, 0, {0}},	/* AF */
+    {0x0000, 0, {0}},	/* B0 */
+    {0x0000, 0, {0}},	/* B1 */
+    {0x0000, 0, {0}},	/* B2 */
+    {0x0000, 0, {0}},	/* B3 */
+    {0x0000, 0, {0}},	/* B4 */
+    {0x0000, 0, {0}},	/* B5 */
+    {0x0000, 0, {0}},	/* B6 */
+    {0x0000, 0, {0}},	/* B7 */
+    {0x0000, 0, {0}},	/* B8 */
+    {0x0000, 0, {0}},	/* B9 */
+    {0x0000, 0, {0}},	/* BA */
+    {0x0000, 0, {0}},	/* BB */
+    {0x0000, 0, {0}},	/* BC */
+    {0x0000, 0, {0}},	/* BD */
+    {0x0000, 0, {0}},	/* BE */
+    {0x0000, 0, {0}},	/* BF */
+    {0x0000, 0, {0}},	/* C0 */
+    {0x0000, 0, {0}},	/* C1 */
+    {0x0000, 0, {0}},	/* C2 */
+    {0x0000, 0, {0}},	/* C3 */
+    {0x0000, 0, {0}},	/* C4 */
+    {0x0000, 0, {0}},	/* C5 */
+    {0x0000, 0, {0}},	/* C6 */
+    {0x0000, 0, {0}},	/* C7 */
+    {0x0000, 0, {0}},	/* C8 */
+    {0x0000, 0, {0}},	/* C9 */
+    {0x0000, 0, {0}},	/* CA */
+    {0x0000, 0, {0}},	/* CB */
+    {0x0000, 0, {0}},	/* CC */
+    {0x0000, 0, {0}},	/* CD */
+    {0x0000, 0, {0}},	/* CE */
+    {0x0000, 0, {0}},	/* CF */
+    {0x0000, 0, {0}},	/* D0 */
+    {0x0000, 0, {0}},	/* D1 */
+    {0x0000, 0, {0}},	/* D2 */
+    {0x0000, 0, {0}},	/* D3 */
+    {0x0000, 0, {0}},	/* D4 */
+    {0x0000, 0, {0}},	/* D5 */
+    {0x0000, 0, {0}},	/* D6 */
+    {0x0000, 0, {0}},	/* D7 */
+    {0x0000, 0, {0}},	/* D8 */
+    {0x0000, 0, {0}},	/* D9 */
+    {0x0000, 0, {0}},	/* DA */
+    {0x0000, 0, {0}},	/* DB */
+    {0x0000, 0, {0}},	/* DC */
+    {0x0000, 0, {0}},	/* DD */
+    {0x0000, 0, {0}},	/* DE */
+    {0x0000, 0, {0}},	/* DF */
+    {0x0000, 0, {0}},	/* E0 */
+    {0x0000, 0, {0}},	/* E1 */
+    {0x0000, 0, {0}},	/* E2 */
+    {0x0000, 0, {0}},	/* E3 */
+    {0x0000, 0, {0}},	/* E4 */
+    {0x0000, 0, {0}},	/* E5 */
+    {0x0000, 0, {0}},	/* E6 */
+    {0x0000, 0, {0}},	/* E7 */
+    {0x0000, 0, {0}},	/* E8 */
+    {0x0000, 0, {0}},	/* E9 */
+    {0x0000, 0, {0}},	/* EA */
+    {0x0000, 0, {0}},	/* EB */
+    {0x0000, 0, {0}},	/* EC */
+    {0x0000, 0, {0}},	/* ED */
+    {0x0000, 0, {0}},	/* EE */
+    {0x0000, 0, {0}},	/* EF */
+    {0x0000, 0, {0}},	/* F0 */
+    {0x0000, 0, {0}},	/* F1 */
+    {0x0000, 0, {0}},	/* F2 */
+    {0x0000, 0, {0}},	/* F3 */
+    {0x0000, 0, {0}},	/* F4 */
+    {0x0000, 0, {0}},	/* F5 */
+    {0x0000, 0, {0}},	/* F6 */
+    {0x0000, 0, {0}},	/* F7 */
+    {0x0000, 0, {0}},	/* F8 */
+    {0x0000, 0, {0}},	/* F9 */
+    {0x0000, 0, {0}},	/* FA */
+    {0x0000, 0, {0}},	/* FB */
+    {0x0000, 0, {0}},	/* FC */
+    {0x0000, 0, {0}},	/* FD */
+    {0x0000, 0, {0}},	/* FE */
+    {0x0000, 0, {0}},	/* FF */
+};
+
+static const ReverseData dec_special_rev[] =
+{
+    {0x00a3, 0x7D},
+    {0x00b0, 0x66},
+    {0x00b1, 0x67},
+    {0x00b7, 0x7E},
+    {0x03c0, 0x7B},
+    {0x2260, 0x7C},
+    {0x2264, 0x79},
+    {0x2265, 0x7A},
+    {0x23ba, 0x6F},
+    {0x23bb, 0x70},
+    {0x23bc, 0x72},
+    {0x23bd, 0x73},
+    {0x2409, 0x62},
+    {0x240a, 0x65},
+    {0x240b, 0x69},
+    {0x240c, 0x63},
+    {0x240d, 0x64},
+    {0x2424, 0x68},
+    {0x2500, 0x71},
+    {0x2502, 0x78},
+    {0x250c, 0x6C},
+    {0x2510, 0x6B},
+    {0x2514, 0x6D},
+    {0x2518, 0x6A},
+    {0x251c, 0x74},
+    {0x2524, 0x75},
+    {0x252c, 0x77},
+    {0x2534, 0x76},
+    {0x253c, 0x6E},
+    {0x2592, 0x61},
+    {0x25ae, 0x5F},
+    {0x25c6, 0x60},
+};
+
 static const BuiltInMapping dec_technical[] =
 {
     /* derived from http://www.vt100.net/charsets/technical.html */
@@ -142,12 +438,635 @@ static const BuiltInMapping dec_technical[] =
     {0x7e, 0x2193},	/* DOWNWARDS ARROW */
 };
 
+static const MappingData dec_technical_utf8[] =
+{
+    {0x0000, 0, {0}},	/* 00 */
+    {0x0001, 0, {0}},	/* 01 */
+    {0x0002, 0, {0}},	/* 02 */
+    {0x0003, 0, {0}},	/* 03 */
+    {0x0004, 0, {0}},	/* 04 */
+    {0x0005, 0, {0}},	/* 05 */
+    {0x0006, 0, {0}},	/* 06 */
+    {0x0007, 0, {0}},	/* 07 */
+    {0x0008, 0, {0}},	/* 08 */
+    {0x0009, 0, {0}},	/* 09 */
+    {0x000a, 0, {0}},	/* 0A */
+    {0x000b, 0, {0}},	/* 0B */
+    {0x000c, 0, {0}},	/* 0C */
+    {0x000d, 0, {0}},	/* 0D */
+    {0x000e, 0, {0}},	/* 0E */
+    {0x000f, 0, {0}},	/* 0F */
+    {0x0010, 0, {0}},	/* 10 */
+    {0x0011, 0, {0}},	/* 11 */
+    {0x0012, 0, {0}},	/* 12 */
+    {0x0013, 0, {0}},	/* 13 */
+    {0x0014, 0, {0}},	/* 14 */
+    {0x0015, 0, {0}},	/* 15 */
+    {0x0016, 0, {0}},	/* 16 */
+    {0x0017, 0, {0}},	/* 17 */
+    {0x0018, 0, {0}},	/* 18 */
+    {0x0019, 0, {0}},	/* 19 */
+    {0x001a, 0, {0}},	/* 1A */
+    {0x001b, 0, {0}},	/* 1B */
+    {0x001c, 0, {0}},	/* 1C */
+    {0x001d, 0, {0}},	/* 1D */
+    {0x001e, 0, {0}},	/* 1E */
+    {0x001f, 0, {0}},	/* 1F */
+    {0x0020, 0, {0}},	/* 20 */
+    {0x23b7, 3, {0xe2, 0x8e, 0xb7}},	/* 21 */
+    {0x250c, 3, {0xe2, 0x94, 0x8c}},	/* 22 */
+    {0x2500, 3, {0xe2, 0x94, 0x80}},	/* 23 */
+    {0x2320, 3, {0xe2, 0x8c, 0xa0}},	/* 24 */
+    {0x2321, 3, {0xe2, 0x8c, 0xa1}},	/* 25 */
+    {0x2502, 3, {0xe2, 0x94, 0x82}},	/* 26 */
+    {0x23a1, 3, {0xe2, 0x8e, 0xa1}},	/* 27 */
+    {0x23a3, 3, {0xe2, 0x8e, 0xa3}},	/* 28 */
+    {0x23a4, 3, {0xe2, 0x8e, 0xa4}},	/* 29 */
+    {0x23a6, 3, {0xe2, 0x8e, 0xa6}},	/* 2A */
+    {0x239b, 3, {0xe2, 0x8e, 0x9b}},	/* 2B */
+    {0x239d, 3, {0xe2, 0x8e, 0x9d}},	/* 2C */
+    {0x239e, 3, {0xe2, 0x8e, 0x9e}},	/* 2D */
+    {0x23a0, 3, {0xe2, 0x8e, 0xa0}},	/* 2E */
+    {0x23a8, 3, {0xe2, 0x8e, 0xa8}},	/* 2F */
+    {0x23ac, 3, {0xe2, 0x8e, 0xac}},	/* 30 */
+    {0x2426, 3, {0xe2, 0x90, 0xa6}},	/* 31 */
+    {0x2426, 3, {0xe2, 0x90, 0xa6}},	/* 32 */
+    {0x2426, 3, {0xe2, 0x90, 0xa6}},	/* 33 */
+    {0x2426, 3, {0xe2, 0x90, 0xa6}},	/* 34 */
+    {0x2426, 3, {0xe2, 0x90, 0xa6}},	/* 35 */
+    {0x2426, 3, {0xe2, 0x90, 0xa6}},	/* 36 */
+    {0x2426, 3, {0xe2, 0x90, 0xa6}},	/* 37 */
+    {0x2426, 3, {0xe2, 0x90, 0xa6}},	/* 38 */
+    {0x2426, 3, {0xe2, 0x90, 0xa6}},	/* 39 */
+    {0x2426, 3, {0xe2, 0x90, 0xa6}},	/* 3A */
+    {0x2426, 3, {0xe2, 0x90, 0xa6}},	/* 3B */
+    {0x2264, 3, {0xe2, 0x89, 0xa4}},	/* 3C */
+    {0x2260, 3, {0xe2, 0x89, 0xa0}},	/* 3D */
+    {0x2265, 3, {0xe2, 0x89, 0xa5}},	/* 3E */
+    {0x222b, 3, {0xe2, 0x88, 0xab}},	/* 3F */
+    {0x2234, 3, {0xe2, 0x88, 0xb4}},	/* 40 */
+    {0x221d, 3, {0xe2, 0x88, 0x9d}},	/* 41 */
+    {0x221e, 3, {0xe2, 0x88, 0x9e}},	/* 42 */
+    {0x00f7, 2, {0xc3, 0xb7}},	/* 43 */
+    {0x039a, 2, {0xce, 0x9a}},	/* 44 */
+    {0x2207, 3, {0xe2, 0x88, 0x87}},	/* 45 */
+    {0x03a6, 2, {0xce, 0xa6}},	/* 46 */
+    {0x0393, 2, {0xce, 0x93}},	/* 47 */
+    {0x223c, 3, {0xe2, 0x88, 0xbc}},	/* 48 */
+    {0x2243, 3, {0xe2, 0x89, 0x83}},	/* 49 */
+    {0x0398, 2, {0xce, 0x98}},	/* 4A */
+    {0x00d7, 2, {0xc3, 0x97}},	/* 4B */
+    {0x039b, 2, {0xce, 0x9b}},	/* 4C */
+    {0x21d4, 3, {0xe2, 0x87, 0x94}},	/* 4D */
+    {0x21d2, 3, {0xe2, 0x87, 0x92}},	/* 4E */
+    {0x2261, 3, {0xe2, 0x89, 0xa1}},	/* 4F */
+    {0x03a0, 2, {0xce, 0xa0}},	/* 50 */
+    {0x03a8, 2, {0xce, 0xa8}},	/* 51 */
+    {0x2426, 3, {0xe2, 0x90, 0xa6}},	/* 52 */
+    {0x03a3, 2, {0xce, 0xa3}},	/* 53 */
+    {0x2426, 3, {0xe2, 0x90, 0xa6}},	/* 54 */
+    {0x2426, 3, {0xe2, 0x90, 0xa6}},	/* 55 */
+    {0x221a, 3, {0xe2, 0x88, 0x9a}},	/* 56 */
+    {0x03a9, 2, {0xce, 0xa9}},	/* 57 */
+    {0x039e, 2, {0xce, 0x9e}},	/* 58 */
+    {0x03a5, 2, {0xce, 0xa5}},	/* 59 */
+    {0x2282, 3, {0xe2, 0x8a, 0x82}},	/* 5A */
+    {0x2283, 3, {0xe2, 0x8a, 0x83}},	/* 5B */
+    {0x2229, 3, {0xe2, 0x88, 0xa9}},	/* 5C */
+    {0x222a, 3, {0xe2, 0x88, 0xaa}},	/* 5D */
+    {0x2227, 3, {0xe2, 0x88, 0xa7}},	/* 5E */
+    {0x2228, 3, {0xe2, 0x88, 0xa8}},	/* 5F */
+    {0x00ac, 2, {0xc2, 0xac}},	/* 60 */
+    {0x03b1, 2, {0xce, 0xb1}},	/* 61 */
+    {0x03b2, 2, {0xce, 0xb2}},	/* 62 */
+    {0x03c7, 2, {0xcf, 0x87}},	/* 63 */
+    {0x03b4, 2, {0xce, 0xb4}},	/* 64 */
+    {0x03b5, 2, {0xce, 0xb5}},	/* 65 */
+    {0x03c6, 2, {0xcf, 0x86}},	/* 66 */
+    {0x03b3, 2, {0xce, 0xb3}},	/* 67 */
+    {0x03b7, 2, {0xce, 0xb7}},	/* 68 */
+    {0x03b9, 2, {0xce, 0xb9}},	/* 69 */
+    {0x03b8, 2, {0xce, 0xb8}},	/* 6A */
+    {0x03ba, 2, {0xce, 0xba}},	/* 6B */
+    {0x03bb, 2, {0xce, 0xbb}},	/* 6C */
+    {0x2426, 3, {0xe2, 0x90, 0xa6}},	/* 6D */
+    {0x03bd, 2, {0xce, 0xbd}},	/* 6E */
+    {0x2202, 3, {0xe2, 0x88, 0x82}},	/* 6F */
+    {0x03c0, 2, {0xcf, 0x80}},	/* 70 */
+    {0x03c8, 2, {0xcf, 0x88}},	/* 71 */
+    {0x03c1, 2, {0xcf, 0x81}},	/* 72 */
+    {0x03c3, 2, {0xcf, 0x83}},	/* 73 */
+    {0x03c4, 2, {0xcf, 0x84}},	/* 74 */
+    {0x2426, 3, {0xe2, 0x90, 0xa6}},	/* 75 */
+    {0x0192, 2, {0xc6, 0x92}},	/* 76 */
+    {0x03c9, 2, {0xcf, 0x89}},	/* 77 */
+    {0x03be, 2, {0xce, 0xbe}},	/* 78 */
+    {0x03c5, 2, {0xcf, 0x85}},	/* 79 */
+    {0x03b6, 2, {0xce, 0xb6}},	/* 7A */
+    {0x2190, 3, {0xe2, 0x86, 0x90}},	/* 7B */
+    {0x2191, 3, {0xe2, 0x86, 0x91}},	/* 7C */
+    {0x2192, 3, {0xe2, 0x86, 0x92}},	/* 7D */
+    {0x2193, 3, {0xe2, 0x86, 0x93}},	/* 7E */
+    {0x0000, 0, {0}},	/* 7F */
+    {0x0000, 0, {0}},	/* 80 */
+    {0x0000, 0, {0}},	/* 81 */
+    {0x0000, 0, {0}},	/* 82 */
+    {0x0000, 0, {0}},	/* 83 */
+    {0x0000, 0, {0}},	/* 84 */
+    {0x0000, 0, {0}},	/* 85 */
+    {0x0000, 0, {0}},	/* 86 */
+    {0x0000, 0, {0}},	/* 87 */
+    {0x0000, 0, {0}},	/* 88 */
+    {0x0000, 0, {0}},	/* 89 */
+    {0x0000, 0, {0}},	/* 8A */
+    {0x0000, 0, {0}},	/* 8B */
+    {0x0000, 0, {0}},	/* 8C */
+    {0x0000, 0, {0}},	/* 8D */
+    {0x0000, 0, {0}},	/* 8E */
+    {0x0000, 0, {0}},	/* 8F */
+    {0x0000, 0, {0}},	/* 90 */
+    {0x0000, 0, {0}},	/* 91 */
+    {0x0000, 0, {0}},	/* 92 */
+    {0x0000, 0, {0}},	/* 93 */
+    {0x0000, 0, {0}},	/* 94 */
+    {0x0000, 0, {0}},	/* 95 */
+    {0x0000, 0, {0}},	/* 96 */
+    {0x0000, 0, {0}},	/* 97 */
+    {0x0000, 0, {0}},	/* 98 */
+    {0x0000, 0, {0}},	/* 99 */
+    {0x0000, 0, {0}},	/* 9A */
+    {0x0000, 0, {0}},	/* 9B */
+    {0x0000, 0, {0}},	/* 9C */
+    {0x0000, 0, {0}},	/* 9D */
+    {0x0000, 0, {0}},	/* 9E */
+    {0x0000, 0, {0}},	/* 9F */
+    {0x0000, 0, {0}},	/* A0 */
+    {0x0000, 0, {0}},	/* A1 */
+    {0x0000, 0, {0}},	/* A2 */
+    {0x0000, 0, {0}},	/* A3 */
+    {0x0000, 0, {0}},	/* A4 */
+    {0x0000, 0, {0}},	/* A5 */
+    {0x0000, 0, {0}},	/* A6 */
+    {0x0000, 0, {0}},	/* A7 */
+    {0x0000, 0, {0}},	/* A8 */
+    {0x0000, 0, {0}},	/* A9 */
+    {0x0000, 0, {0}},	/* AA */
+    {0x0000, 0, {0}},	/* AB */
+    {0x0000, 0, {0}},	/* AC */
+    {0x0000, 0, {0}},	/* AD */
+    {0x0000, 0, {0}},	/* AE */
+    {0x0000, 0, {0}},	/* AF */
+    {0x0000, 0, {0}},	/* B0 */
+    {0x0000, 0, {0}},	/* B1 */
+    {0x0000, 0, {0}},	/* B2 */
+    {0x0000, 0, {0}},	/* B3 */
+    {0x0000, 0, {0}},	/* B4 */
+    {0x0000, 0, {0}},	/* B5 */
+    {0x0000, 0, {0}},	/* B6 */
+    {0x0000, 0, {0}},	/* B7 */
+    {0x0000, 0, {0}},	/* B8 */
+    {0x0000, 0, {0}},	/* B9 */
+    {0x0000, 0, {0}},	/* BA */
+    {0x0000, 0, {0}},	/* BB */
+    {0x0000, 0, {0}},	/* BC */
+    {0x0000, 0, {0}},	/* BD */
+    {0x0000, 0, {0}},	/* BE */
+    {0x0000, 0, {0}},	/* BF */
+    {0x0000, 0, {0}},	/* C0 */
+    {0x0000, 0, {0}},	/* C1 */
+    {0x0000, 0, {0}},	/* C2 */
+    {0x0000, 0, {0}},	/* C3 */
+    {0x0000, 0, {0}},	/* C4 */
+    {0x0000, 0, {0}},	/* C5 */
+    {0x0000, 0, {0}},	/* C6 */
+    {0x0000, 0, {0}},	/* C7 */
+    {0x0000, 0, {0}},	/* C8 */
+    {0x0000, 0, {0}},	/* C9 */
+    {0x0000, 0, {0}},	/* CA */
+    {0x0000, 0, {0}},	/* CB */
+    {0x0000, 0, {0}},	/* CC */
+    {0x0000, 0, {0}},	/* CD */
+    {0x0000, 0, {0}},	/* CE */
+    {0x0000, 0, {0}},	/* CF */
+    {0x0000, 0, {0}},	/* D0 */
+    {0x0000, 0, {0}},	/* D1 */
+    {0x0000, 0, {0}},	/* D2 */
+    {0x0000, 0, {0}},	/* D3 */
+    {0x0000, 0, {0}},	/* D4 */
+    {0x0000, 0, {0}},	/* D5 */
+    {0x0000, 0, {0}},	/* D6 */
+    {0x0000, 0, {0}},	/* D7 */
+    {0x0000, 0, {0}},	/* D8 */
+    {0x0000, 0, {0}},	/* D9 */
+    {0x0000, 0, {0}},	/* DA */
+    {0x0000, 0, {0}},	/* DB */
+    {0x0000, 0, {0}},	/* DC */
+    {0x0000, 0, {0}},	/* DD */
+    {0x0000, 0, {0}},	/* DE */
+    {0x0000, 0, {0}},	/* DF */
+    {0x0000, 0, {0}},	/* E0 */
+    {0x0000, 0, {0}},	/* E1 */
+    {0x0000, 0, {0}},	/* E2 */
+    {0x0000, 0, {0}},	/* E3 */
+    {0x0000, 0, {0}},	/* E4 */
+    {0x0000, 0, {0}},	/* E5 */
+    {0x0000, 0, {0}},	/* E6 */
+    {0x0000, 0, {0}},	/* E7 */
+    {0x0000, 0, {0}},	/* E8 */
+    {0x0000, 0, {0}},	/* E9 */
+    {0x0000, 0, {0}},	/* EA */
+    {0x0000, 0, {0}},	/* EB */
+    {0x0000, 0, {0}},	/* EC */
+    {0x0000, 0, {0}},	/* ED */
+    {0x0000, 0, {0}},	/* EE */
+    {0x0000, 0, {0}},	/* EF */
+    {0x0000, 0, {0}},	/* F0 */
+    {0x0000, 0, {0}},	/* F1 */
+    {0x0000, 0, {0}},	/* F2 */
+    {0x0000, 0, {0}},	/* F3 */
+    {0x0000, 0, {0}},	/* F4 */
+    {0x0000, 0, {0}},	/* F5 */
+    {0x0000, 0, {0}},	/* F6 */
+    {0x0000, 0, {0}},	/* F7 */
+    {0x0000, 0, {0}},	/* F8 */
+    {0x0000, 0, {0}},	/* F9 */
+    {0x0000, 0, {0}},	/* FA */
+    {0x0000, 0, {0}},	/* FB */
+    {0x0000, 0, {0}},	/* FC */
+    {0x0000, 0, {0}},	/* FD */
+    {0x0000, 0, {0}},	/* FE */
+    {0x0000, 0, {0}},	/* FF */
+};
+
+static const ReverseData dec_technical_rev[] =
+{
+    {0x00ac, 0x60},
+    {0x00d7, 0x4B},
+    {0x00f7, 0x43},
+    {0x0192, 0x76},
+    {0x0393, 0x47},
+    {0x0398, 0x4A},
+    {0x039a, 0x44},
+    {0x039b, 0x4C},
+    {0x039e, 0x58},
+    {0x03a0, 0x50},
+    {0x03a3, 0x53},
+    {0x03a5, 0x59},
+    {0x03a6, 0x46},
+    {0x03a8, 0x51},
+    {0x03a9, 0x57},
+    {0x03b1, 0x61},
+    {0x03b2, 0x62},
+    {0x03b3, 0x67},
+    {0x03b4, 0x64},
+    {0x03b5, 0x65},
+    {0x03b6, 0x7A},
+    {0x03b7, 0x68},
+    {0x03b8, 0x6A},
+    {0x03b9, 0x69},
+    {0x03ba, 0x6B},
+    {0x03bb, 0x6C},
+    {0x03bd, 0x6E},
+    {0x03be, 0x78},
+    {0x03c0, 0x70},
+    {0x03c1, 0x72},
+    {0x03c3, 0x73},
+    {0x03c4, 0x74},
+    {0x03c5, 0x79},
+    {0x03c6, 0x66},
+    {0x03c7, 0x63},
+    {0x03c8, 0x71},
+    {0x03c9, 0x77},
+    {0x2190, 0x7B},
+    {0x2191, 0x7C},
+    {0x2192, 0x7D},
+    {0x2193, 0x7E},
+    {0x21d2, 0x4E},
+    {0x21d4, 0x4D},
+    {0x2202, 0x6F},
+    {0x2207, 0x45},
+    {0x221a, 0x56},
+    {0x221d, 0x41},
+    {0x221e, 0x42},
+    {0x2227, 0x5E},
+    {0x2228, 0x5F},
+    {0x2229, 0x5C},
+    {0x222a, 0x5D},
+    {0x222b, 0x3F},
+    {0x2234, 0x40},
+    {0x223c, 0x48},
+    {0x2243, 0x49},
+    {0x2260, 0x3D},
+    {0x2261, 0x4F},
+    {0x2264, 0x3C},
+    {0x2265, 0x3E},
+    {0x2282, 0x5A},
+    {0x2283, 0x5B},
+    {0x2320, 0x24},
+    {0x2321, 0x25},
+    {0x239b, 0x2B},
+    {0x239d, 0x2C},
+    {0x239e, 0x2D},
+    {0x23a0, 0x2E},
+    {0x23a1, 0x27},
+    {0x23a3, 0x28},
+    {0x23a4, 0x29},
+    {0x23a6, 0x2A},
+    {0x23a8, 0x2F},
+    {0x23ac, 0x30},
+    {0x23b7, 0x21},
+    {0x2426, 0x31},
+    {0x2426, 0x32},
+    {0x2426, 0x33},
+    {0x2426, 0x34},
+    {0x2426, 0x35},
+    {0x2426, 0x36},
+    {0x2426, 0x37},
+    {0x2426, 0x38},
+    {0x2426, 0x39},
+    {0x2426, 0x3A},
+    {0x2426, 0x3B},
+    {0x2426, 0x52},
+    {0x2426, 0x54},
+    {0x2426, 0x55},
+    {0x2426, 0x6D},
+    {0x2426, 0x75},
+    {0x2500, 0x23},
+    {0x2502, 0x26},
+    {0x250c, 0x22},
+};
+
 static const BuiltInMapping iso8859_1[] =
 {
     /* iso8859-1 */
     {0, 0},	/* empty table is illegal syntax */
 };
 
+static const MappingData iso8859_1_utf8[] =
+{
+    {0x0000, 1, {0x00}},	/* 00 */
+    {0x0000, 0, {0}},	/* 01 */
+    {0x0000, 0, {0}},	/* 02 */
+    {0x0000, 0, {0}},	/* 03 */
+    {0x0000, 0, {0}},	/* 04 */
+    {0x0000, 0, {0}},	/* 05 */
+    {0x0000, 0, {0}},	/* 06 */
+    {0x0000, 0, {0}},	/* 07 */
+    {0x0000, 0, {0}},	/* 08 */
+    {0x0000, 0, {0}},	/* 09 */
+    {0x0000, 0, {0}},	/* 0A */
+    {0x0000, 0, {0}},	/* 0B */
+    {0x0000, 0, {0}},	/* 0C */
+    {0x0000, 0, {0}},	/* 0D */
+    {0x0000, 0, {0}},	/* 0E */
+    {0x0000, 0, {0}},	/* 0F */
+    {0x0000, 0, {0}},	/* 10 */
+    {0x0000, 0, {0}},	/* 11 */
+    {0x0000, 0, {0}},	/* 12 */
+    {0x0000, 0, {0}},	/* 13 */
+    {0x0000, 0, {0}},	/* 14 */
+    {0x0000, 0, {0}},	/* 15 */
+    {0x0000, 0, {0}},	/* 16 */
+    {0x0000, 0, {0}},	/* 17 */
+    {0x0000, 0, {0}},	/* 18 */
+    {0x0000, 0, {0}},	/* 19 */
+    {0x0000, 0, {0}},	/* 1A */
+    {0x0000, 0, {0}},	/* 1B */
+    {0x0000, 0, {0}},	/* 1C */
+    {0x0000, 0, {0}},	/* 1D */
+    {0x0000, 0, {0}},	/* 1E */
+    {0x0000, 0, {0}},	/* 1F */
+    {0x0000, 0, {0}},	/* 20 */
+    {0x0000, 0, {0}},	/* 21 */
+    {0x0000, 0, {0}},	/* 22 */
+    {0x0000, 0, {0}},	/* 23 */
+    {0x0000, 0, {0}},	/* 24 */
+    {0x0000, 0, {0}},	/* 25 */
+    {0x0000, 0, {0}},	/* 26 */
+    {0x0000, 0, {0}},	/* 27 */
+    {0x0000, 0, {0}},	/* 28 */
+    {0x0000, 0, {0}},	/* 29 */
+    {0x0000, 0, {0}},	/* 2A */
+    {0x0000, 0, {0}},	/* 2B */
+    {0x0000, 0, {0}},	/* 2C */
+    {0x0000, 0, {0}},	/* 2D */
+    {0x0000, 0, {0}},	/* 2E */
+    {0x0000, 0, {0}},	/* 2F */
+    {0x0000, 0, {0}},	/* 30 */
+    {0x0000, 0, {0}},	/* 31 */
+    {0x0000, 0, {0}},	/* 32 */
+    {0x0000, 0, {0}},	/* 33 */
+    {0x0000, 0, {0}},	/* 34 */
+    {0x0000, 0, {0}},	/* 35 */
+    {0x0000, 0, {0}},	/* 36 */
+    {0x0000, 0, {0}},	/* 37 */
+    {0x0000, 0, {0}},	/* 38 */
+    {0x0000, 0, {0}},	/* 39 */
+    {0x0000, 0, {0}},	/* 3A */
+    {0x0000, 0, {0}},	/* 3B */
+    {0x0000, 0, {0}},	/* 3C */
+    {0x0000, 0, {0}},	/* 3D */
+    {0x0000, 0, {0}},	/* 3E */
+    {0x0000, 0, {0}},	/* 3F */
+    {0x0000, 0, {0}},	/* 40 */
+    {0x0000, 0, {0}},	/* 41 */
+    {0x0000, 0, {0}},	/* 42 */
+    {0x0000, 0, {0}},	/* 43 */
+    {0x0000, 0, {0}},	/* 44 */
+    {0x0000, 0, {0}},	/* 45 */
+    {0x0000, 0, {0}},	/* 46 */
+    {0x0000, 0, {0}},	/* 47 */
+    {0x0000, 0, {0}},	/* 48 */
+    {0x0000, 0, {0}},	/* 49 */
+    {0x0000, 0, {0}},	/* 4A */
+    {0x0000, 0, {0}},	/* 4B */
+    {0x0000, 0, {0}},	/* 4C */
+    {0x0000, 0, {0}},	/* 4D */
+    {0x0000, 0, {0}},	/* 4E */
+    {0x0000, 0, {0}},	/* 4F */
+    {0x0000, 0, {0}},	/* 50 */
+    {0x0000, 0, {0}},	/* 51 */
+    {0x0000, 0, {0}},	/* 52 */
+    {0x0000, 0, {0}},	/* 53 */
+    {0x0000, 0, {0}},	/* 54 */
+    {0x0000, 0, {0}},	/* 55 */
+    {0x0000, 0, {0}},	/* 56 */
+    {0x0000, 0, {0}},	/* 57 */
+    {0x0000, 0, {0}},	/* 58 */
+    {0x0000, 0, {0}},	/* 59 */
+    {0x0000, 0, {0}},	/* 5A */
+    {0x0000, 0, {0}},	/* 5B */
+    {0x0000, 0, {0}},	/* 5C */
+    {0x0000, 0, {0}},	/* 5D */
+    {0x0000, 0, {0}},	/* 5E */
+    {0x0000, 0, {0}},	/* 5F */
+    {0x0000, 0, {0}},	/* 60 */
+    {0x0000, 0, {0}},	/* 61 */
+    {0x0000, 0, {0}},	/* 62 */
+    {0x0000, 0, {0}},	/* 63 */
+    {0x0000, 0, {0}},	/* 64 */
+    {0x0000, 0, {0}},	/* 65 */
+    {0x0000, 0, {0}},	/* 66 */
+    {0x0000, 0, {0}},	/* 67 */
+    {0x0000, 0, {0}},	/* 68 */
+    {0x0000, 0, {0}},	/* 69 */
+    {0x0000, 0, {0}},	/* 6A */
+    {0x0000, 0, {0}},	/* 6B */
+    {0x0000, 0, {0}},	/* 6C */
+    {0x0000, 0, {0}},	/* 6D */
+    {0x0000, 0, {0}},	/* 6E */
+    {0x0000, 0, {0}},	/* 6F */
+    {0x0000, 0, {0}},	/* 70 */
+    {0x0000, 0, {0}},	/* 71 */
+    {0x0000, 0, {0}},	/* 72 */
+    {0x0000, 0, {0}},	/* 73 */
+    {0x0000, 0, {0}},	/* 74 */
+    {0x0000, 0, {0}},	/* 75 */
+    {0x0000, 0, {0}},	/* 76 */
+    {0x0000, 0, {0}},	/* 77 */
+    {0x0000, 0, {0}},	/* 78 */
+    {0x0000, 0, {0}},	/* 79 */
+    {0x0000, 0, {0}},	/* 7A */
+    {0x0000, 0, {0}},	/* 7B */
+    {0x0000, 0, {0}},	/* 7C */
+    {0x0000, 0, {0}},	/* 7D */
+    {0x0000, 0, {0}},	/* 7E */
+    {0x0000, 0, {0}},	/* 7F */
+    {0x0000, 0, {0}},	/* 80 */
+    {0x0000, 0, {0}},	/* 81 */
+    {0x0000, 0, {0}},	/* 82 */
+    {0x0000, 0, {0}},	/* 83 */
+    {0x0000, 0, {0}},	/* 84 */
+    {0x0000, 0, {0}},	/* 85 */
+    {0x0000, 0, {0}},	/* 86 */
+    {0x0000, 0, {0}},	/* 87 */
+    {0x0000, 0, {0}},	/* 88 */
+    {0x0000, 0, {0}},	/* 89 */
+    {0x0000, 0, {0}},	/* 8A */
+    {0x0000, 0, {0}},	/* 8B */
+    {0x0000, 0, {0}},	/* 8C */
+    {0x0000, 0, {0}},	/* 8D */
+    {0x0000, 0, {0}},	/* 8E */
+    {0x0000, 0, {0}},	/* 8F */
+    {0x0000, 0, {0}},	/* 90 */
+    {0x0000, 0, {0}},	/* 91 */
+    {0x0000, 0, {0}},	/* 92 */
+    {0x0000, 0, {0}},	/* 93 */
+    {0x0000, 0, {0}},	/* 94 */
+    {0x0000, 0, {0}},	/* 95 */
+    {0x0000, 0, {0}},	/* 96 */
+    {0x0000, 0, {0}},	/* 97 */
+    {0x0000, 0, {0}},	/* 98 */
+    {0x0000, 0, {0}},	/* 99 */
+    {0x0000, 0, {0}},	/* 9A */
+    {0x0000, 0, {0}},	/* 9B */
+    {0x0000, 0, {0}},	/* 9C */
+    {0x0000, 0, {0}},	/* 9D */
+    {0x0000, 0, {0}},	/* 9E */
+    {0x0000, 0, {0}},	/* 9F */
+    {0x0000, 0, {0}},	/* A0 */
+    {0x0000, 0, {0}},	/* A1 */
+    {0x0000, 0, {0}},	/* A2 */
+    {0x0000, 0, {0}},	/* A3 */
+    {0x0000, 0, {0}},	/* A4 */
+    {0x0000, 0, {0}},	/* A5 */
+    {0x0000, 0, {0}},	/* A6 */
+    {0x0000, 0, {0}},	/* A7 */
+    {0x0000, 0, {0}},	/* A8 */
+    {0x0000, 0, {0}},	/* A9 */
+    {0x0000, 0, {0}},	/* AA */
+    {0x0000, 0, {0}},	/* AB */
+    {0x0000, 0, {0}},	/* AC */
+    {0x0000, 0, {0}},	/* AD */
+    {0x0000, 0, {0}},	/* AE */
+    {0x0000, 0, {0}},	/* AF */
+    {0x0000, 0, {0}},	/* B0 */
+    {0x0000, 0, {0}},	/* B1 */
+    {0x0000, 0, {0}},	/* B2 */
+    {0x0000, 0, {0}},	/* B3 */
+    {0x0000, 0, {0}},	/* B4 */
+    {0x0000, 0, {0}},	/* B5 */
+    {0x0000, 0, {0}},	/* B6 */
+    {0x0000, 0, {0}},	/* B7 */
+    {0x0000, 0, {0}},	/* B8 */
+    {0x0000, 0, {0}},	/* B9 */
+    {0x0000, 0, {0}},	/* BA */
+    {0x0000, 0, {0}},	/* BB */
+    {0x0000, 0, {0}},	/* BC */
+    {0x0000, 0, {0}},	/* BD */
+    {0x0000, 0, {0}},	/* BE */
+    {0x0000, 0, {0}},	/* BF */
+    {0x0000, 0, {0}},	/* C0 */
+    {0x0000, 0, {0}},	/* C1 */
+    {0x0000, 0, {0}},	/* C2 */
+    {0x0000, 0, {0}},	/* C3 */
+    {0x0000, 0, {0}},	/* C4 */
+    {0x0000, 0, {0}},	/* C5 */
+    {0x0000, 0, {0}},	/* C6 */
+    {0x0000, 0, {0}},	/* C7 */
+    {0x0000, 0, {0}},	/* C8 */
+    {0x0000, 0, {0}},	/* C9 */
+    {0x0000, 0, {0}},	/* CA */
+    {0x0000, 0, {0}},	/* CB */
+    {0x0000, 0, {0}},	/* CC */
+    {0x0000, 0, {0}},	/* CD */
+    {0x0000, 0, {0}},	/* CE */
+    {0x0000, 0, {0}},	/* CF */
+    {0x0000, 0, {0}},	/* D0 */
+    {0x0000, 0, {0}},	/* D1 */
+    {0x0000, 0, {0}},	/* D2 */
+    {0x0000, 0, {0}},	/* D3 */
+    {0x0000, 0, {0}},	/* D4 */
+    {0x0000, 0, {0}},	/* D5 */
+    {0x0000, 0, {0}},	/* D6 */
+    {0x0000, 0, {0}},	/* D7 */
+    {0x0000, 0, {0}},	/* D8 */
+    {0x0000, 0, {0}},	/* D9 */
+    {0x0000, 0, {0}},	/* DA */
+    {0x0000, 0, {0}},	/* DB */
+    {0x0000, 0, {0}},	/* DC */
+    {0x0000, 0, {0}},	/* DD */
+    {0x0000, 0, {0}},	/* DE */
+    {0x0000, 0, {0}},	/* DF */
+    {0x0000, 0, {0}},	/* E0 */
+    {0x0000, 0, {0}},	/* E1 */
+    {0x0000, 0, {0}},	/* E2 */
+    {0x0000, 0, {0}},	/* E3 */
+    {0x0000, 0, {0}},	/* E4 */
+    {0x0000, 0, {0}},	/* E5 */
+    {0x0000, 0, {0}},	/* E6 */
+    {0x0000, 0, {0}},	/* E7 */
+    {0x0000, 0, {0}},	/* E8 */
+    {0x0000, 0, {0}},	/* E9 */
+    {0x0000, 0, {0}},	/* EA */
+    {0x0000, 0, {0}},	/* EB */
+    {0x0000, 0, {0}},	/* EC */
+    {0x0000, 0, {0}},	/* ED */
+    {0x0000, 0, {0}},	/* EE */
+    {0x0000, 0, {0}},	/* EF */
+    {0x0000, 0, {0}},	/* F0 */
+    {0x0000, 0, {0}},	/* F1 */
+    {0x0000, 0, {0}},	/* F2 */
+    {0x0000, 0, {0}},	/* F3 */
+    {0x0000, 0, {0}},	/* F4 */
+    {0x0000, 0, {0}},	/* F5 */
+    {0x0000, 0, {0}},	/* F6 */
+    {0x0000, 0, {0}},	/* F7 */
+    {0x0000, 0, {0}},	/* F8 */
+    {0x0000, 0, {0}},	/* F9 */
+    {0x0000, 0, {0}},	/* FA */
+    {0x0000, 0, {0}},	/* FB */
+    {0x0000, 0, {0}},	/* FC */
+    {0x0000, 0, {0}},	/* FD */
+    {0x0000, 0, {0}},	/* FE */
+    {0x0000, 0, {0}},	/* FF */
+};
+
+static const ReverseData iso8859_1_rev[] =
+{
+    {0, 0},	/* empty table is illegal syntax */
+};
+
 static const BuiltInMapping iso8859_10[] =
 {
     /* iso8859-10 */
@@ -199,6 +1118,316 @@ static const BuiltInMapping iso8859_10[] =
     {0x00FF, 0x0138},
 };
 
+static const MappingData iso8859_10_utf8[] =
+{
+    {0x0000, 0, {0}},	/* 00 */
+    {0x0001, 0, {0}},	/* 01 */
+    {0x0002, 0, {0}},	/* 02 */
+    {0x0003, 0, {0}},	/* 03 */
+    {0x0004, 0, {0}},	/* 04 */
+    {0x0005, 0, {0}},	/* 05 */
+    {0x0006, 0, {0}},	/* 06 */
+    {0x0007, 0, {0}},	/* 07 */
+    {0x0008, 0, {0}},	/* 08 */
+    {0x0009, 0, {0}},	/* 09 */
+    {0x000a, 0, {0}},	/* 0A */
+    {0x000b, 0, {0}},	/* 0B */
+    {0x000c, 0, {0}},	/* 0C */
+    {0x000d, 0, {0}},	/* 0D */
+    {0x000e, 0, {0}},	/* 0E */
+    {0x000f, 0, {0}},	/* 0F */
+    {0x0010, 0, {0}},	/* 10 */
+    {0x0011, 0, {0}},	/* 11 */
+    {0x0012, 0, {0}},	/* 12 */
+    {0x0013, 0, {0}},	/* 13 */
+    {0x0014, 0, {0}},	/* 14 */
+    {0x0015, 0, {0}},	/* 15 */
+    {0x0016, 0, {0}},	/* 16 */
+    {0x0017, 0, {0}},	/* 17 */
+    {0x0018, 0, {0}},	/* 18 */
+    {0x0019, 0, {0}},	/* 19 */
+    {0x001a, 0, {0}},	/* 1A */
+    {0x001b, 0, {0}},	/* 1B */
+    {0x001c, 0, {0}},	/* 1C */
+    {0x001d, 0, {0}},	/* 1D */
+    {0x001e, 0, {0}},	/* 1E */
+    {0x001f, 0, {0}},	/* 1F */
+    {0x0020, 0, {0}},	/* 20 */
+    {0x0021, 0, {0}},	/* 21 */
+    {0x0022, 0, {0}},	/* 22 */
+    {0x0023, 0, {0}},	/* 23 */
+    {0x0024, 0, {0}},	/* 24 */
+    {0x0025, 0, {0}},	/* 25 */
+    {0x0026, 0, {0}},	/* 26 */
+    {0x0027, 0, {0}},	/* 27 */
+    {0x0028, 0, {0}},	/* 28 */
+    {0x0029, 0, {0}},	/* 29 */
+    {0x002a, 0, {0}},	/* 2A */
+    {0x002b, 0, {0}},	/* 2B */
+    {0x002c, 0, {0}},	/* 2C */
+    {0x002d, 0, {0}},	/* 2D */
+    {0x0000, 0, {0}},	/* 2E */
+    {0x0000, 0, {0}},	/* 2F */
+    {0x0000, 0, {0}},	/* 30 */
+    {0x0000, 0, {0}},	/* 31 */
+    {0x0000, 0, {0}},	/* 32 */
+    {0x0000, 0, {0}},	/* 33 */
+    {0x0000, 0, {0}},	/* 34 */
+    {0x0000, 0, {0}},	/* 35 */
+    {0x0000, 0, {0}},	/* 36 */
+    {0x0000, 0, {0}},	/* 37 */
+    {0x0000, 0, {0}},	/* 38 */
+    {0x0000, 0, {0}},	/* 39 */
+    {0x0000, 0, {0}},	/* 3A */
+    {0x0000, 0, {0}},	/* 3B */
+    {0x0000, 0, {0}},	/* 3C */
+    {0x0000, 0, {0}},	/* 3D */
+    {0x0000, 0, {0}},	/* 3E */
+    {0x0000, 0, {0}},	/* 3F */
+    {0x0000, 0, {0}},	/* 40 */
+    {0x0000, 0, {0}},	/* 41 */
+    {0x0000, 0, {0}},	/* 42 */
+    {0x0000, 0, {0}},	/* 43 */
+    {0x0000, 0, {0}},	/* 44 */
+    {0x0000, 0, {0}},	/* 45 */
+    {0x0000, 0, {0}},	/* 46 */
+    {0x0000, 0, {0}},	/* 47 */
+    {0x0000, 0, {0}},	/* 48 */
+    {0x0000, 0, {0}},	/* 49 */
+    {0x0000, 0, {0}},	/* 4A */
+    {0x0000, 0, {0}},	/* 4B */
+    {0x0000, 0, {0}},	/* 4C */
+    {0x0000, 0, {0}},	/* 4D */
+    {0x0000, 0, {0}},	/* 4E */
+    {0x0000, 0, {0}},	/* 4F */
+    {0x0000, 0, {0}},	/* 50 */
+    {0x0000, 0, {0}},	/* 51 */
+    {0x0000, 0, {0}},	/* 52 */
+    {0x0000, 0, {0}},	/* 53 */
+    {0x0000, 0, {0}},	/* 54 */
+    {0x0000, 0, {0}},	/* 55 */
+    {0x0000, 0, {0}},	/* 56 */
+    {0x0000, 0, {0}},	/* 57 */
+    {0x0000, 0, {0}},	/* 58 */
+    {0x0000, 0, {0}},	/* 59 */
+    {0x0000, 0, {0}},	/* 5A */
+    {0x0000, 0, {0}},	/* 5B */
+    {0x0000, 0, {0}},	/* 5C */
+    {0x0000, 0, {0}},	/* 5D */
+    {0x0000, 0, {0}},	/* 5E */
+    {0x0000, 0, {0}},	/* 5F */
+    {0x0000, 0, {0}},	/* 60 */
+    {0x0000, 0, {0}},	/* 61 */
+    {0x0000, 0, {0}},	/* 62 */
+    {0x0000, 0, {0}},	/* 63 */
+    {0x0000, 0, {0}},	/* 64 */
+    {0x0000, 0, {0}},	/* 65 */
+    {0x0000, 0, {0}},	/* 66 */
+    {0x0000, 0, {0}},	/* 67 */
+    {0x0000, 0, {0}},	/* 68 */
+    {0x0000, 0, {0}},	/* 69 */
+    {0x0000, 0, {0}},	/* 6A */
+    {0x0000, 0, {0}},	/* 6B */
+    {0x0000, 0, {0}},	/* 6C */
+    {0x0000, 0, {0}},	/* 6D */
+    {0x0000, 0, {0}},	/* 6E */
+    {0x0000, 0, {0}},	/* 6F */
+    {0x0000, 0, {0}},	/* 70 */
+    {0x0000, 0, {0}},	/* 71 */
+    {0x0000, 0, {0}},	/* 72 */
+    {0x0000, 0, {0}},	/* 73 */
+    {0x0000, 0, {0}},	/* 74 */
+    {0x0000, 0, {0}},	/* 75 */
+    {0x0000, 0, {0}},	/* 76 */
+    {0x0000, 0, {0}},	/* 77 */
+    {0x0000, 0, {0}},	/* 78 */
+    {0x0000, 0, {0}},	/* 79 */
+    {0x0000, 0, {0}},	/* 7A */
+    {0x0000, 0, {0}},	/* 7B */
+    {0x0000, 0, {0}},	/* 7C */
+    {0x0000, 0, {0}},	/* 7D */
+    {0x0000, 0, {0}},	/* 7E */
+    {0x0000, 0, {0}},	/* 7F */
+    {0x0000, 0, {0}},	/* 80 */
+    {0x0000, 0, {0}},	/* 81 */
+    {0x0000, 0, {0}},	/* 82 */
+    {0x0000, 0, {0}},	/* 83 */
+    {0x0000, 0, {0}},	/* 84 */
+    {0x0000, 0, {0}},	/* 85 */
+    {0x0000, 0, {0}},	/* 86 */
+    {0x0000, 0, {0}},	/* 87 */
+    {0x0000, 0, {0}},	/* 88 */
+    {0x0000, 0, {0}},	/* 89 */
+    {0x0000, 0, {0}},	/* 8A */
+    {0x0000, 0, {0}},	/* 8B */
+    {0x0000, 0, {0}},	/* 8C */
+    {0x0000, 0, {0}},	/* 8D */
+    {0x0000, 0, {0}},	/* 8E */
+    {0x0000, 0, {0}},	/* 8F */
+    {0x0000, 0, {0}},	/* 90 */
+    {0x0000, 0, {0}},	/* 91 */
+    {0x0000, 0, {0}},	/* 92 */
+    {0x0000, 0, {0}},	/* 93 */
+    {0x0000, 0, {0}},	/* 94 */
+    {0x0000, 0, {0}},	/* 95 */
+    {0x0000, 0, {0}},	/* 96 */
+    {0x0000, 0, {0}},	/* 97 */
+    {0x0000, 0, {0}},	/* 98 */
+    {0x0000, 0, {0}},	/* 99 */
+    {0x0000, 0, {0}},	/* 9A */
+    {0x0000, 0, {0}},	/* 9B */
+    {0x0000, 0, {0}},	/* 9C */
+    {0x0000, 0, {0}},	/* 9D */
+    {0x0000, 0, {0}},	/* 9E */
+    {0x0000, 0, {0}},	/* 9F */
+    {0x0000, 0, {0}},	/* A0 */
+    {0x0104, 2, {0xc4, 0x84}},	/* A1 */
+    {0x0112, 2, {0xc4, 0x92}},	/* A2 */
+    {0x0122, 2, {0xc4, 0xa2}},	/* A3 */
+    {0x012a, 2, {0xc4, 0xaa}},	/* A4 */
+    {0x0128, 2, {0xc4, 0xa8}},	/* A5 */
+    {0x0136, 2, {0xc4, 0xb6}},	/* A6 */
+    {0x0000, 0, {0}},	/* A7 */
+    {0x013b, 2, {0xc4, 0xbb}},	/* A8 */
+    {0x0110, 2, {0xc4, 0x90}},	/* A9 */
+    {0x0160, 2, {0xc5, 0xa0}},	/* AA */
+    {0x0166, 2, {0xc5, 0xa6}},	/* AB */
+    {0x017d, 2, {0xc5, 0xbd}},	/* AC */
+    {0x0000, 0, {0}},	/* AD */
+    {0x016a, 2, {0xc5, 0xaa}},	/* AE */
+    {0x014a, 2, {0xc5, 0x8a}},	/* AF */
+    {0x0000, 0, {0}},	/* B0 */
+    {0x0105, 2, {0xc4, 0x85}},	/* B1 */
+    {0x0113, 2, {0xc4, 0x93}},	/* B2 */
+    {0x0123, 2, {0xc4, 0xa3}},	/* B3 */
+    {0x012b, 2, {0xc4, 0xab}},	/* B4 */
+    {0x0129, 2, {0xc4, 0xa9}},	/* B5 */
+    {0x0137, 2, {0xc4, 0xb7}},	/* B6 */
+    {0x0000, 0, {0}},	/* B7 */
+    {0x013c, 2, {0xc4, 0xbc}},	/* B8 */
+    {0x0111, 2, {0xc4, 0x91}},	/* B9 */
+    {0x0161, 2, {0xc5, 0xa1}},	/* BA */
+    {0x0167, 2, {0xc5, 0xa7}},	/* BB */
+    {0x017e, 2, {0xc5, 0xbe}},	/* BC */
+    {0x2015, 3, {0xe2, 0x80, 0x95}},	/* BD */
+    {0x016b, 2, {0xc5, 0xab}},	/* BE */
+    {0x014b, 2, {0xc5, 0x8b}},	/* BF */
+    {0x0100, 2, {0xc4, 0x80}},	/* C0 */
+    {0x0000, 0, {0}},	/* C1 */
+    {0x0000, 0, {0}},	/* C2 */
+    {0x0000, 0, {0}},	/* C3 */
+    {0x0000, 0, {0}},	/* C4 */
+    {0x0000, 0, {0}},	/* C5 */
+    {0x0000, 0, {0}},	/* C6 */
+    {0x012e, 2, {0xc4, 0xae}},	/* C7 */
+    {0x010c, 2, {0xc4, 0x8c}},	/* C8 */
+    {0x0000, 0, {0}},	/* C9 */
+    {0x0118, 2, {0xc4, 0x98}},	/* CA */
+    {0x0000, 0, {0}},	/* CB */
+    {0x0116, 2, {0xc4, 0x96}},	/* CC */
+    {0x0000, 0, {0}},	/* CD */
+    {0x0000, 0, {0}},	/* CE */
+    {0x0000, 0, {0}},	/* CF */
+    {0x0000, 0, {0}},	/* D0 */
+    {0x0145, 2, {0xc5, 0x85}},	/* D1 */
+    {0x014c, 2, {0xc5, 0x8c}},	/* D2 */
+    {0x0000, 0, {0}},	/* D3 */
+    {0x0000, 0, {0}},	/* D4 */
+    {0x0000, 0, {0}},	/* D5 */
+    {0x0000, 0, {0}},	/* D6 */
+    {0x0168, 2, {0xc5, 0xa8}},	/* D7 */
+    {0x0000, 0, {0}},	/* D8 */
+    {0x0172, 2, {0xc5, 0xb2}},	/* D9 */
+    {0x0000, 0, {0}},	/* DA */
+    {0x0000, 0, {0}},	/* DB */
+    {0x0000, 0, {0}},	/* DC */
+    {0x0000, 0, {0}},	/* DD */
+    {0x0000, 0, {0}},	/* DE */
+    {0x0000, 0, {0}},	/* DF */
+    {0x0101, 2, {0xc4, 0x81}},	/* E0 */
+    {0x0000, 0, {0}},	/* E1 */
+    {0x0000, 0, {0}},	/* E2 */
+    {0x0000, 0, {0}},	/* E3 */
+    {0x0000, 0, {0}},	/* E4 */
+    {0x0000, 0, {0}},	/* E5 */
+    {0x0000, 0, {0}},	/* E6 */
+    {0x012f, 2, {0xc4, 0xaf}},	/* E7 */
+    {0x010d, 2, {0xc4, 0x8d}},	/* E8 */
+    {0x0000, 0, {0}},	/* E9 */
+    {0x0119, 2, {0xc4, 0x99}},	/* EA */
+    {0x0000, 0, {0}},	/* EB */
+    {0x0117, 2, {0xc4, 0x97}},	/* EC */
+    {0x0000, 0, {0}},	/* ED */
+    {0x0000, 0, {0}},	/* EE */
+    {0x0000, 0, {0}},	/* EF */
+    {0x0000, 0, {0}},	/* F0 */
+    {0x0146, 2, {0xc5, 0x86}},	/* F1 */
+    {0x014d, 2, {0xc5, 0x8d}},	/* F2 */
+    {0x0000, 0, {0}},	/* F3 */
+    {0x0000, 0, {0}},	/* F4 */
+    {0x0000, 0, {0}},	/* F5 */
+    {0x0000, 0, {0}},	/* F6 */
+    {0x0169, 2, {0xc5, 0xa9}},	/* F7 */
+    {0x0000, 0, {0}},	/* F8 */
+    {0x0173, 2, {0xc5, 0xb3}},	/* F9 */
+    {0x0000, 0, {0}},	/* FA */
+    {0x0000, 0, {0}},	/* FB */
+    {0x0000, 0, {0}},	/* FC */
+    {0x0000, 0, {0}},	/* FD */
+    {0x0000, 0, {0}},	/* FE */
+    {0x0138, 2, {0xc4, 0xb8}},	/* FF */
+};
+
+static const ReverseData iso8859_10_rev[] =
+{
+    {0x0100, 0xC0},
+    {0x0101, 0xE0},
+    {0x0104, 0xA1},
+    {0x0105, 0xB1},
+    {0x010c, 0xC8},
+    {0x010d, 0xE8},
+    {0x0110, 0xA9},
+    {0x0111, 0xB9},
+    {0x0112, 0xA2},
+    {0x0113, 0xB2},
+    {0x0116, 0xCC},
+    {0x0117, 0xEC},
+    {0x0118, 0xCA},
+    {0x0119, 0xEA},
+    {0x0122, 0xA3},
+    {0x0123, 0xB3},
+    {0x0128, 0xA5},
+    {0x0129, 0xB5},
+    {0x012a, 0xA4},
+    {0x012b, 0xB4},
+    {0x012e, 0xC7},
+    {0x012f, 0xE7},
+    {0x0136, 0xA6},
+    {0x0137, 0xB6},
+    {0x0138, 0xFF},
+    {0x013b, 0xA8},
+    {0x013c, 0xB8},
+    {0x0145, 0xD1},
+    {0x0146, 0xF1},
+    {0x014a, 0xAF},
+    {0x014b, 0xBF},
+    {0x014c, 0xD2},
+    {0x014d, 0xF2},
+    {0x0160, 0xAA},
+    {0x0161, 0xBA},
+    {0x0166, 0xAB},
+    {0x0167, 0xBB},
+    {0x0168, 0xD7},
+    {0x0169, 0xF7},
+    {0x016a, 0xAE},
+    {0x016b, 0xBE},
+    {0x0172, 0xD9},
+    {0x0173, 0xF9},
+    {0x017d, 0xAC},
+    {0x017e, 0xBC},
+    {0x2015, 0xBD},
+};
+
 static const BuiltInMapping iso8859_15[] =
 {
     /* iso8859-15 */
@@ -212,6 +1441,278 @@ static const BuiltInMapping iso8859_15[] =
     {0x00BE, 0x0178},
 };
 
+static const MappingData iso8859_15_utf8[] =
+{
+    {0x0000, 0, {0}},	/* 00 */
+    {0x0001, 0, {0}},	/* 01 */
+    {0x0002, 0, {0}},	/* 02 */
+    {0x0003, 0, {0}},	/* 03 */
+    {0x0004, 0, {0}},	/* 04 */
+    {0x0005, 0, {0}},	/* 05 */
+    {0x0006, 0, {0}},	/* 06 */
+    {0x0007, 0, {0}},	/* 07 */
+    {0x0000, 0, {0}},	/* 08 */
+    {0x0000, 0, {0}},	/* 09 */
+    {0x0000, 0, {0}},	/* 0A */
+    {0x0000, 0, {0}},	/* 0B */
+    {0x0000, 0, {0}},	/* 0C */
+    {0x0000, 0, {0}},	/* 0D */
+    {0x0000, 0, {0}},	/* 0E */
+    {0x0000, 0, {0}},	/* 0F */
+    {0x0000, 0, {0}},	/* 10 */
+    {0x0000, 0, {0}},	/* 11 */
+    {0x0000, 0, {0}},	/* 12 */
+    {0x0000, 0, {0}},	/* 13 */
+    {0x0000, 0, {0}},	/* 14 */
+    {0x0000, 0, {0}},	/* 15 */
+    {0x0000, 0, {0}},	/* 16 */
+    {0x0000, 0, {0}},	/* 17 */
+    {0x0000, 0, {0}},	/* 18 */
+    {0x0000, 0, {0}},	/* 19 */
+    {0x0000, 0, {0}},	/* 1A */
+    {0x0000, 0, {0}},	/* 1B */
+    {0x0000, 0, {0}},	/* 1C */
+    {0x0000, 0, {0}},	/* 1D */
+    {0x0000, 0, {0}},	/* 1E */
+    {0x0000, 0, {0}},	/* 1F */
+    {0x0000, 0, {0}},	/* 20 */
+    {0x0000, 0, {0}},	/* 21 */
+    {0x0000, 0, {0}},	/* 22 */
+    {0x0000, 0, {0}},	/* 23 */
+    {0x0000, 0, {0}},	/* 24 */
+    {0x0000, 0, {0}},	/* 25 */
+    {0x0000, 0, {0}},	/* 26 */
+    {0x0000, 0, {0}},	/* 27 */
+    {0x0000, 0, {0}},	/* 28 */
+    {0x0000, 0, {0}},	/* 29 */
+    {0x0000, 0, {0}},	/* 2A */
+    {0x0000, 0, {0}},	/* 2B */
+    {0x0000, 0, {0}},	/* 2C */
+    {0x0000, 0, {0}},	/* 2D */
+    {0x0000, 0, {0}},	/* 2E */
+    {0x0000, 0, {0}},	/* 2F */
+    {0x0000, 0, {0}},	/* 30 */
+    {0x0000, 0, {0}},	/* 31 */
+    {0x0000, 0, {0}},	/* 32 */
+    {0x0000, 0, {0}},	/* 33 */
+    {0x0000, 0, {0}},	/* 34 */
+    {0x0000, 0, {0}},	/* 35 */
+    {0x0000, 0, {0}},	/* 36 */
+    {0x0000, 0, {0}},	/* 37 */
+    {0x0000, 0, {0}},	/* 38 */
+    {0x0000, 0, {0}},	/* 39 */
+    {0x0000, 0, {0}},	/* 3A */
+    {0x0000, 0, {0}},	/* 3B */
+    {0x0000, 0, {0}},	/* 3C */
+    {0x0000, 0, {0}},	/* 3D */
+    {0x0000, 0, {0}},	/* 3E */
+    {0x0000, 0, {0}},	/* 3F */
+    {0x0000, 0, {0}},	/* 40 */
+    {0x0000, 0, {0}},	/* 41 */
+    {0x0000, 0, {0}},	/* 42 */
+    {0x0000, 0, {0}},	/* 43 */
+    {0x0000, 0, {0}},	/* 44 */
+    {0x0000, 0, {0}},	/* 45 */
+    {0x0000, 0, {0}},	/* 46 */
+    {0x0000, 0, {0}},	/* 47 */
+    {0x0000, 0, {0}},	/* 48 */
+    {0x0000, 0, {0}},	/* 49 */
+    {0x0000, 0, {0}},	/* 4A */
+    {0x0000, 0, {0}},	/* 4B */
+    {0x0000, 0, {0}},	/* 4C */
+    {0x0000, 0, {0}},	/* 4D */
+    {0x0000, 0, {0}},	/* 4E */
+    {0x0000, 0, {0}},	/* 4F */
+    {0x0000, 0, {0}},	/* 50 */
+    {0x0000, 0, {0}},	/* 51 */
+    {0x0000, 0, {0}},	/* 52 */
+    {0x0000, 0, {0}},	/* 53 */
+    {0x0000, 0, {0}},	/* 54 */
+    {0x0000, 0, {0}},	/* 55 */
+    {0x0000, 0, {0}},	/* 56 */
+    {0x0000, 0, {0}},	/* 57 */
+    {0x0000, 0, {0}},	/* 58 */
+    {0x0000, 0, {0}},	/* 59 */
+    {0x0000, 0, {0}},	/* 5A */
+    {0x0000, 0, {0}},	/* 5B */
+    {0x0000, 0, {0}},	/* 5C */
+    {0x0000, 0, {0}},	/* 5D */
+    {0x0000, 0, {0}},	/* 5E */
+    {0x0000, 0, {0}},	/* 5F */
+    {0x0000, 0, {0}},	/* 60 */
+    {0x0000, 0, {0}},	/* 61 */
+    {0x0000, 0, {0}},	/* 62 */
+    {0x0000, 0, {0}},	/* 63 */
+    {0x0000, 0, {0}},	/* 64 */
+    {0x0000, 0, {0}},	/* 65 */
+    {0x0000, 0, {0}},	/* 66 */
+    {0x0000, 0, {0}},	/* 67 */
+    {0x0000, 0, {0}},	/* 68 */
+    {0x0000, 0, {0}},	/* 69 */
+    {0x0000, 0, {0}},	/* 6A */
+    {0x0000, 0, {0}},	/* 6B */
+    {0x0000, 0, {0}},	/* 6C */
+    {0x0000, 0, {0}},	/* 6D */
+    {0x0000, 0, {0}},	/* 6E */
+    {0x0000, 0, {0}},	/* 6F */
+    {0x0000, 0, {0}},	/* 70 */
+    {0x0000, 0, {0}},	/* 71 */
+    {0x0000, 0, {0}},	/* 72 */
+    {0x0000, 0, {0}},	/* 73 */
+    {0x0000, 0, {0}},	/* 74 */
+    {0x0000, 0, {0}},	/* 75 */
+    {0x0000, 0, {0}},	/* 76 */
+    {0x0000, 0, {0}},	/* 77 */
+    {0x0000, 0, {0}},	/* 78 */
+    {0x0000, 0, {0}},	/* 79 */
+    {0x0000, 0, {0}},	/* 7A */
+    {0x0000, 0, {0}},	/* 7B */
+    {0x0000, 0, {0}},	/* 7C */
+    {0x0000, 0, {0}},	/* 7D */
+    {0x0000, 0, {0}},	/* 7E */
+    {0x0000, 0, {0}},	/* 7F */
+    {0x0000, 0, {0}},	/* 80 */
+    {0x0000, 0, {0}},	/* 81 */
+    {0x0000, 0, {0}},	/* 82 */
+    {0x0000, 0, {0}},	/* 83 */
+    {0x0000, 0, {0}},	/* 84 */
+    {0x0000, 0, {0}},	/* 85 */
+    {0x0000, 0, {0}},	/* 86 */
+    {0x0000, 0, {0}},	/* 87 */
+    {0x0000, 0, {0}},	/* 88 */
+    {0x0000, 0, {0}},	/* 89 */
+    {0x0000, 0, {0}},	/* 8A */
+    {0x0000, 0, {0}},	/* 8B */
+    {0x0000, 0, {0}},	/* 8C */
+    {0x0000, 0, {0}},	/* 8D */
+    {0x0000, 0, {0}},	/* 8E */
+    {0x0000, 0, {0}},	/* 8F */
+    {0x0000, 0, {0}},	/* 90 */
+    {0x0000, 0, {0}},	/* 91 */
+    {0x0000, 0, {0}},	/* 92 */
+    {0x0000, 0, {0}},	/* 93 */
+    {0x0000, 0, {0}},	/* 94 */
+    {0x0000, 0, {0}},	/* 95 */
+    {0x0000, 0, {0}},	/* 96 */
+    {0x0000, 0, {0}},	/* 97 */
+    {0x0000, 0, {0}},	/* 98 */
+    {0x0000, 0, {0}},	/* 99 */
+    {0x0000, 0, {0}},	/* 9A */
+    {0x0000, 0, {0}},	/* 9B */
+    {0x0000, 0, {0}},	/* 9C */
+    {0x0000, 0, {0}},	/* 9D */
+    {0x0000, 0, {0}},	/* 9E */
+    {0x0000, 0, {0}},	/* 9F */
+    {0x0000, 0, {0}},	/* A0 */
+    {0x0000, 0, {0}},	/* A1 */
+    {0x0000, 0, {0}},	/* A2 */
+    {0x0000, 0, {0}},	/* A3 */
+    {0x20ac, 3, {0xe2, 0x82, 0xac}},	/* A4 */
+    {0x0000, 0, {0}},	/* A5 */
+    {0x0160, 2, {0xc5, 0xa0}},	/* A6 */
+    {0x0000, 0, {0}},	/* A7 */
+    {0x0161, 2, {0xc5, 0xa1}},	/* A8 */
+    {0x0000, 0, {0}},	/* A9 */
+    {0x0000, 0, {0}},	/* AA */
+    {0x0000, 0, {0}},	/* AB */
+    {0x0000, 0, {0}},	/* AC */
+    {0x0000, 0, {0}},	/* AD */
+    {0x0000, 0, {0}},	/* AE */
+    {0x0000, 0, {0}},	/* AF */
+    {0x0000, 0, {0}},	/* B0 */
+    {0x0000, 0, {0}},	/* B1 */
+    {0x0000, 0, {0}},	/* B2 */
+    {0x0000, 0, {0}},	/* B3 */
+    {0x017d, 2, {0xc5, 0xbd}},	/* B4 */
+    {0x0000, 0, {0}},	/* B5 */
+    {0x0000, 0, {0}},	/* B6 */
+    {0x0000, 0, {0}},	/* B7 */
+    {0x017e, 2, {0xc5, 0xbe}},	/* B8 */
+    {0x0000, 0, {0}},	/* B9 */
+    {0x0000, 0, {0}},	/* BA */
+    {0x0000, 0, {0}},	/* BB */
+    {0x0152, 2, {0xc5, 0x92}},	/* BC */
+    {0x0153, 2, {0xc5, 0x93}},	/* BD */
+    {0x0178, 2, {0xc5, 0xb8}},	/* BE */
+    {0x0000, 0, {0}},	/* BF */
+    {0x0000, 0, {0}},	/* C0 */
+    {0x0000, 0, {0}},	/* C1 */
+    {0x0000, 0, {0}},	/* C2 */
+    {0x0000, 0, {0}},	/* C3 */
+    {0x0000, 0, {0}},	/* C4 */
+    {0x0000, 0, {0}},	/* C5 */
+    {0x0000, 0, {0}},	/* C6 */
+    {0x0000, 0, {0}},	/* C7 */
+    {0x0000, 0, {0}},	/* C8 */
+    {0x0000, 0, {0}},	/* C9 */
+    {0x0000, 0, {0}},	/* CA */
+    {0x0000, 0, {0}},	/* CB */
+    {0x0000, 0, {0}},	/* CC */
+    {0x0000, 0, {0}},	/* CD */
+    {0x0000, 0, {0}},	/* CE */
+    {0x0000, 0, {0}},	/* CF */
+    {0x0000, 0, {0}},	/* D0 */
+    {0x0000, 0, {0}},	/* D1 */
+    {0x0000, 0, {0}},	/* D2 */
+    {0x0000, 0, {0}},	/* D3 */
+    {0x0000, 0, {0}},	/* D4 */
+    {0x0000, 0, {0}},	/* D5 */
+    {0x0000, 0, {0}},	/* D6 */
+    {0x0000, 0, {0}},	/* D7 */
+    {0x0000, 0, {0}},	/* D8 */
+    {0x0000, 0, {0}},	/* D9 */
+    {0x0000, 0, {0}},	/* DA */
+    {0x0000, 0, {0}},	/* DB */
+    {0x0000, 0, {0}},	/* DC */
+    {0x0000, 0, {0}},	/* DD */
+    {0x0000, 0, {0}},	/* DE */
+    {0x0000, 0, {0}},	/* DF */
+    {0x0000, 0, {0}},	/* E0 */
+    {0x0000, 0, {0}},	/* E1 */
+    {0x0000, 0, {0}},	/* E2 */
+    {0x0000, 0, {0}},	/* E3 */
+    {0x0000, 0, {0}},	/* E4 */
+    {0x0000, 0, {0}},	/* E5 */
+    {0x0000, 0, {0}},	/* E6 */
+    {0x0000, 0, {0}},	/* E7 */
+    {0x0000, 0, {0}},	/* E8 */
+    {0x0000, 0, {0}},	/* E9 */
+    {0x0000, 0, {0}},	/* EA */
+    {0x0000, 0, {0}},	/* EB */
+    {0x0000, 0, {0}},	/* EC */
+    {0x0000, 0, {0}},	/* ED */
+    {0x0000, 0, {0}},	/* EE */
+    {0x0000, 0, {0}},	/* EF */
+    {0x0000, 0, {0}},	/* F0 */
+    {0x0000, 0, {0}},	/* F1 */
+    {0x0000, 0, {0}},	/* F2 */
+    {0x0000, 0, {0}},	/* F3 */
+    {0x0000, 0, {0}},	/* F4 */
+    {0x0000, 0, {0}},	/* F5 */
+    {0x0000, 0, {0}},	/* F6 */
+    {0x0000, 0, {0}},	/* F7 */
+    {0x0000, 0, {0}},	/* F8 */
+    {0x0000, 0, {0}},	/* F9 */
+    {0x0000, 0, {0}},	/* FA */
+    {0x0000, 0, {0}},	/* FB */
+    {0x0000, 0, {0}},	/* FC */
+    {0x0000, 0, {0}},	/* FD */
+    {0x0000, 0, {0}},	/* FE */
+    {0x0000, 0, {0}},	/* FF */
+};
+
+static const ReverseData iso8859_15_rev[] =
+{
+    {0x0152, 0xBC},
+    {0x0153, 0xBD},
+    {0x0160, 0xA6},
+    {0x0161, 0xA8},
+    {0x0178, 0xBE},
+    {0x017d, 0xB4},
+    {0x017e, 0xB8},
+    {0x20ac, 0xA4},
+};
+
 static const BuiltInMapping iso8859_2[] =
 {
     /* iso8859-2 */
@@ -274,6 +1775,327 @@ static const BuiltInMapping iso8859_2[] =
     {0x00FF, 0x02D9},
 };
 
+static const MappingData iso8859_2_utf8[] =
+{
+    {0x0000, 0, {0}},	/* 00 */
+    {0x0001, 0, {0}},	/* 01 */
+    {0x0002, 0, {0}},	/* 02 */
+    {0x0003, 0, {0}},	/* 03 */
+    {0x0004, 0, {0}},	/* 04 */
+    {0x0005, 0, {0}},	/* 05 */
+    {0x0006, 0, {0}},	/* 06 */
+    {0x0007, 0, {0}},	/* 07 */
+    {0x0008, 0, {0}},	/* 08 */
+    {0x0009, 0, {0}},	/* 09 */
+    {0x000a, 0, {0}},	/* 0A */
+    {0x000b, 0, {0}},	/* 0B */
+    {0x000c, 0, {0}},	/* 0C */
+    {0x000d, 0, {0}},	/* 0D */
+    {0x000e, 0, {0}},	/* 0E */
+    {0x000f, 0, {0}},	/* 0F */
+    {0x0010, 0, {0}},	/* 10 */
+    {0x0011, 0, {0}},	/* 11 */
+    {0x0012, 0, {0}},	/* 12 */
+    {0x0013, 0, {0}},	/* 13 */
+    {0x0014, 0, {0}},	/* 14 */
+    {0x0015, 0, {0}},	/* 15 */
+    {0x0016, 0, {0}},	/* 16 */
+    {0x0017, 0, {0}},	/* 17 */
+    {0x0018, 0, {0}},	/* 18 */
+    {0x0019, 0, {0}},	/* 19 */
+    {0x001a, 0, {0}},	/* 1A */
+    {0x001b, 0, {0}},	/* 1B */
+    {0x001c, 0, {0}},	/* 1C */
+    {0x001d, 0, {0}},	/* 1D */
+    {0x001e, 0, {0}},	/* 1E */
+    {0x001f, 0, {0}},	/* 1F */
+    {0x0020, 0, {0}},	/* 20 */
+    {0x0021, 0, {0}},	/* 21 */
+    {0x0022, 0, {0}},	/* 22 */
+    {0x0023, 0, {0}},	/* 23 */
+    {0x0024, 0, {0}},	/* 24 */
+    {0x0025, 0, {0}},	/* 25 */
+    {0x0026, 0, {0}},	/* 26 */
+    {0x0027, 0, {0}},	/* 27 */
+    {0x0028, 0, {0}},	/* 28 */
+    {0x0029, 0, {0}},	/* 29 */
+    {0x002a, 0, {0}},	/* 2A */
+    {0x002b, 0, {0}},	/* 2B */
+    {0x002c, 0, {0}},	/* 2C */
+    {0x002d, 0, {0}},	/* 2D */
+    {0x002e, 0, {0}},	/* 2E */
+    {0x002f, 0, {0}},	/* 2F */
+    {0x0030, 0, {0}},	/* 30 */
+    {0x0031, 0, {0}},	/* 31 */
+    {0x0032, 0, {0}},	/* 32 */
+    {0x0033, 0, {0}},	/* 33 */
+    {0x0034, 0, {0}},	/* 34 */
+    {0x0035, 0, {0}},	/* 35 */
+    {0x0036, 0, {0}},	/* 36 */
+    {0x0037, 0, {0}},	/* 37 */
+    {0x0038, 0, {0}},	/* 38 */
+    {0x0000, 0, {0}},	/* 39 */
+    {0x0000, 0, {0}},	/* 3A */
+    {0x0000, 0, {0}},	/* 3B */
+    {0x0000, 0, {0}},	/* 3C */
+    {0x0000, 0, {0}},	/* 3D */
+    {0x0000, 0, {0}},	/* 3E */
+    {0x0000, 0, {0}},	/* 3F */
+    {0x0000, 0, {0}},	/* 40 */
+    {0x0000, 0, {0}},	/* 41 */
+    {0x0000, 0, {0}},	/* 42 */
+    {0x0000, 0, {0}},	/* 43 */
+    {0x0000, 0, {0}},	/* 44 */
+    {0x0000, 0, {0}},	/* 45 */
+    {0x0000, 0, {0}},	/* 46 */
+    {0x0000, 0, {0}},	/* 47 */
+    {0x0000, 0, {0}},	/* 48 */
+    {0x0000, 0, {0}},	/* 49 */
+    {0x0000, 0, {0}},	/* 4A */
+    {0x0000, 0, {0}},	/* 4B */
+    {0x0000, 0, {0}},	/* 4C */
+    {0x0000, 0, {0}},	/* 4D */
+    {0x0000, 0, {0}},	/* 4E */
+    {0x0000, 0, {0}},	/* 4F */
+    {0x0000, 0, {0}},	/* 50 */
+    {0x0000, 0, {0}},	/* 51 */
+    {0x0000, 0, {0}},	/* 52 */
+    {0x0000, 0, {0}},	/* 53 */
+    {0x0000, 0, {0}},	/* 54 */
+    {0x0000, 0, {0}},	/* 55 */
+    {0x0000, 0, {0}},	/* 56 */
+    {0x0000, 0, {0}},	/* 57 */
+    {0x0000, 0, {0}},	/* 58 */
+    {0x0000, 0, {0}},	/* 59 */
+    {0x0000, 0, {0}},	/* 5A */
+    {0x0000, 0, {0}},	/* 5B */
+    {0x0000, 0, {0}},	/* 5C */
+    {0x0000, 0, {0}},	/* 5D */
+    {0x0000, 0, {0}},	/* 5E */
+    {0x0000, 0, {0}},	/* 5F */
+    {0x0000, 0, {0}},	/* 60 */
+    {0x0000, 0, {0}},	/* 61 */
+    {0x0000, 0, {0}},	/* 62 */
+    {0x0000, 0, {0}},	/* 63 */
+    {0x0000, 0, {0}},	/* 64 */
+    {0x0000, 0, {0}},	/* 65 */
+    {0x0000, 0, {0}},	/* 66 */
+    {0x0000, 0, {0}},	/* 67 */
+    {0x0000, 0, {0}},	/* 68 */
+    {0x0000, 0, {0}},	/* 69 */
+    {0x0000, 0, {0}},	/* 6A */
+    {0x0000, 0, {0}},	/* 6B */
+    {0x0000, 0, {0}},	/* 6C */
+    {0x0000, 0, {0}},	/* 6D */
+    {0x0000, 0, {0}},	/* 6E */
+    {0x0000, 0, {0}},	/* 6F */
+    {0x0000, 0, {0}},	/* 70 */
+    {0x0000, 0, {0}},	/* 71 */
+    {0x0000, 0, {0}},	/* 72 */
+    {0x0000, 0, {0}},	/* 73 */
+    {0x0000, 0, {0}},	/* 74 */
+    {0x0000, 0, {0}},	/* 75 */
+    {0x0000, 0, {0}},	/* 76 */
+    {0x0000, 0, {0}},	/* 77 */
+    {0x0000, 0, {0}},	/* 78 */
+    {0x0000, 0, {0}},	/* 79 */
+    {0x0000, 0, {0}},	/* 7A */
+    {0x0000, 0, {0}},	/* 7B */
+    {0x0000, 0, {0}},	/* 7C */
+    {0x0000, 0, {0}},	/* 7D */
+    {0x0000, 0, {0}},	/* 7E */
+    {0x0000, 0, {0}},	/* 7F */
+    {0x0000, 0, {0}},	/* 80 */
+    {0x0000, 0, {0}},	/* 81 */
+    {0x0000, 0, {0}},	/* 82 */
+    {0x0000, 0, {0}},	/* 83 */
+    {0x0000, 0, {0}},	/* 84 */
+    {0x0000, 0, {0}},	/* 85 */
+    {0x0000, 0, {0}},	/* 86 */
+    {0x0000, 0, {0}},	/* 87 */
+    {0x0000, 0, {0}},	/* 88 */
+    {0x0000, 0, {0}},	/* 89 */
+    {0x0000, 0, {0}},	/* 8A */
+    {0x0000, 0, {0}},	/* 8B */
+    {0x0000, 0, {0}},	/* 8C */
+    {0x0000, 0, {0}},	/* 8D */
+    {0x0000, 0, {0}},	/* 8E */
+    {0x0000, 0, {0}},	/* 8F */
+    {0x0000, 0, {0}},	/* 90 */
+    {0x0000, 0, {0}},	/* 91 */
+    {0x0000, 0, {0}},	/* 92 */
+    {0x0000, 0, {0}},	/* 93 */
+    {0x0000, 0, {0}},	/* 94 */
+    {0x0000, 0, {0}},	/* 95 */
+    {0x0000, 0, {0}},	/* 96 */
+    {0x0000, 0, {0}},	/* 97 */
+    {0x0000, 0, {0}},	/* 98 */
+    {0x0000, 0, {0}},	/* 99 */
+    {0x0000, 0, {0}},	/* 9A */
+    {0x0000, 0, {0}},	/* 9B */
+    {0x0000, 0, {0}},	/* 9C */
+    {0x0000, 0, {0}},	/* 9D */
+    {0x0000, 0, {0}},	/* 9E */
+    {0x0000, 0, {0}},	/* 9F */
+    {0x0000, 0, {0}},	/* A0 */
+    {0x0104, 2, {0xc4, 0x84}},	/* A1 */
+    {0x02d8, 2, {0xcb, 0x98}},	/* A2 */
+    {0x0141, 2, {0xc5, 0x81}},	/* A3 */
+    {0x0000, 0, {0}},	/* A4 */
+    {0x013d, 2, {0xc4, 0xbd}},	/* A5 */
+    {0x015a, 2, {0xc5, 0x9a}},	/* A6 */
+    {0x0000, 0, {0}},	/* A7 */
+    {0x0000, 0, {0}},	/* A8 */
+    {0x0160, 2, {0xc5, 0xa0}},	/* A9 */
+    {0x015e, 2, {0xc5, 0x9e}},	/* AA */
+    {0x0164, 2, {0xc5, 0xa4}},	/* AB */
+    {0x0179, 2, {0xc5, 0xb9}},	/* AC */
+    {0x0000, 0, {0}},	/* AD */
+    {0x017d, 2, {0xc5, 0xbd}},	/* AE */
+    {0x017b, 2, {0xc5, 0xbb}},	/* AF */
+    {0x0000, 0, {0}},	/* B0 */
+    {0x0105, 2, {0xc4, 0x85}},	/* B1 */
+    {0x02db, 2, {0xcb, 0x9b}},	/* B2 */
+    {0x0142, 2, {0xc5, 0x82}},	/* B3 */
+    {0x0000, 0, {0}},	/* B4 */
+    {0x013e, 2, {0xc4, 0xbe}},	/* B5 */
+    {0x015b, 2, {0xc5, 0x9b}},	/* B6 */
+    {0x02c7, 2, {0xcb, 0x87}},	/* B7 */
+    {0x0000, 0, {0}},	/* B8 */
+    {0x0161, 2, {0xc5, 0xa1}},	/* B9 */
+    {0x015f, 2, {0xc5, 0x9f}},	/* BA */
+    {0x0165, 2, {0xc5, 0xa5}},	/* BB */
+    {0x017a, 2, {0xc5, 0xba}},	/* BC */
+    {0x02dd, 2, {0xcb, 0x9d}},	/* BD */
+    {0x017e, 2, {0xc5, 0xbe}},	/* BE */
+    {0x017c, 2, {0xc5, 0xbc}},	/* BF */
+    {0x0154, 2, {0xc5, 0x94}},	/* C0 */
+    {0x0000, 0, {0}},	/* C1 */
+    {0x0000, 0, {0}},	/* C2 */
+    {0x0102, 2, {0xc4, 0x82}},	/* C3 */
+    {0x0000, 0, {0}},	/* C4 */
+    {0x0139, 2, {0xc4, 0xb9}},	/* C5 */
+    {0x0106, 2, {0xc4, 0x86}},	/* C6 */
+    {0x0000, 0, {0}},	/* C7 */
+    {0x010c, 2, {0xc4, 0x8c}},	/* C8 */
+    {0x0000, 0, {0}},	/* C9 */
+    {0x0118, 2, {0xc4, 0x98}},	/* CA */
+    {0x0000, 0, {0}},	/* CB */
+    {0x011a, 2, {0xc4, 0x9a}},	/* CC */
+    {0x0000, 0, {0}},	/* CD */
+    {0x0000, 0, {0}},	/* CE */
+    {0x010e, 2, {0xc4, 0x8e}},	/* CF */
+    {0x0110, 2, {0xc4, 0x90}},	/* D0 */
+    {0x0143, 2, {0xc5, 0x83}},	/* D1 */
+    {0x0147, 2, {0xc5, 0x87}},	/* D2 */
+    {0x0000, 0, {0}},	/* D3 */
+    {0x0000, 0, {0}},	/* D4 */
+    {0x0150, 2, {0xc5, 0x90}},	/* D5 */
+    {0x0000, 0, {0}},	/* D6 */
+    {0x0000, 0, {0}},	/* D7 */
+    {0x0158, 2, {0xc5, 0x98}},	/* D8 */
+    {0x016e, 2, {0xc5, 0xae}},	/* D9 */
+    {0x0000, 0, {0}},	/* DA */
+    {0x0170, 2, {0xc5, 0xb0}},	/* DB */
+    {0x0000, 0, {0}},	/* DC */
+    {0x0000, 0, {0}},	/* DD */
+    {0x0162, 2, {0xc5, 0xa2}},	/* DE */
+    {0x0000, 0, {0}},	/* DF */
+    {0x0155, 2, {0xc5, 0x95}},	/* E0 */
+    {0x0000, 0, {0}},	/* E1 */
+    {0x0000, 0, {0}},	/* E2 */
+    {0x0103, 2, {0xc4, 0x83}},	/* E3 */
+    {0x0000, 0, {0}},	/* E4 */
+    {0x013a, 2, {0xc4, 0xba}},	/* E5 */
+    {0x0107, 2, {0xc4, 0x87}},	/* E6 */
+    {0x0000, 0, {0}},	/* E7 */
+    {0x010d, 2, {0xc4, 0x8d}},	/* E8 */
+    {0x0000, 0, {0}},	/* E9 */
+    {0x0119, 2, {0xc4, 0x99}},	/* EA */
+    {0x0000, 0, {0}},	/* EB */
+    {0x011b, 2, {0xc4, 0x9b}},	/* EC */
+    {0x0000, 0, {0}},	/* ED */
+    {0x0000, 0, {0}},	/* EE */
+    {0x010f, 2, {0xc4, 0x8f}},	/* EF */
+    {0x0111, 2, {0xc4, 0x91}},	/* F0 */
+    {0x0144, 2, {0xc5, 0x84}},	/* F1 */
+    {0x0148, 2, {0xc5, 0x88}},	/* F2 */
+    {0x0000, 0, {0}},	/* F3 */
+    {0x0000, 0, {0}},	/* F4 */
+    {0x0151, 2, {0xc5, 0x91}},	/* F5 */
+    {0x0000, 0, {0}},	/* F6 */
+    {0x0000, 0, {0}},	/* F7 */
+    {0x0159, 2, {0xc5, 0x99}},	/* F8 */
+    {0x016f, 2, {0xc5, 0xaf}},	/* F9 */
+    {0x0000, 0, {0}},	/* FA */
+    {0x0171, 2, {0xc5, 0xb1}},	/* FB */
+    {0x0000, 0, {0}},	/* FC */
+    {0x0000, 0, {0}},	/* FD */
+    {0x0163, 2, {0xc5, 0xa3}},	/* FE */
+    {0x02d9, 2, {0xcb, 0x99}},	/* FF */
+};
+
+static const ReverseData iso8859_2_rev[] =
+{
+    {0x0102, 0xC3},
+    {0x0103, 0xE3},
+    {0x0104, 0xA1},
+    {0x0105, 0xB1},
+    {0x0106, 0xC6},
+    {0x0107, 0xE6},
+    {0x010c, 0xC8},
+    {0x010d, 0xE8},
+    {0x010e, 0xCF},
+    {0x010f, 0xEF},
+    {0x0110, 0xD0},
+    {0x0111, 0xF0},
+    {0x0118, 0xCA},
+    {0x0119, 0xEA},
+    {0x011a, 0xCC},
+    {0x011b, 0xEC},
+    {0x0139, 0xC5},
+    {0x013a, 0xE5},
+    {0x013d, 0xA5},
+    {0x013e, 0xB5},
+    {0x0141, 0xA3},
+    {0x0142, 0xB3},
+    {0x0143, 0xD1},
+    {0x0144, 0xF1},
+    {0x0147, 0xD2},
+    {0x0148, 0xF2},
+    {0x0150, 0xD5},
+    {0x0151, 0xF5},
+    {0x0154, 0xC0},
+    {0x0155, 0xE0},
+    {0x0158, 0xD8},
+    {0x0159, 0xF8},
+    {0x015a, 0xA6},
+    {0x015b, 0xB6},
+    {0x015e, 0xAA},
+    {0x015f, 0xBA},
+    {0x0160, 0xA9},
+    {0x0161, 0xB9},
+    {0x0162, 0xDE},
+    {0x0163, 0xFE},
+    {0x0164, 0xAB},
+    {0x0165, 0xBB},
+    {0x016e, 0xD9},
+    {0x016f, 0xF9},
+    {0x0170, 0xDB},
+    {0x0171, 0xFB},
+    {0x0179, 0xAC},
+    {0x017a, 0xBC},
+    {0x017b, 0xAF},
+    {0x017c, 0xBF},
+    {0x017d, 0xAE},
+    {0x017e, 0xBE},
+    {0x02c7, 0xB7},
+    {0x02d8, 0xA2},
+    {0x02d9, 0xFF},
+    {0x02db, 0xB2},
+    {0x02dd, 0xBD},
+};
+
 static const BuiltInMapping iso8859_3[] =
 {
     /* iso8859-3 */
@@ -307,6 +2129,298 @@ static const BuiltInMapping iso8859_3[] =
     {0x00FF, 0x02D9},
 };
 
+static const MappingData iso8859_3_utf8[] =
+{
+    {0x0000, 0, {0}},	/* 00 */
+    {0x0001, 0, {0}},	/* 01 */
+    {0x0002, 0, {0}},	/* 02 */
+    {0x0003, 0, {0}},	/* 03 */
+    {0x0004, 0, {0}},	/* 04 */
+    {0x0005, 0, {0}},	/* 05 */
+    {0x0006, 0, {0}},	/* 06 */
+    {0x0007, 0, {0}},	/* 07 */
+    {0x0008, 0, {0}},	/* 08 */
+    {0x0009, 0, {0}},	/* 09 */
+    {0x000a, 0, {0}},	/* 0A */
+    {0x000b, 0, {0}},	/* 0B */
+    {0x000c, 0, {0}},	/* 0C */
+    {0x000d, 0, {0}},	/* 0D */
+    {0x000e, 0, {0}},	/* 0E */
+    {0x000f, 0, {0}},	/* 0F */
+    {0x0010, 0, {0}},	/* 10 */
+    {0x0011, 0, {0}},	/* 11 */
+    {0x0012, 0, {0}},	/* 12 */
+    {0x0013, 0, {0}},	/* 13 */
+    {0x0014, 0, {0}},	/* 14 */
+    {0x0015, 0, {0}},	/* 15 */
+    {0x0016, 0, {0}},	/* 16 */
+    {0x0017, 0, {0}},	/* 17 */
+    {0x0018, 0, {0}},	/* 18 */
+    {0x0019, 0, {0}},	/* 19 */
+    {0x001a, 0, {0}},	/* 1A */
+    {0x001b, 0, {0}},	/* 1B */
+    {0x0000, 0, {0}},	/* 1C */
+    {0x0000, 0, {0}},	/* 1D */
+    {0x0000, 0, {0}},	/* 1E */
+    {0x0000, 0, {0}},	/* 1F */
+    {0x0000, 0, {0}},	/* 20 */
+    {0x0000, 0, {0}},	/* 21 */
+    {0x0000, 0, {0}},	/* 22 */
+    {0x0000, 0, {0}},	/* 23 */
+    {0x0000, 0, {0}},	/* 24 */
+    {0x0000, 0, {0}},	/* 25 */
+    {0x0000, 0, {0}},	/* 26 */
+    {0x0000, 0, {0}},	/* 27 */
+    {0x0000, 0, {0}},	/* 28 */
+    {0x0000, 0, {0}},	/* 29 */
+    {0x0000, 0, {0}},	/* 2A */
+    {0x0000, 0, {0}},	/* 2B */
+    {0x0000, 0, {0}},	/* 2C */
+    {0x0000, 0, {0}},	/* 2D */
+    {0x0000, 0, {0}},	/* 2E */
+    {0x0000, 0, {0}},	/* 2F */
+    {0x0000, 0, {0}},	/* 30 */
+    {0x0000, 0, {0}},	/* 31 */
+    {0x0000, 0, {0}},	/* 32 */
+    {0x0000, 0, {0}},	/* 33 */
+    {0x0000, 0, {0}},	/* 34 */
+    {0x0000, 0, {0}},	/* 35 */
+    {0x0000, 0, {0}},	/* 36 */
+    {0x0000, 0, {0}},	/* 37 */
+    {0x0000, 0, {0}},	/* 38 */
+    {0x0000, 0, {0}},	/* 39 */
+    {0x0000, 0, {0}},	/* 3A */
+    {0x0000, 0, {0}},	/* 3B */
+    {0x0000, 0, {0}},	/* 3C */
+    {0x0000, 0, {0}},	/* 3D */
+    {0x0000, 0, {0}},	/* 3E */
+    {0x0000, 0, {0}},	/* 3F */
+    {0x0000, 0, {0}},	/* 40 */
+    {0x0000, 0, {0}},	/* 41 */
+    {0x0000, 0, {0}},	/* 42 */
+    {0x0000, 0, {0}},	/* 43 */
+    {0x0000, 0, {0}},	/* 44 */
+    {0x0000, 0, {0}},	/* 45 */
+    {0x0000, 0, {0}},	/* 46 */
+    {0x0000, 0, {0}},	/* 47 */
+    {0x0000, 0, {0}},	/* 48 */
+    {0x0000, 0, {0}},	/* 49 */
+    {0x0000, 0, {0}},	/* 4A */
+    {0x0000, 0, {0}},	/* 4B */
+    {0x0000, 0, {0}},	/* 4C */
+    {0x0000, 0, {0}},	/* 4D */
+    {0x0000, 0, {0}},	/* 4E */
+    {0x0000, 0, {0}},	/* 4F */
+    {0x0000, 0, {0}},	/* 50 */
+    {0x0000, 0, {0}},	/* 51 */
+    {0x0000, 0, {0}},	/* 52 */
+    {0x0000, 0, {0}},	/* 53 */
+    {0x0000, 0, {0}},	/* 54 */
+    {0x0000, 0, {0}},	/* 55 */
+    {0x0000, 0, {0}},	/* 56 */
+    {0x0000, 0, {0}},	/* 57 */
+    {0x0000, 0, {0}},	/* 58 */
+    {0x0000, 0, {0}},	/* 59 */
+    {0x0000, 0, {0}},	/* 5A */
+    {0x0000, 0, {0}},	/* 5B */
+    {0x0000, 0, {0}},	/* 5C */
+    {0x0000, 0, {0}},	/* 5D */
+    {0x0000, 0, {0}},	/* 5E */
+    {0x0000, 0, {0}},	/* 5F */
+    {0x0000, 0, {0}},	/* 60 */
+    {0x0000, 0, {0}},	/* 61 */
+    {0x0000, 0, {0}},	/* 62 */
+    {0x0000, 0, {0}},	/* 63 */
+    {0x0000, 0, {0}},	/* 64 */
+    {0x0000, 0, {0}},	/* 65 */
+    {0x0000, 0, {0}},	/* 66 */
+    {0x0000, 0, {0}},	/* 67 */
+    {0x0000, 0, {0}},	/* 68 */
+    {0x0000, 0, {0}},	/* 69 */
+    {0x0000, 0, {0}},	/* 6A */
+    {0x0000, 0, {0}},	/* 6B */
+    {0x0000, 0, {0}},	/* 6C */
+    {0x0000, 0, {0}},	/* 6D */
+    {0x0000, 0, {0}},	/* 6E */
+    {0x0000, 0, {0}},	/* 6F */
+    {0x0000, 0, {0}},	/* 70 */
+    {0x0000, 0, {0}},	/* 71 */
+    {0x0000, 0, {0}},	/* 72 */
+    {0x0000, 0, {0}},	/* 73 */
+    {0x0000, 0, {0}},	/* 74 */
+    {0x0000, 0, {0}},	/* 75 */
+    {0x0000, 0, {0}},	/* 76 */
+    {0x0000, 0, {0}},	/* 77 */
+    {0x0000, 0, {0}},	/* 78 */
+    {0x0000, 0, {0}},	/* 79 */
+    {0x0000, 0, {0}},	/* 7A */
+    {0x0000, 0, {0}},	/* 7B */
+    {0x0000, 0, {0}},	/* 7C */
+    {0x0000, 0, {0}},	/* 7D */
+    {0x0000, 0, {0}},	/* 7E */
+    {0x0000, 0, {0}},	/* 7F */
+    {0x0000, 0, {0}},	/* 80 */
+    {0x0000, 0, {0}},	/* 81 */
+    {0x0000, 0, {0}},	/* 82 */
+    {0x0000, 0, {0}},	/* 83 */
+    {0x0000, 0, {0}},	/* 84 */
+    {0x0000, 0, {0}},	/* 85 */
+    {0x0000, 0, {0}},	/* 86 */
+    {0x0000, 0, {0}},	/* 87 */
+    {0x0000, 0, {0}},	/* 88 */
+    {0x0000, 0, {0}},	/* 89 */
+    {0x0000, 0, {0}},	/* 8A */
+    {0x0000, 0, {0}},	/* 8B */
+    {0x0000, 0, {0}},	/* 8C */
+    {0x0000, 0, {0}},	/* 8D */
+    {0x0000, 0, {0}},	/* 8E */
+    {0x0000, 0, {0}},	/* 8F */
+    {0x0000, 0, {0}},	/* 90 */
+    {0x0000, 0, {0}},	/* 91 */
+    {0x0000, 0, {0}},	/* 92 */
+    {0x0000, 0, {0}},	/* 93 */
+    {0x0000, 0, {0}},	/* 94 */
+    {0x0000, 0, {0}},	/* 95 */
+    {0x0000, 0, {0}},	/* 96 */
+    {0x0000, 0, {0}},	/* 97 */
+    {0x0000, 0, {0}},	/* 98 */
+    {0x0000, 0, {0}},	/* 99 */
+    {0x0000, 0, {0}},	/* 9A */
+    {0x0000, 0, {0}},	/* 9B */
+    {0x0000, 0, {0}},	/* 9C */
+    {0x0000, 0, {0}},	/* 9D */
+    {0x0000, 0, {0}},	/* 9E */
+    {0x0000, 0, {0}},	/* 9F */
+    {0x0000, 0, {0}},	/* A0 */
+    {0x0126, 2, {0xc4, 0xa6}},	/* A1 */
+    {0x02d8, 2, {0xcb, 0x98}},	/* A2 */
+    {0x0000, 0, {0}},	/* A3 */
+    {0x0000, 0, {0}},	/* A4 */
+    {0x0000, 0, {0}},	/* A5 */
+    {0x0124, 2, {0xc4, 0xa4}},	/* A6 */
+    {0x0000, 0, {0}},	/* A7 */
+    {0x0000, 0, {0}},	/* A8 */
+    {0x0130, 2, {0xc4, 0xb0}},	/* A9 */
+    {0x015e, 2, {0xc5, 0x9e}},	/* AA */
+    {0x011e, 2, {0xc4, 0x9e}},	/* AB */
+    {0x0134, 2, {0xc4, 0xb4}},	/* AC */
+    {0x0000, 0, {0}},	/* AD */
+    {0x0000, 0, {0}},	/* AE */
+    {0x017b, 2, {0xc5, 0xbb}},	/* AF */
+    {0x0000, 0, {0}},	/* B0 */
+    {0x0127, 2, {0xc4, 0xa7}},	/* B1 */
+    {0x0000, 0, {0}},	/* B2 */
+    {0x0000, 0, {0}},	/* B3 */
+    {0x0000, 0, {0}},	/* B4 */
+    {0x0000, 0, {0}},	/* B5 */
+    {0x0125, 2, {0xc4, 0xa5}},	/* B6 */
+    {0x0000, 0, {0}},	/* B7 */
+    {0x0000, 0, {0}},	/* B8 */
+    {0x0131, 2, {0xc4, 0xb1}},	/* B9 */
+    {0x015f, 2, {0xc5, 0x9f}},	/* BA */
+    {0x011f, 2, {0xc4, 0x9f}},	/* BB */
+    {0x0135, 2, {0xc4, 0xb5}},	/* BC */
+    {0x0000, 0, {0}},	/* BD */
+    {0x0000, 0, {0}},	/* BE */
+    {0x017c, 2, {0xc5, 0xbc}},	/* BF */
+    {0x0000, 0, {0}},	/* C0 */
+    {0x0000, 0, {0}},	/* C1 */
+    {0x0000, 0, {0}},	/* C2 */
+    {0x0000, 0, {0}},	/* C3 */
+    {0x0000, 0, {0}},	/* C4 */
+    {0x010a, 2, {0xc4, 0x8a}},	/* C5 */
+    {0x0108, 2, {0xc4, 0x88}},	/* C6 */
+    {0x0000, 0, {0}},	/* C7 */
+    {0x0000, 0, {0}},	/* C8 */
+    {0x0000, 0, {0}},	/* C9 */
+    {0x0000, 0, {0}},	/* CA */
+    {0x0000, 0, {0}},	/* CB */
+    {0x0000, 0, {0}},	/* CC */
+    {0x0000, 0, {0}},	/* CD */
+    {0x0000, 0, {0}},	/* CE */
+    {0x0000, 0, {0}},	/* CF */
+    {0x0000, 0, {0}},	/* D0 */
+    {0x0000, 0, {0}},	/* D1 */
+    {0x0000, 0, {0}},	/* D2 */
+    {0x0000, 0, {0}},	/* D3 */
+    {0x0000, 0, {0}},	/* D4 */
+    {0x0120, 2, {0xc4, 0xa0}},	/* D5 */
+    {0x0000, 0, {0}},	/* D6 */
+    {0x0000, 0, {0}},	/* D7 */
+    {0x011c, 2, {0xc4, 0x9c}},	/* D8 */
+    {0x0000, 0, {0}},	/* D9 */
+    {0x0000, 0, {0}},	/* DA */
+    {0x0000, 0, {0}},	/* DB */
+    {0x0000, 0, {0}},	/* DC */
+    {0x016c, 2, {0xc5, 0xac}},	/* DD */
+    {0x015c, 2, {0xc5, 0x9c}},	/* DE */
+    {0x0000, 0, {0}},	/* DF */
+    {0x0000, 0, {0}},	/* E0 */
+    {0x0000, 0, {0}},	/* E1 */
+    {0x0000, 0, {0}},	/* E2 */
+    {0x0000, 0, {0}},	/* E3 */
+    {0x0000, 0, {0}},	/* E4 */
+    {0x010b, 2, {0xc4, 0x8b}},	/* E5 */
+    {0x0109, 2, {0xc4, 0x89}},	/* E6 */
+    {0x0000, 0, {0}},	/* E7 */
+    {0x0000, 0, {0}},	/* E8 */
+    {0x0000, 0, {0}},	/* E9 */
+    {0x0000, 0, {0}},	/* EA */
+    {0x0000, 0, {0}},	/* EB */
+    {0x0000, 0, {0}},	/* EC */
+    {0x0000, 0, {0}},	/* ED */
+    {0x0000, 0, {0}},	/* EE */
+    {0x0000, 0, {0}},	/* EF */
+    {0x0000, 0, {0}},	/* F0 */
+    {0x0000, 0, {0}},	/* F1 */
+    {0x0000, 0, {0}},	/* F2 */
+    {0x0000, 0, {0}},	/* F3 */
+    {0x0000, 0, {0}},	/* F4 */
+    {0x0121, 2, {0xc4, 0xa1}},	/* F5 */
+    {0x0000, 0, {0}},	/* F6 */
+    {0x0000, 0, {0}},	/* F7 */
+    {0x011d, 2, {0xc4, 0x9d}},	/* F8 */
+    {0x0000, 0, {0}},	/* F9 */
+    {0x0000, 0, {0}},	/* FA */
+    {0x0000, 0, {0}},	/* FB */
+    {0x0000, 0, {0}},	/* FC */
+    {0x016d, 2, {0xc5, 0xad}},	/* FD */
+    {0x015d, 2, {0xc5, 0x9d}},	/* FE */
+    {0x02d9, 2, {0xcb, 0x99}},	/* FF */
+};
+
+static const ReverseData iso8859_3_rev[] =
+{
+    {0x0108, 0xC6},
+    {0x0109, 0xE6},
+    {0x010a, 0xC5},
+    {0x010b, 0xE5},
+    {0x011c, 0xD8},
+    {0x011d, 0xF8},
+    {0x011e, 0xAB},
+    {0x011f, 0xBB},
+    {0x0120, 0xD5},
+    {0x0121, 0xF5},
+    {0x0124, 0xA6},
+    {0x0125, 0xB6},
+    {0x0126, 0xA1},
+    {0x0127, 0xB1},
+    {0x0130, 0xA9},
+    {0x0131, 0xB9},
+    {0x0134, 0xAC},
+    {0x0135, 0xBC},
+    {0x015c, 0xDE},
+    {0x015d, 0xFE},
+    {0x015e, 0xAA},
+    {0x015f, 0xBA},
+    {0x016c, 0xDD},
+    {0x016d, 0xFD},
+    {0x017b, 0xAF},
+    {0x017c, 0xBF},
+    {0x02d8, 0xA2},
+    {0x02d9, 0xFF},
+};
+
 static const BuiltInMapping iso8859_4[] =
 {
     /* iso8859-4 */
@@ -362,6 +2476,320 @@ static const BuiltInMapping iso8859_4[] =
     {0x00FF, 0x02D9},
 };
 
+static const MappingData iso8859_4_utf8[] =
+{
+    {0x0000, 0, {0}},	/* 00 */
+    {0x0001, 0, {0}},	/* 01 */
+    {0x0002, 0, {0}},	/* 02 */
+    {0x0003, 0, {0}},	/* 03 */
+    {0x0004, 0, {0}},	/* 04 */
+    {0x0005, 0, {0}},	/* 05 */
+    {0x0006, 0, {0}},	/* 06 */
+    {0x0007, 0, {0}},	/* 07 */
+    {0x0008, 0, {0}},	/* 08 */
+    {0x0009, 0, {0}},	/* 09 */
+    {0x000a, 0, {0}},	/* 0A */
+    {0x000b, 0, {0}},	/* 0B */
+    {0x000c, 0, {0}},	/* 0C */
+    {0x000d, 0, {0}},	/* 0D */
+    {0x000e, 0, {0}},	/* 0E */
+    {0x000f, 0, {0}},	/* 0F */
+    {0x0010, 0, {0}},	/* 10 */
+    {0x0011, 0, {0}},	/* 11 */
+    {0x0012, 0, {0}},	/* 12 */
+    {0x0013, 0, {0}},	/* 13 */
+    {0x0014, 0, {0}},	/* 14 */
+    {0x0015, 0, {0}},	/* 15 */
+    {0x0016, 0, {0}},	/* 16 */
+    {0x0017, 0, {0}},	/* 17 */
+    {0x0018, 0, {0}},	/* 18 */
+    {0x0019, 0, {0}},	/* 19 */
+    {0x001a, 0, {0}},	/* 1A */
+    {0x001b, 0, {0}},	/* 1B */
+    {0x001c, 0, {0}},	/* 1C */
+    {0x001d, 0, {0}},	/* 1D */
+    {0x001e, 0, {0}},	/* 1E */
+    {0x001f, 0, {0}},	/* 1F */
+    {0x0020, 0, {0}},	/* 20 */
+    {0x0021, 0, {0}},	/* 21 */
+    {0x0022, 0, {0}},	/* 22 */
+    {0x0023, 0, {0}},	/* 23 */
+    {0x0024, 0, {0}},	/* 24 */
+    {0x0025, 0, {0}},	/* 25 */
+    {0x0026, 0, {0}},	/* 26 */
+    {0x0027, 0, {0}},	/* 27 */
+    {0x0028, 0, {0}},	/* 28 */
+    {0x0029, 0, {0}},	/* 29 */
+    {0x002a, 0, {0}},	/* 2A */
+    {0x002b, 0, {0}},	/* 2B */
+    {0x002c, 0, {0}},	/* 2C */
+    {0x002d, 0, {0}},	/* 2D */
+    {0x002e, 0, {0}},	/* 2E */
+    {0x002f, 0, {0}},	/* 2F */
+    {0x0030, 0, {0}},	/* 30 */
+    {0x0031, 0, {0}},	/* 31 */
+    {0x0000, 0, {0}},	/* 32 */
+    {0x0000, 0, {0}},	/* 33 */
+    {0x0000, 0, {0}},	/* 34 */
+    {0x0000, 0, {0}},	/* 35 */
+    {0x0000, 0, {0}},	/* 36 */
+    {0x0000, 0, {0}},	/* 37 */
+    {0x0000, 0, {0}},	/* 38 */
+    {0x0000, 0, {0}},	/* 39 */
+    {0x0000, 0, {0}},	/* 3A */
+    {0x0000, 0, {0}},	/* 3B */
+    {0x0000, 0, {0}},	/* 3C */
+    {0x0000, 0, {0}},	/* 3D */
+    {0x0000, 0, {0}},	/* 3E */
+    {0x0000, 0, {0}},	/* 3F */
+    {0x0000, 0, {0}},	/* 40 */
+    {0x0000, 0, {0}},	/* 41 */
+    {0x0000, 0, {0}},	/* 42 */
+    {0x0000, 0, {0}},	/* 43 */
+    {0x0000, 0, {0}},	/* 44 */
+    {0x0000, 0, {0}},	/* 45 */
+    {0x0000, 0, {0}},	/* 46 */
+    {0x0000, 0, {0}},	/* 47 */
+    {0x0000, 0, {0}},	/* 48 */
+    {0x0000, 0, {0}},	/* 49 */
+    {0x0000, 0, {0}},	/* 4A */
+    {0x0000, 0, {0}},	/* 4B */
+    {0x0000, 0, {0}},	/* 4C */
+    {0x0000, 0, {0}},	/* 4D */
+    {0x0000, 0, {0}},	/* 4E */
+    {0x0000, 0, {0}},	/* 4F */
+    {0x0000, 0, {0}},	/* 50 */
+    {0x0000, 0, {0}},	/* 51 */
+    {0x0000, 0, {0}},	/* 52 */
+    {0x0000, 0, {0}},	/* 53 */
+    {0x0000, 0, {0}},	/* 54 */
+    {0x0000, 0, {0}},	/* 55 */
+    {0x0000, 0, {0}},	/* 56 */
+    {0x0000, 0, {0}},	/* 57 */
+    {0x0000, 0, {0}},	/* 58 */
+    {0x0000, 0, {0}},	/* 59 */
+    {0x0000, 0, {0}},	/* 5A */
+    {0x0000, 0, {0}},	/* 5B */
+    {0x0000, 0, {0}},	/* 5C */
+    {0x0000, 0, {0}},	/* 5D */
+    {0x0000, 0, {0}},	/* 5E */
+    {0x0000, 0, {0}},	/* 5F */
+    {0x0000, 0, {0}},	/* 60 */
+    {0x0000, 0, {0}},	/* 61 */
+    {0x0000, 0, {0}},	/* 62 */
+    {0x0000, 0, {0}},	/* 63 */
+    {0x0000, 0, {0}},	/* 64 */
+    {0x0000, 0, {0}},	/* 65 */
+    {0x0000, 0, {0}},	/* 66 */
+    {0x0000, 0, {0}},	/* 67 */
+    {0x0000, 0, {0}},	/* 68 */
+    {0x0000, 0, {0}},	/* 69 */
+    {0x0000, 0, {0}},	/* 6A */
+    {0x0000, 0, {0}},	/* 6B */
+    {0x0000, 0, {0}},	/* 6C */
+    {0x0000, 0, {0}},	/* 6D */
+    {0x0000, 0, {0}},	/* 6E */
+    {0x0000, 0, {0}},	/* 6F */
+    {0x0000, 0, {0}},	/* 70 */
+    {0x0000, 0, {0}},	/* 71 */
+    {0x0000, 0, {0}},	/* 72 */
+    {0x0000, 0, {0}},	/* 73 */
+    {0x0000, 0, {0}},	/* 74 */
+    {0x0000, 0, {0}},	/* 75 */
+    {0x0000, 0, {0}},	/* 76 */
+    {0x0000, 0, {0}},	/* 77 */
+    {0x0000, 0, {0}},	/* 78 */
+    {0x0000, 0, {0}},	/* 79 */
+    {0x0000, 0, {0}},	/* 7A */
+    {0x0000, 0, {0}},	/* 7B */
+    {0x0000, 0, {0}},	/* 7C */
+    {0x0000, 0, {0}},	/* 7D */
+    {0x0000, 0, {0}},	/* 7E */
+    {0x0000, 0, {0}},	/* 7F */
+    {0x0000, 0, {0}},	/* 80 */
+    {0x0000, 0, {0}},	/* 81 */
+    {0x0000, 0, {0}},	/* 82 */
+    {0x0000, 0, {0}},	/* 83 */
+    {0x0000, 0, {0}},	/* 84 */
+    {0x0000, 0, {0}},	/* 85 */
+    {0x0000, 0, {0}},	/* 86 */
+    {0x0000, 0, {0}},	/* 87 */
+    {0x0000, 0, {0}},	/* 88 */
+    {0x0000, 0, {0}},	/* 89 */
+    {0x0000, 0, {0}},	/* 8A */
+    {0x0000, 0, {0}},	/* 8B */
+    {0x0000, 0, {0}},	/* 8C */
+    {0x0000, 0, {0}},	/* 8D */
+    {0x0000, 0, {0}},	/* 8E */
+    {0x0000, 0, {0}},	/* 8F */
+    {0x0000, 0, {0}},	/* 90 */
+    {0x0000, 0, {0}},	/* 91 */
+    {0x0000, 0, {0}},	/* 92 */
+    {0x0000, 0, {0}},	/* 93 */
+    {0x0000, 0, {0}},	/* 94 */
+    {0x0000, 0, {0}},	/* 95 */
+    {0x0000, 0, {0}},	/* 96 */
+    {0x0000, 0, {0}},	/* 97 */
+    {0x0000, 0, {0}},	/* 98 */
+    {0x0000, 0, {0}},	/* 99 */
+    {0x0000, 0, {0}},	/* 9A */
+    {0x0000, 0, {0}},	/* 9B */
+    {0x0000, 0, {0}},	/* 9C */
+    {0x0000, 0, {0}},	/* 9D */
+    {0x0000, 0, {0}},	/* 9E */
+    {0x0000, 0, {0}},	/* 9F */
+    {0x0000, 0, {0}},	/* A0 */
+    {0x0104, 2, {0xc4, 0x84}},	/* A1 */
+    {0x0138, 2, {0xc4, 0xb8}},	/* A2 */
+    {0x0156, 2, {0xc5, 0x96}},	/* A3 */
+    {0x0000, 0, {0}},	/* A4 */
+    {0x0128, 2, {0xc4, 0xa8}},	/* A5 */
+    {0x013b, 2, {0xc4, 0xbb}},	/* A6 */
+    {0x0000, 0, {0}},	/* A7 */
+    {0x0000, 0, {0}},	/* A8 */
+    {0x0160, 2, {0xc5, 0xa0}},	/* A9 */
+    {0x0112, 2, {0xc4, 0x92}},	/* AA */
+    {0x0122, 2, {0xc4, 0xa2}},	/* AB */
+    {0x0166, 2, {0xc5, 0xa6}},	/* AC */
+    {0x0000, 0, {0}},	/* AD */
+    {0x017d, 2, {0xc5, 0xbd}},	/* AE */
+    {0x0000, 0, {0}},	/* AF */
+    {0x0000, 0, {0}},	/* B0 */
+    {0x0105, 2, {0xc4, 0x85}},	/* B1 */
+    {0x02db, 2, {0xcb, 0x9b}},	/* B2 */
+    {0x0157, 2, {0xc5, 0x97}},	/* B3 */
+    {0x0000, 0, {0}},	/* B4 */
+    {0x0129, 2, {0xc4, 0xa9}},	/* B5 */
+    {0x013c, 2, {0xc4, 0xbc}},	/* B6 */
+    {0x02c7, 2, {0xcb, 0x87}},	/* B7 */
+    {0x0000, 0, {0}},	/* B8 */
+    {0x0161, 2, {0xc5, 0xa1}},	/* B9 */
+    {0x0113, 2, {0xc4, 0x93}},	/* BA */
+    {0x0123, 2, {0xc4, 0xa3}},	/* BB */
+    {0x0167, 2, {0xc5, 0xa7}},	/* BC */
+    {0x014a, 2, {0xc5, 0x8a}},	/* BD */
+    {0x017e, 2, {0xc5, 0xbe}},	/* BE */
+    {0x014b, 2, {0xc5, 0x8b}},	/* BF */
+    {0x0100, 2, {0xc4, 0x80}},	/* C0 */
+    {0x0000, 0, {0}},	/* C1 */
+    {0x0000, 0, {0}},	/* C2 */
+    {0x0000, 0, {0}},	/* C3 */
+    {0x0000, 0, {0}},	/* C4 */
+    {0x0000, 0, {0}},	/* C5 */
+    {0x0000, 0, {0}},	/* C6 */
+    {0x012e, 2, {0xc4, 0xae}},	/* C7 */
+    {0x010c, 2, {0xc4, 0x8c}},	/* C8 */
+    {0x0000, 0, {0}},	/* C9 */
+    {0x0118, 2, {0xc4, 0x98}},	/* CA */
+    {0x0000, 0, {0}},	/* CB */
+    {0x0116, 2, {0xc4, 0x96}},	/* CC */
+    {0x0000, 0, {0}},	/* CD */
+    {0x0000, 0, {0}},	/* CE */
+    {0x012a, 2, {0xc4, 0xaa}},	/* CF */
+    {0x0110, 2, {0xc4, 0x90}},	/* D0 */
+    {0x0145, 2, {0xc5, 0x85}},	/* D1 */
+    {0x014c, 2, {0xc5, 0x8c}},	/* D2 */
+    {0x0136, 2, {0xc4, 0xb6}},	/* D3 */
+    {0x0000, 0, {0}},	/* D4 */
+    {0x0000, 0, {0}},	/* D5 */
+    {0x0000, 0, {0}},	/* D6 */
+    {0x0000, 0, {0}},	/* D7 */
+    {0x0000, 0, {0}},	/* D8 */
+    {0x0172, 2, {0xc5, 0xb2}},	/* D9 */
+    {0x0000, 0, {0}},	/* DA */
+    {0x0000, 0, {0}},	/* DB */
+    {0x0000, 0, {0}},	/* DC */
+    {0x0168, 2, {0xc5, 0xa8}},	/* DD */
+    {0x016a, 2, {0xc5, 0xaa}},	/* DE */
+    {0x0000, 0, {0}},	/* DF */
+    {0x0101, 2, {0xc4, 0x81}},	/* E0 */
+    {0x0000, 0, {0}},	/* E1 */
+    {0x0000, 0, {0}},	/* E2 */
+    {0x0000, 0, {0}},	/* E3 */
+    {0x0000, 0, {0}},	/* E4 */
+    {0x0000, 0, {0}},	/* E5 */
+    {0x0000, 0, {0}},	/* E6 */
+    {0x012f, 2, {0xc4, 0xaf}},	/* E7 */
+    {0x010d, 2, {0xc4, 0x8d}},	/* E8 */
+    {0x0000, 0, {0}},	/* E9 */
+    {0x0119, 2, {0xc4, 0x99}},	/* EA */
+    {0x0000, 0, {0}},	/* EB */
+    {0x0117, 2, {0xc4, 0x97}},	/* EC */
+    {0x0000, 0, {0}},	/* ED */
+    {0x0000, 0, {0}},	/* EE */
+    {0x012b, 2, {0xc4, 0xab}},	/* EF */
+    {0x0111, 2, {0xc4, 0x91}},	/* F0 */
+    {0x0146, 2, {0xc5, 0x86}},	/* F1 */
+    {0x014d, 2, {0xc5, 0x8d}},	/* F2 */
+    {0x0137, 2, {0xc4, 0xb7}},	/* F3 */
+    {0x0000, 0, {0}},	/* F4 */
+    {0x0000, 0, {0}},	/* F5 */
+    {0x0000, 0, {0}},	/* F6 */
+    {0x0000, 0, {0}},	/* F7 */
+    {0x0000, 0, {0}},	/* F8 */
+    {0x0173, 2, {0xc5, 0xb3}},	/* F9 */
+    {0x0000, 0, {0}},	/* FA */
+    {0x0000, 0, {0}},	/* FB */
+    {0x0000, 0, {0}},	/* FC */
+    {0x0169, 2, {0xc5, 0xa9}},	/* FD */
+    {0x016b, 2, {0xc5, 0xab}},	/* FE */
+    {0x02d9, 2, {0xcb, 0x99}},	/* FF */
+};
+
+static const ReverseData iso8859_4_rev[] =
+{
+    {0x0100, 0xC0},
+    {0x0101, 0xE0},
+    {0x0104, 0xA1},
+    {0x0105, 0xB1},
+    {0x010c, 0xC8},
+    {0x010d, 0xE8},
+    {0x0110, 0xD0},
+    {0x0111, 0xF0},
+    {0x0112, 0xAA},
+    {0x0113, 0xBA},
+    {0x0116, 0xCC},
+    {0x0117, 0xEC},
+    {0x0118, 0xCA},
+    {0x0119, 0xEA},
+    {0x0122, 0xAB},
+    {0x0123, 0xBB},
+    {0x0128, 0xA5},
+    {0x0129, 0xB5},
+    {0x012a, 0xCF},
+    {0x012b, 0xEF},
+    {0x012e, 0xC7},
+    {0x012f, 0xE7},
+    {0x0136, 0xD3},
+    {0x0137, 0xF3},
+    {0x0138, 0xA2},
+    {0x013b, 0xA6},
+    {0x013c, 0xB6},
+    {0x0145, 0xD1},
+    {0x0146, 0xF1},
+    {0x014a, 0xBD},
+    {0x014b, 0xBF},
+    {0x014c, 0xD2},
+    {0x014d, 0xF2},
+    {0x0156, 0xA3},
+    {0x0157, 0xB3},
+    {0x0160, 0xA9},
+    {0x0161, 0xB9},
+    {0x0166, 0xAC},
+    {0x0167, 0xBC},
+    {0x0168, 0xDD},
+    {0x0169, 0xFD},
+    {0x016a, 0xDE},
+    {0x016b, 0xFE},
+    {0x0172, 0xD9},
+    {0x0173, 0xF9},
+    {0x017d, 0xAE},
+    {0x017e, 0xBE},
+    {0x02c7, 0xB7},
+    {0x02d9, 0xFF},
+    {0x02db, 0xB2},
+};
+
 static const BuiltInMapping iso8859_5[] =
 {
     /* iso8859-5 */
@@ -461,6 +2889,364 @@ static const BuiltInMapping iso8859_5[] =
     {0x00FF, 0x045F},
 };
 
+static const MappingData iso8859_5_utf8[] =
+{
+    {0x0000, 0, {0}},	/* 00 */
+    {0x0001, 0, {0}},	/* 01 */
+    {0x0002, 0, {0}},	/* 02 */
+    {0x0003, 0, {0}},	/* 03 */
+    {0x0004, 0, {0}},	/* 04 */
+    {0x0005, 0, {0}},	/* 05 */
+    {0x0006, 0, {0}},	/* 06 */
+    {0x0007, 0, {0}},	/* 07 */
+    {0x0008, 0, {0}},	/* 08 */
+    {0x0009, 0, {0}},	/* 09 */
+    {0x000a, 0, {0}},	/* 0A */
+    {0x000b, 0, {0}},	/* 0B */
+    {0x000c, 0, {0}},	/* 0C */
+    {0x000d, 0, {0}},	/* 0D */
+    {0x000e, 0, {0}},	/* 0E */
+    {0x000f, 0, {0}},	/* 0F */
+    {0x0010, 0, {0}},	/* 10 */
+    {0x0011, 0, {0}},	/* 11 */
+    {0x0012, 0, {0}},	/* 12 */
+    {0x0013, 0, {0}},	/* 13 */
+    {0x0014, 0, {0}},	/* 14 */
+    {0x0015, 0, {0}},	/* 15 */
+    {0x0016, 0, {0}},	/* 16 */
+    {0x0017, 0, {0}},	/* 17 */
+    {0x0018, 0, {0}},	/* 18 */
+    {0x0019, 0, {0}},	/* 19 */
+    {0x001a, 0, {0}},	/* 1A */
+    {0x001b, 0, {0}},	/* 1B */
+    {0x001c, 0, {0}},	/* 1C */
+    {0x001d, 0, {0}},	/* 1D */
+    {0x001e, 0, {0}},	/* 1E */
+    {0x001f, 0, {0}},	/* 1F */
+    {0x0020, 0, {0}},	/* 20 */
+    {0x0021, 0, {0}},	/* 21 */
+    {0x0022, 0, {0}},	/* 22 */
+    {0x0023, 0, {0}},	/* 23 */
+    {0x0024, 0, {0}},	/* 24 */
+    {0x0025, 0, {0}},	/* 25 */
+    {0x0026, 0, {0}},	/* 26 */
+    {0x0027, 0, {0}},	/* 27 */
+    {0x0028, 0, {0}},	/* 28 */
+    {0x0029, 0, {0}},	/* 29 */
+    {0x002a, 0, {0}},	/* 2A */
+    {0x002b, 0, {0}},	/* 2B */
+    {0x002c, 0, {0}},	/* 2C */
+    {0x002d, 0, {0}},	/* 2D */
+    {0x002e, 0, {0}},	/* 2E */
+    {0x002f, 0, {0}},	/* 2F */
+    {0x0030, 0, {0}},	/* 30 */
+    {0x0031, 0, {0}},	/* 31 */
+    {0x0032, 0, {0}},	/* 32 */
+    {0x0033, 0, {0}},	/* 33 */
+    {0x0034, 0, {0}},	/* 34 */
+    {0x0035, 0, {0}},	/* 35 */
+    {0x0036, 0, {0}},	/* 36 */
+    {0x0037, 0, {0}},	/* 37 */
+    {0x0038, 0, {0}},	/* 38 */
+    {0x0039, 0, {0}},	/* 39 */
+    {0x003a, 0, {0}},	/* 3A */
+    {0x003b, 0, {0}},	/* 3B */
+    {0x003c, 0, {0}},	/* 3C */
+    {0x003d, 0, {0}},	/* 3D */
+    {0x003e, 0, {0}},	/* 3E */
+    {0x003f, 0, {0}},	/* 3F */
+    {0x0040, 0, {0}},	/* 40 */
+    {0x0041, 0, {0}},	/* 41 */
+    {0x0042, 0, {0}},	/* 42 */
+    {0x0043, 0, {0}},	/* 43 */
+    {0x0044, 0, {0}},	/* 44 */
+    {0x0045, 0, {0}},	/* 45 */
+    {0x0046, 0, {0}},	/* 46 */
+    {0x0047, 0, {0}},	/* 47 */
+    {0x0048, 0, {0}},	/* 48 */
+    {0x0049, 0, {0}},	/* 49 */
+    {0x004a, 0, {0}},	/* 4A */
+    {0x004b, 0, {0}},	/* 4B */
+    {0x004c, 0, {0}},	/* 4C */
+    {0x004d, 0, {0}},	/* 4D */
+    {0x004e, 0, {0}},	/* 4E */
+    {0x004f, 0, {0}},	/* 4F */
+    {0x0050, 0, {0}},	/* 50 */
+    {0x0051, 0, {0}},	/* 51 */
+    {0x0052, 0, {0}},	/* 52 */
+    {0x0053, 0, {0}},	/* 53 */
+    {0x0054, 0, {0}},	/* 54 */
+    {0x0055, 0, {0}},	/* 55 */
+    {0x0056, 0, {0}},	/* 56 */
+    {0x0057, 0, {0}},	/* 57 */
+    {0x0058, 0, {0}},	/* 58 */
+    {0x0059, 0, {0}},	/* 59 */
+    {0x005a, 0, {0}},	/* 5A */
+    {0x005b, 0, {0}},	/* 5B */
+    {0x005c, 0, {0}},	/* 5C */
+    {0x005d, 0, {0}},	/* 5D */
+    {0x0000, 0, {0}},	/* 5E */
+    {0x0000, 0, {0}},	/* 5F */
+    {0x0000, 0, {0}},	/* 60 */
+    {0x0000, 0, {0}},	/* 61 */
+    {0x0000, 0, {0}},	/* 62 */
+    {0x0000, 0, {0}},	/* 63 */
+    {0x0000, 0, {0}},	/* 64 */
+    {0x0000, 0, {0}},	/* 65 */
+    {0x0000, 0, {0}},	/* 66 */
+    {0x0000, 0, {0}},	/* 67 */
+    {0x0000, 0, {0}},	/* 68 */
+    {0x0000, 0, {0}},	/* 69 */
+    {0x0000, 0, {0}},	/* 6A */
+    {0x0000, 0, {0}},	/* 6B */
+    {0x0000, 0, {0}},	/* 6C */
+    {0x0000, 0, {0}},	/* 6D */
+    {0x0000, 0, {0}},	/* 6E */
+    {0x0000, 0, {0}},	/* 6F */
+    {0x0000, 0, {0}},	/* 70 */
+    {0x0000, 0, {0}},	/* 71 */
+    {0x0000, 0, {0}},	/* 72 */
+    {0x0000, 0, {0}},	/* 73 */
+    {0x0000, 0, {0}},	/* 74 */
+    {0x0000, 0, {0}},	/* 75 */
+    {0x0000, 0, {0}},	/* 76 */
+    {0x0000, 0, {0}},	/* 77 */
+    {0x0000, 0, {0}},	/* 78 */
+    {0x0000, 0, {0}},	/* 79 */
+    {0x0000, 0, {0}},	/* 7A */
+    {0x0000, 0, {0}},	/* 7B */
+    {0x0000, 0, {0}},	/* 7C */
+    {0x0000, 0, {0}},	/* 7D */
+    {0x0000, 0, {0}},	/* 7E */
+    {0x0000, 0, {0}},	/* 7F */
+    {0x0000, 0, {0}},	/* 80 */
+    {0x0000, 0, {0}},	/* 81 */
+    {0x0000, 0, {0}},	/* 82 */
+    {0x0000, 0, {0}},	/* 83 */
+    {0x0000, 0, {0}},	/* 84 */
+    {0x0000, 0, {0}},	/* 85 */
+    {0x0000, 0, {0}},	/* 86 */
+    {0x0000, 0, {0}},	/* 87 */
+    {0x0000, 0, {0}},	/* 88 */
+    {0x0000, 0, {0}},	/* 89 */
+    {0x0000, 0, {0}},	/* 8A */
+    {0x0000, 0, {0}},	/* 8B */
+    {0x0000, 0, {0}},	/* 8C */
+    {0x0000, 0, {0}},	/* 8D */
+    {0x0000, 0, {0}},	/* 8E */
+    {0x0000, 0, {0}},	/* 8F */
+    {0x0000, 0, {0}},	/* 90 */
+    {0x0000, 0, {0}},	/* 91 */
+    {0x0000, 0, {0}},	/* 92 */
+    {0x0000, 0, {0}},	/* 93 */
+    {0x0000, 0, {0}},	/* 94 */
+    {0x0000, 0, {0}},	/* 95 */
+    {0x0000, 0, {0}},	/* 96 */
+    {0x0000, 0, {0}},	/* 97 */
+    {0x0000, 0, {0}},	/* 98 */
+    {0x0000, 0, {0}},	/* 99 */
+    {0x0000, 0, {0}},	/* 9A */
+    {0x0000, 0, {0}},	/* 9B */
+    {0x0000, 0, {0}},	/* 9C */
+    {0x0000, 0, {0}},	/* 9D */
+    {0x0000, 0, {0}},	/* 9E */
+    {0x0000, 0, {0}},	/* 9F */
+    {0x0000, 0, {0}},	/* A0 */
+    {0x0401, 2, {0xd0, 0x81}},	/* A1 */
+    {0x0402, 2, {0xd0, 0x82}},	/* A2 */
+    {0x0403, 2, {0xd0, 0x83}},	/* A3 */
+    {0x0404, 2, {0xd0, 0x84}},	/* A4 */
+    {0x0405, 2, {0xd0, 0x85}},	/* A5 */
+    {0x0406, 2, {0xd0, 0x86}},	/* A6 */
+    {0x0407, 2, {0xd0, 0x87}},	/* A7 */
+    {0x0408, 2, {0xd0, 0x88}},	/* A8 */
+    {0x0409, 2, {0xd0, 0x89}},	/* A9 */
+    {0x040a, 2, {0xd0, 0x8a}},	/* AA */
+    {0x040b, 2, {0xd0, 0x8b}},	/* AB */
+    {0x040c, 2, {0xd0, 0x8c}},	/* AC */
+    {0x0000, 0, {0}},	/* AD */
+    {0x040e, 2, {0xd0, 0x8e}},	/* AE */
+    {0x040f, 2, {0xd0, 0x8f}},	/* AF */
+    {0x0410, 2, {0xd0, 0x90}},	/* B0 */
+    {0x0411, 2, {0xd0, 0x91}},	/* B1 */
+    {0x0412, 2, {0xd0, 0x92}},	/* B2 */
+    {0x0413, 2, {0xd0, 0x93}},	/* B3 */
+    {0x0414, 2, {0xd0, 0x94}},	/* B4 */
+    {0x0415, 2, {0xd0, 0x95}},	/* B5 */
+    {0x0416, 2, {0xd0, 0x96}},	/* B6 */
+    {0x0417, 2, {0xd0, 0x97}},	/* B7 */
+    {0x0418, 2, {0xd0, 0x98}},	/* B8 */
+    {0x0419, 2, {0xd0, 0x99}},	/* B9 */
+    {0x041a, 2, {0xd0, 0x9a}},	/* BA */
+    {0x041b, 2, {0xd0, 0x9b}},	/* BB */
+    {0x041c, 2, {0xd0, 0x9c}},	/* BC */
+    {0x041d, 2, {0xd0, 0x9d}},	/* BD */
+    {0x041e, 2, {0xd0, 0x9e}},	/* BE */
+    {0x041f, 2, {0xd0, 0x9f}},	/* BF */
+    {0x0420, 2, {0xd0, 0xa0}},	/* C0 */
+    {0x0421, 2, {0xd0, 0xa1}},	/* C1 */
+    {0x0422, 2, {0xd0, 0xa2}},	/* C2 */
+    {0x0423, 2, {0xd0, 0xa3}},	/* C3 */
+    {0x0424, 2, {0xd0, 0xa4}},	/* C4 */
+    {0x0425, 2, {0xd0, 0xa5}},	/* C5 */
+    {0x0426, 2, {0xd0, 0xa6}},	/* C6 */
+    {0x0427, 2, {0xd0, 0xa7}},	/* C7 */
+    {0x0428, 2, {0xd0, 0xa8}},	/* C8 */
+    {0x0429, 2, {0xd0, 0xa9}},	/* C9 */
+    {0x042a, 2, {0xd0, 0xaa}},	/* CA */
+    {0x042b, 2, {0xd0, 0xab}},	/* CB */
+    {0x042c, 2, {0xd0, 0xac}},	/* CC */
+    {0x042d, 2, {0xd0, 0xad}},	/* CD */
+    {0x042e, 2, {0xd0, 0xae}},	/* CE */
+    {0x042f, 2, {0xd0, 0xaf}},	/* CF */
+    {0x0430, 2, {0xd0, 0xb0}},	/* D0 */
+    {0x0431, 2, {0xd0, 0xb1}},	/* D1 */
+    {0x0432, 2, {0xd0, 0xb2}},	/* D2 */
+    {0x0433, 2, {0xd0, 0xb3}},	/* D3 */
+    {0x0434, 2, {0xd0, 0xb4}},	/* D4 */
+    {0x0435, 2, {0xd0, 0xb5}},	/* D5 */
+    {0x0436, 2, {0xd0, 0xb6}},	/* D6 */
+    {0x0437, 2, {0xd0, 0xb7}},	/* D7 */
+    {0x0438, 2, {0xd0, 0xb8}},	/* D8 */
+    {0x0439, 2, {0xd0, 0xb9}},	/* D9 */
+    {0x043a, 2, {0xd0, 0xba}},	/* DA */
+    {0x043b, 2, {0xd0, 0xbb}},	/* DB */
+    {0x043c, 2, {0xd0, 0xbc}},	/* DC */
+    {0x043d, 2, {0xd0, 0xbd}},	/* DD */
+    {0x043e, 2, {0xd0, 0xbe}},	/* DE */
+    {0x043f, 2, {0xd0, 0xbf}},	/* DF */
+    {0x0440, 2, {0xd1, 0x80}},	/* E0 */
+    {0x0441, 2, {0xd1, 0x81}},	/* E1 */
+    {0x0442, 2, {0xd1, 0x82}},	/* E2 */
+    {0x0443, 2, {0xd1, 0x83}},	/* E3 */
+    {0x0444, 2, {0xd1, 0x84}},	/* E4 */
+    {0x0445, 2, {0xd1, 0x85}},	/* E5 */
+    {0x0446, 2, {0xd1, 0x86}},	/* E6 */
+    {0x0447, 2, {0xd1, 0x87}},	/* E7 */
+    {0x0448, 2, {0xd1, 0x88}},	/* E8 */
+    {0x0449, 2, {0xd1, 0x89}},	/* E9 */
+    {0x044a, 2, {0xd1, 0x8a}},	/* EA */
+    {0x044b, 2, {0xd1, 0x8b}},	/* EB */
+    {0x044c, 2, {0xd1, 0x8c}},	/* EC */
+    {0x044d, 2, {0xd1, 0x8d}},	/* ED */
+    {0x044e, 2, {0xd1, 0x8e}},	/* EE */
+    {0x044f, 2, {0xd1, 0x8f}},	/* EF */
+    {0x2116, 3, {0xe2, 0x84, 0x96}},	/* F0 */
+    {0x0451, 2, {0xd1, 0x91}},	/* F1 */
+    {0x0452, 2, {0xd1, 0x92}},	/* F2 */
+    {0x0453, 2, {0xd1, 0x93}},	/* F3 */
+    {0x0454, 2, {0xd1, 0x94}},	/* F4 */
+    {0x0455, 2, {0xd1, 0x95}},	/* F5 */
+    {0x0456, 2, {0xd1, 0x96}},	/* F6 */
+    {0x0457, 2, {0xd1, 0x97}},	/* F7 */
+    {0x0458, 2, {0xd1, 0x98}},	/* F8 */
+    {0x0459, 2, {0xd1, 0x99}},	/* F9 */
+    {0x045a, 2, {0xd1, 0x9a}},	/* FA */
+    {0x045b, 2, {0xd1, 0x9b}},	/* FB */
+    {0x045c, 2, {0xd1, 0x9c}},	/* FC */
+    {0x00a7, 2, {0xc2, 0xa7}},	/* FD */
+    {0x045e, 2, {0xd1, 0x9e}},	/* FE */
+    {0x045f, 2, {0xd1, 0x9f}},	/* FF */
+};
+
+static const ReverseData iso8859_5_rev[] =
+{
+    {0x00a7, 0xFD},
+    {0x0401, 0xA1},
+    {0x0402, 0xA2},
+    {0x0403, 0xA3},
+    {0x0404, 0xA4},
+    {0x0405, 0xA5},
+    {0x0406, 0xA6},
+    {0x0407, 0xA7},
+    {0x0408, 0xA8},
+    {0x0409, 0xA9},
+    {0x040a, 0xAA},
+    {0x040b, 0xAB},
+    {0x040c, 0xAC},
+    {0x040e, 0xAE},
+    {0x040f, 0xAF},
+    {0x0410, 0xB0},
+    {0x0411, 0xB1},
+    {0x0412, 0xB2},
+    {0x0413, 0xB3},
+    {0x0414, 0xB4},
+    {0x0415, 0xB5},
+    {0x0416, 0xB6},
+    {0x0417, 0xB7},
+    {0x0418, 0xB8},
+    {0x0419, 0xB9},
+    {0x041a, 0xBA},
+    {0x041b, 0xBB},
+    {0x041c, 0xBC},
+    {0x041d, 0xBD},
+    {0x041e, 0xBE},
+    {0x041f, 0xBF},
+    {0x0420, 0xC0},
+    {0x0421, 0xC1},
+    {0x0422, 0xC2},
+    {0x0423, 0xC3},
+    {0x0424, 0xC4},
+    {0x0425, 0xC5},
+    {0x0426, 0xC6},
+    {0x0427, 0xC7},
+    {0x0428, 0xC8},
+    {0x0429, 0xC9},
+    {0x042a, 0xCA},
+    {0x042b, 0xCB},
+    {0x042c, 0xCC},
+    {0x042d, 0xCD},
+    {0x042e, 0xCE},
+    {0x042f, 0xCF},
+    {0x0430, 0xD0},
+    {0x0431, 0xD1},
+    {0x0432, 0xD2},
+    {0x0433, 0xD3},
+    {0x0434, 0xD4},
+    {0x0435, 0xD5},
+    {0x0436, 0xD6},
+    {0x0437, 0xD7},
+    {0x0438, 0xD8},
+    {0x0439, 0xD9},
+    {0x043a, 0xDA},
+    {0x043b, 0xDB},
+    {0x043c, 0xDC},
+    {0x043d, 0xDD},
+    {0x043e, 0xDE},
+    {0x043f, 0xDF},
+    {0x0440, 0xE0},
+    {0x0441, 0xE1},
+    {0x0442, 0xE2},
+    {0x0443, 0xE3},
+    {0x0444, 0xE4},
+    {0x0445, 0xE5},
+    {0x0446, 0xE6},
+    {0x0447, 0xE7},
+    {0x0448, 0xE8},
+    {0x0449, 0xE9},
+    {0x044a, 0xEA},
+    {0x044b, 0xEB},
+    {0x044c, 0xEC},
+    {0x044d, 0xED},
+    {0x044e, 0xEE},
+    {0x044f, 0xEF},
+    {0x0451, 0xF1},
+    {0x0452, 0xF2},
+    {0x0453, 0xF3},
+    {0x0454, 0xF4},
+    {0x0455, 0xF5},
+    {0x0456, 0xF6},
+    {0x0457, 0xF7},
+    {0x0458, 0xF8},
+    {0x0459, 0xF9},
+    {0x045a, 0xFA},
+    {0x045b, 0xFB},
+    {0x045c, 0xFC},
+    {0x045e, 0xFE},
+    {0x045f, 0xFF},
+    {0x2116, 0xF0},
+};
+
 static const BuiltInMapping iso8859_6[] =
 {
     /* iso8859-6 */
@@ -514,6 +3300,318 @@ static const BuiltInMapping iso8859_6[] =
     {0x00F2, 0x0652},
 };
 
+static const MappingData iso8859_6_utf8[] =
+{
+    {0x0000, 0, {0}},	/* 00 */
+    {0x0001, 0, {0}},	/* 01 */
+    {0x0002, 0, {0}},	/* 02 */
+    {0x0003, 0, {0}},	/* 03 */
+    {0x0004, 0, {0}},	/* 04 */
+    {0x0005, 0, {0}},	/* 05 */
+    {0x0006, 0, {0}},	/* 06 */
+    {0x0007, 0, {0}},	/* 07 */
+    {0x0008, 0, {0}},	/* 08 */
+    {0x0009, 0, {0}},	/* 09 */
+    {0x000a, 0, {0}},	/* 0A */
+    {0x000b, 0, {0}},	/* 0B */
+    {0x000c, 0, {0}},	/* 0C */
+    {0x000d, 0, {0}},	/* 0D */
+    {0x000e, 0, {0}},	/* 0E */
+    {0x000f, 0, {0}},	/* 0F */
+    {0x0010, 0, {0}},	/* 10 */
+    {0x0011, 0, {0}},	/* 11 */
+    {0x0012, 0, {0}},	/* 12 */
+    {0x0013, 0, {0}},	/* 13 */
+    {0x0014, 0, {0}},	/* 14 */
+    {0x0015, 0, {0}},	/* 15 */
+    {0x0016, 0, {0}},	/* 16 */
+    {0x0017, 0, {0}},	/* 17 */
+    {0x0018, 0, {0}},	/* 18 */
+    {0x0019, 0, {0}},	/* 19 */
+    {0x001a, 0, {0}},	/* 1A */
+    {0x001b, 0, {0}},	/* 1B */
+    {0x001c, 0, {0}},	/* 1C */
+    {0x001d, 0, {0}},	/* 1D */
+    {0x001e, 0, {0}},	/* 1E */
+    {0x001f, 0, {0}},	/* 1F */
+    {0x0020, 0, {0}},	/* 20 */
+    {0x0021, 0, {0}},	/* 21 */
+    {0x0022, 0, {0}},	/* 22 */
+    {0x0023, 0, {0}},	/* 23 */
+    {0x0024, 0, {0}},	/* 24 */
+    {0x0025, 0, {0}},	/* 25 */
+    {0x0026, 0, {0}},	/* 26 */
+    {0x0027, 0, {0}},	/* 27 */
+    {0x0028, 0, {0}},	/* 28 */
+    {0x0029, 0, {0}},	/* 29 */
+    {0x002a, 0, {0}},	/* 2A */
+    {0x002b, 0, {0}},	/* 2B */
+    {0x002c, 0, {0}},	/* 2C */
+    {0x002d, 0, {0}},	/* 2D */
+    {0x002e, 0, {0}},	/* 2E */
+    {0x002f, 0, {0}},	/* 2F */
+    {0x0000, 0, {0}},	/* 30 */
+    {0x0000, 0, {0}},	/* 31 */
+    {0x0000, 0, {0}},	/* 32 */
+    {0x0000, 0, {0}},	/* 33 */
+    {0x0000, 0, {0}},	/* 34 */
+    {0x0000, 0, {0}},	/* 35 */
+    {0x0000, 0, {0}},	/* 36 */
+    {0x0000, 0, {0}},	/* 37 */
+    {0x0000, 0, {0}},	/* 38 */
+    {0x0000, 0, {0}},	/* 39 */
+    {0x0000, 0, {0}},	/* 3A */
+    {0x0000, 0, {0}},	/* 3B */
+    {0x0000, 0, {0}},	/* 3C */
+    {0x0000, 0, {0}},	/* 3D */
+    {0x0000, 0, {0}},	/* 3E */
+    {0x0000, 0, {0}},	/* 3F */
+    {0x0000, 0, {0}},	/* 40 */
+    {0x0000, 0, {0}},	/* 41 */
+    {0x0000, 0, {0}},	/* 42 */
+    {0x0000, 0, {0}},	/* 43 */
+    {0x0000, 0, {0}},	/* 44 */
+    {0x0000, 0, {0}},	/* 45 */
+    {0x0000, 0, {0}},	/* 46 */
+    {0x0000, 0, {0}},	/* 47 */
+    {0x0000, 0, {0}},	/* 48 */
+    {0x0000, 0, {0}},	/* 49 */
+    {0x0000, 0, {0}},	/* 4A */
+    {0x0000, 0, {0}},	/* 4B */
+    {0x0000, 0, {0}},	/* 4C */
+    {0x0000, 0, {0}},	/* 4D */
+    {0x0000, 0, {0}},	/* 4E */
+    {0x0000, 0, {0}},	/* 4F */
+    {0x0000, 0, {0}},	/* 50 */
+    {0x0000, 0, {0}},	/* 51 */
+    {0x0000, 0, {0}},	/* 52 */
+    {0x0000, 0, {0}},	/* 53 */
+    {0x0000, 0, {0}},	/* 54 */
+    {0x0000, 0, {0}},	/* 55 */
+    {0x0000, 0, {0}},	/* 56 */
+    {0x0000, 0, {0}},	/* 57 */
+    {0x0000, 0, {0}},	/* 58 */
+    {0x0000, 0, {0}},	/* 59 */
+    {0x0000, 0, {0}},	/* 5A */
+    {0x0000, 0, {0}},	/* 5B */
+    {0x0000, 0, {0}},	/* 5C */
+    {0x0000, 0, {0}},	/* 5D */
+    {0x0000, 0, {0}},	/* 5E */
+    {0x0000, 0, {0}},	/* 5F */
+    {0x0000, 0, {0}},	/* 60 */
+    {0x0000, 0, {0}},	/* 61 */
+    {0x0000, 0, {0}},	/* 62 */
+    {0x0000, 0, {0}},	/* 63 */
+    {0x0000, 0, {0}},	/* 64 */
+    {0x0000, 0, {0}},	/* 65 */
+    {0x0000, 0, {0}},	/* 66 */
+    {0x0000, 0, {0}},	/* 67 */
+    {0x0000, 0, {0}},	/* 68 */
+    {0x0000, 0, {0}},	/* 69 */
+    {0x0000, 0, {0}},	/* 6A */
+    {0x0000, 0, {0}},	/* 6B */
+    {0x0000, 0, {0}},	/* 6C */
+    {0x0000, 0, {0}},	/* 6D */
+    {0x0000, 0, {0}},	/* 6E */
+    {0x0000, 0, {0}},	/* 6F */
+    {0x0000, 0, {0}},	/* 70 */
+    {0x0000, 0, {0}},	/* 71 */
+    {0x0000, 0, {0}},	/* 72 */
+    {0x0000, 0, {0}},	/* 73 */
+    {0x0000, 0, {0}},	/* 74 */
+    {0x0000, 0, {0}},	/* 75 */
+    {0x0000, 0, {0}},	/* 76 */
+    {0x0000, 0, {0}},	/* 77 */
+    {0x0000, 0, {0}},	/* 78 */
+    {0x0000, 0, {0}},	/* 79 */
+    {0x0000, 0, {0}},	/* 7A */
+    {0x0000, 0, {0}},	/* 7B */
+    {0x0000, 0, {0}},	/* 7C */
+    {0x0000, 0, {0}},	/* 7D */
+    {0x0000, 0, {0}},	/* 7E */
+    {0x0000, 0, {0}},	/* 7F */
+    {0x0000, 0, {0}},	/* 80 */
+    {0x0000, 0, {0}},	/* 81 */
+    {0x0000, 0, {0}},	/* 82 */
+    {0x0000, 0, {0}},	/* 83 */
+    {0x0000, 0, {0}},	/* 84 */
+    {0x0000, 0, {0}},	/* 85 */
+    {0x0000, 0, {0}},	/* 86 */
+    {0x0000, 0, {0}},	/* 87 */
+    {0x0000, 0, {0}},	/* 88 */
+    {0x0000, 0, {0}},	/* 89 */
+    {0x0000, 0, {0}},	/* 8A */
+    {0x0000, 0, {0}},	/* 8B */
+    {0x0000, 0, {0}},	/* 8C */
+    {0x0000, 0, {0}},	/* 8D */
+    {0x0000, 0, {0}},	/* 8E */
+    {0x0000, 0, {0}},	/* 8F */
+    {0x0000, 0, {0}},	/* 90 */
+    {0x0000, 0, {0}},	/* 91 */
+    {0x0000, 0, {0}},	/* 92 */
+    {0x0000, 0, {0}},	/* 93 */
+    {0x0000, 0, {0}},	/* 94 */
+    {0x0000, 0, {0}},	/* 95 */
+    {0x0000, 0, {0}},	/* 96 */
+    {0x0000, 0, {0}},	/* 97 */
+    {0x0000, 0, {0}},	/* 98 */
+    {0x0000, 0, {0}},	/* 99 */
+    {0x0000, 0, {0}},	/* 9A */
+    {0x0000, 0, {0}},	/* 9B */
+    {0x0000, 0, {0}},	/* 9C */
+    {0x0000, 0, {0}},	/* 9D */
+    {0x0000, 0, {0}},	/* 9E */
+    {0x0000, 0, {0}},	/* 9F */
+    {0x0000, 0, {0}},	/* A0 */
+    {0x0000, 0, {0}},	/* A1 */
+    {0x0000, 0, {0}},	/* A2 */
+    {0x0000, 0, {0}},	/* A3 */
+    {0x0000, 0, {0}},	/* A4 */
+    {0x0000, 0, {0}},	/* A5 */
+    {0x0000, 0, {0}},	/* A6 */
+    {0x0000, 0, {0}},	/* A7 */
+    {0x0000, 0, {0}},	/* A8 */
+    {0x0000, 0, {0}},	/* A9 */
+    {0x0000, 0, {0}},	/* AA */
+    {0x0000, 0, {0}},	/* AB */
+    {0x060c, 2, {0xd8, 0x8c}},	/* AC */
+    {0x0000, 0, {0}},	/* AD */
+    {0x0000, 0, {0}},	/* AE */
+    {0x0000, 0, {0}},	/* AF */
+    {0x0000, 0, {0}},	/* B0 */
+    {0x0000, 0, {0}},	/* B1 */
+    {0x0000, 0, {0}},	/* B2 */
+    {0x0000, 0, {0}},	/* B3 */
+    {0x0000, 0, {0}},	/* B4 */
+    {0x0000, 0, {0}},	/* B5 */
+    {0x0000, 0, {0}},	/* B6 */
+    {0x0000, 0, {0}},	/* B7 */
+    {0x0000, 0, {0}},	/* B8 */
+    {0x0000, 0, {0}},	/* B9 */
+    {0x0000, 0, {0}},	/* BA */
+    {0x061b, 2, {0xd8, 0x9b}},	/* BB */
+    {0x0000, 0, {0}},	/* BC */
+    {0x0000, 0, {0}},	/* BD */
+    {0x0000, 0, {0}},	/* BE */
+    {0x061f, 2, {0xd8, 0x9f}},	/* BF */
+    {0x0000, 0, {0}},	/* C0 */
+    {0x0621, 2, {0xd8, 0xa1}},	/* C1 */
+    {0x0622, 2, {0xd8, 0xa2}},	/* C2 */
+    {0x0623, 2, {0xd8, 0xa3}},	/* C3 */
+    {0x0624, 2, {0xd8, 0xa4}},	/* C4 */
+    {0x0625, 2, {0xd8, 0xa5}},	/* C5 */
+    {0x0626, 2, {0xd8, 0xa6}},	/* C6 */
+    {0x0627, 2, {0xd8, 0xa7}},	/* C7 */
+    {0x0628, 2, {0xd8, 0xa8}},	/* C8 */
+    {0x0629, 2, {0xd8, 0xa9}},	/* C9 */
+    {0x062a, 2, {0xd8, 0xaa}},	/* CA */
+    {0x062b, 2, {0xd8, 0xab}},	/* CB */
+    {0x062c, 2, {0xd8, 0xac}},	/* CC */
+    {0x062d, 2, {0xd8, 0xad}},	/* CD */
+    {0x062e, 2, {0xd8, 0xae}},	/* CE */
+    {0x062f, 2, {0xd8, 0xaf}},	/* CF */
+    {0x0630, 2, {0xd8, 0xb0}},	/* D0 */
+    {0x0631, 2, {0xd8, 0xb1}},	/* D1 */
+    {0x0632, 2, {0xd8, 0xb2}},	/* D2 */
+    {0x0633, 2, {0xd8, 0xb3}},	/* D3 */
+    {0x0634, 2, {0xd8, 0xb4}},	/* D4 */
+    {0x0635, 2, {0xd8, 0xb5}},	/* D5 */
+    {0x0636, 2, {0xd8, 0xb6}},	/* D6 */
+    {0x0637, 2, {0xd8, 0xb7}},	/* D7 */
+    {0x0638, 2, {0xd8, 0xb8}},	/* D8 */
+    {0x0639, 2, {0xd8, 0xb9}},	/* D9 */
+    {0x063a, 2, {0xd8, 0xba}},	/* DA */
+    {0x0000, 0, {0}},	/* DB */
+    {0x0000, 0, {0}},	/* DC */
+    {0x0000, 0, {0}},	/* DD */
+    {0x0000, 0, {0}},	/* DE */
+    {0x0000, 0, {0}},	/* DF */
+    {0x0640, 2, {0xd9, 0x80}},	/* E0 */
+    {0x0641, 2, {0xd9, 0x81}},	/* E1 */
+    {0x0642, 2, {0xd9, 0x82}},	/* E2 */
+    {0x0643, 2, {0xd9, 0x83}},	/* E3 */
+    {0x0644, 2, {0xd9, 0x84}},	/* E4 */
+    {0x0645, 2, {0xd9, 0x85}},	/* E5 */
+    {0x0646, 2, {0xd9, 0x86}},	/* E6 */
+    {0x0647, 2, {0xd9, 0x87}},	/* E7 */
+    {0x0648, 2, {0xd9, 0x88}},	/* E8 */
+    {0x0649, 2, {0xd9, 0x89}},	/* E9 */
+    {0x064a, 2, {0xd9, 0x8a}},	/* EA */
+    {0x064b, 2, {0xd9, 0x8b}},	/* EB */
+    {0x064c, 2, {0xd9, 0x8c}},	/* EC */
+    {0x064d, 2, {0xd9, 0x8d}},	/* ED */
+    {0x064e, 2, {0xd9, 0x8e}},	/* EE */
+    {0x064f, 2, {0xd9, 0x8f}},	/* EF */
+    {0x0650, 2, {0xd9, 0x90}},	/* F0 */
+    {0x0651, 2, {0xd9, 0x91}},	/* F1 */
+    {0x0652, 2, {0xd9, 0x92}},	/* F2 */
+    {0x0000, 0, {0}},	/* F3 */
+    {0x0000, 0, {0}},	/* F4 */
+    {0x0000, 0, {0}},	/* F5 */
+    {0x0000, 0, {0}},	/* F6 */
+    {0x0000, 0, {0}},	/* F7 */
+    {0x0000, 0, {0}},	/* F8 */
+    {0x0000, 0, {0}},	/* F9 */
+    {0x0000, 0, {0}},	/* FA */
+    {0x0000, 0, {0}},	/* FB */
+    {0x0000, 0, {0}},	/* FC */
+    {0x0000, 0, {0}},	/* FD */
+    {0x0000, 0, {0}},	/* FE */
+    {0x0000, 0, {0}},	/* FF */
+};
+
+static const ReverseData iso8859_6_rev[] =
+{
+    {0x060c, 0xAC},
+    {0x061b, 0xBB},
+    {0x061f, 0xBF},
+    {0x0621, 0xC1},
+    {0x0622, 0xC2},
+    {0x0623, 0xC3},
+    {0x0624, 0xC4},
+    {0x0625, 0xC5},
+    {0x0626, 0xC6},
+    {0x0627, 0xC7},
+    {0x0628, 0xC8},
+    {0x0629, 0xC9},
+    {0x062a, 0xCA},
+    {0x062b, 0xCB},
+    {0x062c, 0xCC},
+    {0x062d, 0xCD},
+    {0x062e, 0xCE},
+    {0x062f, 0xCF},
+    {0x0630, 0xD0},
+    {0x0631, 0xD1},
+    {0x0632, 0xD2},
+    {0x0633, 0xD3},
+    {0x0634, 0xD4},
+    {0x0635, 0xD5},
+    {0x0636, 0xD6},
+    {0x0637, 0xD7},
+    {0x0638, 0xD8},
+    {0x0639, 0xD9},
+    {0x063a, 0xDA},
+    {0x0640, 0xE0},
+    {0x0641, 0xE1},
+    {0x0642, 0xE2},
+    {0x0643, 0xE3},
+    {0x0644, 0xE4},
+    {0x0645, 0xE5},
+    {0x0646, 0xE6},
+    {0x0647, 0xE7},
+    {0x0648, 0xE8},
+    {0x0649, 0xE9},
+    {0x064a, 0xEA},
+    {0x064b, 0xEB},
+    {0x064c, 0xEC},
+    {0x064d, 0xED},
+    {0x064e, 0xEE},
+    {0x064f, 0xEF},
+    {0x0650, 0xF0},
+    {0x0651, 0xF1},
+    {0x0652, 0xF2},
+};
+
 static const BuiltInMapping iso8859_7[] =
 {
     /* iso8859-7 */
@@ -596,6 +3694,347 @@ static const BuiltInMapping iso8859_7[] =
     {0x00FE, 0x03CE},
 };
 
+static const MappingData iso8859_7_utf8[] =
+{
+    {0x0000, 0, {0}},	/* 00 */
+    {0x0001, 0, {0}},	/* 01 */
+    {0x0002, 0, {0}},	/* 02 */
+    {0x0003, 0, {0}},	/* 03 */
+    {0x0004, 0, {0}},	/* 04 */
+    {0x0005, 0, {0}},	/* 05 */
+    {0x0006, 0, {0}},	/* 06 */
+    {0x0007, 0, {0}},	/* 07 */
+    {0x0008, 0, {0}},	/* 08 */
+    {0x0009, 0, {0}},	/* 09 */
+    {0x000a, 0, {0}},	/* 0A */
+    {0x000b, 0, {0}},	/* 0B */
+    {0x000c, 0, {0}},	/* 0C */
+    {0x000d, 0, {0}},	/* 0D */
+    {0x000e, 0, {0}},	/* 0E */
+    {0x000f, 0, {0}},	/* 0F */
+    {0x0010, 0, {0}},	/* 10 */
+    {0x0011, 0, {0}},	/* 11 */
+    {0x0012, 0, {0}},	/* 12 */
+    {0x0013, 0, {0}},	/* 13 */
+    {0x0014, 0, {0}},	/* 14 */
+    {0x0015, 0, {0}},	/* 15 */
+    {0x0016, 0, {0}},	/* 16 */
+    {0x0017, 0, {0}},	/* 17 */
+    {0x0018, 0, {0}},	/* 18 */
+    {0x0019, 0, {0}},	/* 19 */
+    {0x001a, 0, {0}},	/* 1A */
+    {0x001b, 0, {0}},	/* 1B */
+    {0x001c, 0, {0}},	/* 1C */
+    {0x001d, 0, {0}},	/* 1D */
+    {0x001e, 0, {0}},	/* 1E */
+    {0x001f, 0, {0}},	/* 1F */
+    {0x0020, 0, {0}},	/* 20 */
+    {0x0021, 0, {0}},	/* 21 */
+    {0x0022, 0, {0}},	/* 22 */
+    {0x0023, 0, {0}},	/* 23 */
+    {0x0024, 0, {0}},	/* 24 */
+    {0x0025, 0, {0}},	/* 25 */
+    {0x0026, 0, {0}},	/* 26 */
+    {0x0027, 0, {0}},	/* 27 */
+    {0x0028, 0, {0}},	/* 28 */
+    {0x0029, 0, {0}},	/* 29 */
+    {0x002a, 0, {0}},	/* 2A */
+    {0x002b, 0, {0}},	/* 2B */
+    {0x002c, 0, {0}},	/* 2C */
+    {0x002d, 0, {0}},	/* 2D */
+    {0x002e, 0, {0}},	/* 2E */
+    {0x002f, 0, {0}},	/* 2F */
+    {0x0030, 0, {0}},	/* 30 */
+    {0x0031, 0, {0}},	/* 31 */
+    {0x0032, 0, {0}},	/* 32 */
+    {0x0033, 0, {0}},	/* 33 */
+    {0x0034, 0, {0}},	/* 34 */
+    {0x0035, 0, {0}},	/* 35 */
+    {0x0036, 0, {0}},	/* 36 */
+    {0x0037, 0, {0}},	/* 37 */
+    {0x0038, 0, {0}},	/* 38 */
+    {0x0039, 0, {0}},	/* 39 */
+    {0x003a, 0, {0}},	/* 3A */
+    {0x003b, 0, {0}},	/* 3B */
+    {0x003c, 0, {0}},	/* 3C */
+    {0x003d, 0, {0}},	/* 3D */
+    {0x003e, 0, {0}},	/* 3E */
+    {0x003f, 0, {0}},	/* 3F */
+    {0x0040, 0, {0}},	/* 40 */
+    {0x0041, 0, {0}},	/* 41 */
+    {0x0042, 0, {0}},	/* 42 */
+    {0x0043, 0, {0}},	/* 43 */
+    {0x0044, 0, {0}},	/* 44 */
+    {0x0045, 0, {0}},	/* 45 */
+    {0x0046, 0, {0}},	/* 46 */
+    {0x0047, 0, {0}},	/* 47 */
+    {0x0048, 0, {0}},	/* 48 */
+    {0x0049, 0, {0}},	/* 49 */
+    {0x004a, 0, {0}},	/* 4A */
+    {0x004b, 0, {0}},	/* 4B */
+    {0x004c, 0, {0}},	/* 4C */
+    {0x0000, 0, {0}},	/* 4D */
+    {0x0000, 0, {0}},	/* 4E */
+    {0x0000, 0, {0}},	/* 4F */
+    {0x0000, 0, {0}},	/* 50 */
+    {0x0000, 0, {0}},	/* 51 */
+    {0x0000, 0, {0}},	/* 52 */
+    {0x0000, 0, {0}},	/* 53 */
+    {0x0000, 0, {0}},	/* 54 */
+    {0x0000, 0, {0}},	/* 55 */
+    {0x0000, 0, {0}},	/* 56 */
+    {0x0000, 0, {0}},	/* 57 */
+    {0x0000, 0, {0}},	/* 58 */
+    {0x0000, 0, {0}},	/* 59 */
+    {0x0000, 0, {0}},	/* 5A */
+    {0x0000, 0, {0}},	/* 5B */
+    {0x0000, 0, {0}},	/* 5C */
+    {0x0000, 0, {0}},	/* 5D */
+    {0x0000, 0, {0}},	/* 5E */
+    {0x0000, 0, {0}},	/* 5F */
+    {0x0000, 0, {0}},	/* 60 */
+    {0x0000, 0, {0}},	/* 61 */
+    {0x0000, 0, {0}},	/* 62 */
+    {0x0000, 0, {0}},	/* 63 */
+    {0x0000, 0, {0}},	/* 64 */
+    {0x0000, 0, {0}},	/* 65 */
+    {0x0000, 0, {0}},	/* 66 */
+    {0x0000, 0, {0}},	/* 67 */
+    {0x0000, 0, {0}},	/* 68 */
+    {0x0000, 0, {0}},	/* 69 */
+    {0x0000, 0, {0}},	/* 6A */
+    {0x0000, 0, {0}},	/* 6B */
+    {0x0000, 0, {0}},	/* 6C */
+    {0x0000, 0, {0}},	/* 6D */
+    {0x0000, 0, {0}},	/* 6E */
+    {0x0000, 0, {0}},	/* 6F */
+    {0x0000, 0, {0}},	/* 70 */
+    {0x0000, 0, {0}},	/* 71 */
+    {0x0000, 0, {0}},	/* 72 */
+    {0x0000, 0, {0}},	/* 73 */
+    {0x0000, 0, {0}},	/* 74 */
+    {0x0000, 0, {0}},	/* 75 */
+    {0x0000, 0, {0}},	/* 76 */
+    {0x0000, 0, {0}},	/* 77 */
+    {0x0000, 0, {0}},	/* 78 */
+    {0x0000, 0, {0}},	/* 79 */
+    {0x0000, 0, {0}},	/* 7A */
+    {0x0000, 0, {0}},	/* 7B */
+    {0x0000, 0, {0}},	/* 7C */
+    {0x0000, 0, {0}},	/* 7D */
+    {0x0000, 0, {0}},	/* 7E */
+    {0x0000, 0, {0}},	/* 7F */
+    {0x0000, 0, {0}},	/* 80 */
+    {0x0000, 0, {0}},	/* 81 */
+    {0x0000, 0, {0}},	/* 82 */
+    {0x0000, 0, {0}},	/* 83 */
+    {0x0000, 0, {0}},	/* 84 */
+    {0x0000, 0, {0}},	/* 85 */
+    {0x0000, 0, {0}},	/* 86 */
+    {0x0000, 0, {0}},	/* 87 */
+    {0x0000, 0, {0}},	/* 88 */
+    {0x0000, 0, {0}},	/* 89 */
+    {0x0000, 0, {0}},	/* 8A */
+    {0x0000, 0, {0}},	/* 8B */
+    {0x0000, 0, {0}},	/* 8C */
+    {0x0000, 0, {0}},	/* 8D */
+    {0x0000, 0, {0}},	/* 8E */
+    {0x0000, 0, {0}},	/* 8F */
+    {0x0000, 0, {0}},	/* 90 */
+    {0x0000, 0, {0}},	/* 91 */
+    {0x0000, 0, {0}},	/* 92 */
+    {0x0000, 0, {0}},	/* 93 */
+    {0x0000, 0, {0}},	/* 94 */
+    {0x0000, 0, {0}},	/* 95 */
+    {0x0000, 0, {0}},	/* 96 */
+    {0x0000, 0, {0}},	/* 97 */
+    {0x0000, 0, {0}},	/* 98 */
+    {0x0000, 0, {0}},	/* 99 */
+    {0x0000, 0, {0}},	/* 9A */
+    {0x0000, 0, {0}},	/* 9B */
+    {0x0000, 0, {0}},	/* 9C */
+    {0x0000, 0, {0}},	/* 9D */
+    {0x0000, 0, {0}},	/* 9E */
+    {0x0000, 0, {0}},	/* 9F */
+    {0x0000, 0, {0}},	/* A0 */
+    {0x2018, 3, {0xe2, 0x80, 0x98}},	/* A1 */
+    {0x2019, 3, {0xe2, 0x80, 0x99}},	/* A2 */
+    {0x0000, 0, {0}},	/* A3 */
+    {0x20ac, 3, {0xe2, 0x82, 0xac}},	/* A4 */
+    {0x20af, 3, {0xe2, 0x82, 0xaf}},	/* A5 */
+    {0x0000, 0, {0}},	/* A6 */
+    {0x0000, 0, {0}},	/* A7 */
+    {0x0000, 0, {0}},	/* A8 */
+    {0x0000, 0, {0}},	/* A9 */
+    {0x037a, 2, {0xcd, 0xba}},	/* AA */
+    {0x0000, 0, {0}},	/* AB */
+    {0x0000, 0, {0}},	/* AC */
+    {0x0000, 0, {0}},	/* AD */
+    {0x0000, 0, {0}},	/* AE */
+    {0x2015, 3, {0xe2, 0x80, 0x95}},	/* AF */
+    {0x0000, 0, {0}},	/* B0 */
+    {0x0000, 0, {0}},	/* B1 */
+    {0x0000, 0, {0}},	/* B2 */
+    {0x0000, 0, {0}},	/* B3 */
+    {0x0384, 2, {0xce, 0x84}},	/* B4 */
+    {0x0385, 2, {0xce, 0x85}},	/* B5 */
+    {0x0386, 2, {0xce, 0x86}},	/* B6 */
+    {0x0000, 0, {0}},	/* B7 */
+    {0x0388, 2, {0xce, 0x88}},	/* B8 */
+    {0x0389, 2, {0xce, 0x89}},	/* B9 */
+    {0x038a, 2, {0xce, 0x8a}},	/* BA */
+    {0x0000, 0, {0}},	/* BB */
+    {0x038c, 2, {0xce, 0x8c}},	/* BC */
+    {0x0000, 0, {0}},	/* BD */
+    {0x038e, 2, {0xce, 0x8e}},	/* BE */
+    {0x038f, 2, {0xce, 0x8f}},	/* BF */
+    {0x0390, 2, {0xce, 0x90}},	/* C0 */
+    {0x0391, 2, {0xce, 0x91}},	/* C1 */
+    {0x0392, 2, {0xce, 0x92}},	/* C2 */
+    {0x0393, 2, {0xce, 0x93}},	/* C3 */
+    {0x0394, 2, {0xce, 0x94}},	/* C4 */
+    {0x0395, 2, {0xce, 0x95}},	/* C5 */
+    {0x0396, 2, {0xce, 0x96}},	/* C6 */
+    {0x0397, 2, {0xce, 0x97}},	/* C7 */
+    {0x0398, 2, {0xce, 0x98}},	/* C8 */
+    {0x0399, 2, {0xce, 0x99}},	/* C9 */
+    {0x039a, 2, {0xce, 0x9a}},	/* CA */
+    {0x039b, 2, {0xce, 0x9b}},	/* CB */
+    {0x039c, 2, {0xce, 0x9c}},	/* CC */
+    {0x039d, 2, {0xce, 0x9d}},	/* CD */
+    {0x039e, 2, {0xce, 0x9e}},	/* CE */
+    {0x039f, 2, {0xce, 0x9f}},	/* CF */
+    {0x03a0, 2, {0xce, 0xa0}},	/* D0 */
+    {0x03a1, 2, {0xce, 0xa1}},	/* D1 */
+    {0x0000, 0, {0}},	/* D2 */
+    {0x03a3, 2, {0xce, 0xa3}},	/* D3 */
+    {0x03a4, 2, {0xce, 0xa4}},	/* D4 */
+    {0x03a5, 2, {0xce, 0xa5}},	/* D5 */
+    {0x03a6, 2, {0xce, 0xa6}},	/* D6 */
+    {0x03a7, 2, {0xce, 0xa7}},	/* D7 */
+    {0x03a8, 2, {0xce, 0xa8}},	/* D8 */
+    {0x03a9, 2, {0xce, 0xa9}},	/* D9 */
+    {0x03aa, 2, {0xce, 0xaa}},	/* DA */
+    {0x03ab, 2, {0xce, 0xab}},	/* DB */
+    {0x03ac, 2, {0xce, 0xac}},	/* DC */
+    {0x03ad, 2, {0xce, 0xad}},	/* DD */
+    {0x03ae, 2, {0xce, 0xae}},	/* DE */
+    {0x03af, 2, {0xce, 0xaf}},	/* DF */
+    {0x03b0, 2, {0xce, 0xb0}},	/* E0 */
+    {0x03b1, 2, {0xce, 0xb1}},	/* E1 */
+    {0x03b2, 2, {0xce, 0xb2}},	/* E2 */
+    {0x03b3, 2, {0xce, 0xb3}},	/* E3 */
+    {0x03b4, 2, {0xce, 0xb4}},	/* E4 */
+    {0x03b5, 2, {0xce, 0xb5}},	/* E5 */
+    {0x03b6, 2, {0xce, 0xb6}},	/* E6 */
+    {0x03b7, 2, {0xce, 0xb7}},	/* E7 */
+    {0x03b8, 2, {0xce, 0xb8}},	/* E8 */
+    {0x03b9, 2, {0xce, 0xb9}},	/* E9 */
+    {0x03ba, 2, {0xce, 0xba}},	/* EA */
+    {0x03bb, 2, {0xce, 0xbb}},	/* EB */
+    {0x03bc, 2, {0xce, 0xbc}},	/* EC */
+    {0x03bd, 2, {0xce, 0xbd}},	/* ED */
+    {0x03be, 2, {0xce, 0xbe}},	/* EE */
+    {0x03bf, 2, {0xce, 0xbf}},	/* EF */
+    {0x03c0, 2, {0xcf, 0x80}},	/* F0 */
+    {0x03c1, 2, {0xcf, 0x81}},	/* F1 */
+    {0x03c2, 2, {0xcf, 0x82}},	/* F2 */
+    {0x03c3, 2, {0xcf, 0x83}},	/* F3 */
+    {0x03c4, 2, {0xcf, 0x84}},	/* F4 */
+    {0x03c5, 2, {0xcf, 0x85}},	/* F5 */
+    {0x03c6, 2, {0xcf, 0x86}},	/* F6 */
+    {0x03c7, 2, {0xcf, 0x87}},	/* F7 */
+    {0x03c8, 2, {0xcf, 0x88}},	/* F8 */
+    {0x03c9, 2, {0xcf, 0x89}},	/* F9 */
+    {0x03ca, 2, {0xcf, 0x8a}},	/* FA */
+    {0x03cb, 2, {0xcf, 0x8b}},	/* FB */
+    {0x03cc, 2, {0xcf, 0x8c}},	/* FC */
+    {0x03cd, 2, {0xcf, 0x8d}},	/* FD */
+    {0x03ce, 2, {0xcf, 0x8e}},	/* FE */
+    {0x0000, 0, {0}},	/* FF */
+};
+
+static const ReverseData iso8859_7_rev[] =
+{
+    {0x037a, 0xAA},
+    {0x0384, 0xB4},
+    {0x0385, 0xB5},
+    {0x0386, 0xB6},
+    {0x0388, 0xB8},
+    {0x0389, 0xB9},
+    {0x038a, 0xBA},
+    {0x038c, 0xBC},
+    {0x038e, 0xBE},
+    {0x038f, 0xBF},
+    {0x0390, 0xC0},
+    {0x0391, 0xC1},
+    {0x0392, 0xC2},
+    {0x0393, 0xC3},
+    {0x0394, 0xC4},
+    {0x0395, 0xC5},
+    {0x0396, 0xC6},
+    {0x0397, 0xC7},
+    {0x0398, 0xC8},
+    {0x0399, 0xC9},
+    {0x039a, 0xCA},
+    {0x039b, 0xCB},
+    {0x039c, 0xCC},
+    {0x039d, 0xCD},
+    {0x039e, 0xCE},
+    {0x039f, 0xCF},
+    {0x03a0, 0xD0},
+    {0x03a1, 0xD1},
+    {0x03a3, 0xD3},
+    {0x03a4, 0xD4},
+    {0x03a5, 0xD5},
+    {0x03a6, 0xD6},
+    {0x03a7, 0xD7},
+    {0x03a8, 0xD8},
+    {0x03a9, 0xD9},
+    {0x03aa, 0xDA},
+    {0x03ab, 0xDB},
+    {0x03ac, 0xDC},
+    {0x03ad, 0xDD},
+    {0x03ae, 0xDE},
+    {0x03af, 0xDF},
+    {0x03b0, 0xE0},
+    {0x03b1, 0xE1},
+    {0x03b2, 0xE2},
+    {0x03b3, 0xE3},
+    {0x03b4, 0xE4},
+    {0x03b5, 0xE5},
+    {0x03b6, 0xE6},
+    {0x03b7, 0xE7},
+    {0x03b8, 0xE8},
+    {0x03b9, 0xE9},
+    {0x03ba, 0xEA},
+    {0x03bb, 0xEB},
+    {0x03bc, 0xEC},
+    {0x03bd, 0xED},
+    {0x03be, 0xEE},
+    {0x03bf, 0xEF},
+    {0x03c0, 0xF0},
+    {0x03c1, 0xF1},
+    {0x03c2, 0xF2},
+    {0x03c3, 0xF3},
+    {0x03c4, 0xF4},
+    {0x03c5, 0xF5},
+    {0x03c6, 0xF6},
+    {0x03c7, 0xF7},
+    {0x03c8, 0xF8},
+    {0x03c9, 0xF9},
+    {0x03ca, 0xFA},
+    {0x03cb, 0xFB},
+    {0x03cc, 0xFC},
+    {0x03cd, 0xFD},
+    {0x03ce, 0xFE},
+    {0x2015, 0xAF},
+    {0x2018, 0xA1},
+    {0x2019, 0xA2},
+    {0x20ac, 0xA4},
+    {0x20af, 0xA5},
+};
+
 static const BuiltInMapping iso8859_8[] =
 {
     /* iso8859-8 */
@@ -633,6 +4072,302 @@ static const BuiltInMapping iso8859_8[] =
     {0x00FE, 0x200F},
 };
 
+static const MappingData iso8859_8_utf8[] =
+{
+    {0x0000, 0, {0}},	/* 00 */
+    {0x0001, 0, {0}},	/* 01 */
+    {0x0002, 0, {0}},	/* 02 */
+    {0x0003, 0, {0}},	/* 03 */
+    {0x0004, 0, {0}},	/* 04 */
+    {0x0005, 0, {0}},	/* 05 */
+    {0x0006, 0, {0}},	/* 06 */
+    {0x0007, 0, {0}},	/* 07 */
+    {0x0008, 0, {0}},	/* 08 */
+    {0x0009, 0, {0}},	/* 09 */
+    {0x000a, 0, {0}},	/* 0A */
+    {0x000b, 0, {0}},	/* 0B */
+    {0x000c, 0, {0}},	/* 0C */
+    {0x000d, 0, {0}},	/* 0D */
+    {0x000e, 0, {0}},	/* 0E */
+    {0x000f, 0, {0}},	/* 0F */
+    {0x0010, 0, {0}},	/* 10 */
+    {0x0011, 0, {0}},	/* 11 */
+    {0x0012, 0, {0}},	/* 12 */
+    {0x0013, 0, {0}},	/* 13 */
+    {0x0014, 0, {0}},	/* 14 */
+    {0x0015, 0, {0}},	/* 15 */
+    {0x0016, 0, {0}},	/* 16 */
+    {0x0017, 0, {0}},	/* 17 */
+    {0x0018, 0, {0}},	/* 18 */
+    {0x0019, 0, {0}},	/* 19 */
+    {0x001a, 0, {0}},	/* 1A */
+    {0x001b, 0, {0}},	/* 1B */
+    {0x001c, 0, {0}},	/* 1C */
+    {0x001d, 0, {0}},	/* 1D */
+    {0x001e, 0, {0}},	/* 1E */
+    {0x001f, 0, {0}},	/* 1F */
+    {0x0000, 0, {0}},	/* 20 */
+    {0x0000, 0, {0}},	/* 21 */
+    {0x0000, 0, {0}},	/* 22 */
+    {0x0000, 0, {0}},	/* 23 */
+    {0x0000, 0, {0}},	/* 24 */
+    {0x0000, 0, {0}},	/* 25 */
+    {0x0000, 0, {0}},	/* 26 */
+    {0x0000, 0, {0}},	/* 27 */
+    {0x0000, 0, {0}},	/* 28 */
+    {0x0000, 0, {0}},	/* 29 */
+    {0x0000, 0, {0}},	/* 2A */
+    {0x0000, 0, {0}},	/* 2B */
+    {0x0000, 0, {0}},	/* 2C */
+    {0x0000, 0, {0}},	/* 2D */
+    {0x0000, 0, {0}},	/* 2E */
+    {0x0000, 0, {0}},	/* 2F */
+    {0x0000, 0, {0}},	/* 30 */
+    {0x0000, 0, {0}},	/* 31 */
+    {0x0000, 0, {0}},	/* 32 */
+    {0x0000, 0, {0}},	/* 33 */
+    {0x0000, 0, {0}},	/* 34 */
+    {0x0000, 0, {0}},	/* 35 */
+    {0x0000, 0, {0}},	/* 36 */
+    {0x0000, 0, {0}},	/* 37 */
+    {0x0000, 0, {0}},	/* 38 */
+    {0x0000, 0, {0}},	/* 39 */
+    {0x0000, 0, {0}},	/* 3A */
+    {0x0000, 0, {0}},	/* 3B */
+    {0x0000, 0, {0}},	/* 3C */
+    {0x0000, 0, {0}},	/* 3D */
+    {0x0000, 0, {0}},	/* 3E */
+    {0x0000, 0, {0}},	/* 3F */
+    {0x0000, 0, {0}},	/* 40 */
+    {0x0000, 0, {0}},	/* 41 */
+    {0x0000, 0, {0}},	/* 42 */
+    {0x0000, 0, {0}},	/* 43 */
+    {0x0000, 0, {0}},	/* 44 */
+    {0x0000, 0, {0}},	/* 45 */
+    {0x0000, 0, {0}},	/* 46 */
+    {0x0000, 0, {0}},	/* 47 */
+    {0x0000, 0, {0}},	/* 48 */
+    {0x0000, 0, {0}},	/* 49 */
+    {0x0000, 0, {0}},	/* 4A */
+    {0x0000, 0, {0}},	/* 4B */
+    {0x0000, 0, {0}},	/* 4C */
+    {0x0000, 0, {0}},	/* 4D */
+    {0x0000, 0, {0}},	/* 4E */
+    {0x0000, 0, {0}},	/* 4F */
+    {0x0000, 0, {0}},	/* 50 */
+    {0x0000, 0, {0}},	/* 51 */
+    {0x0000, 0, {0}},	/* 52 */
+    {0x0000, 0, {0}},	/* 53 */
+    {0x0000, 0, {0}},	/* 54 */
+    {0x0000, 0, {0}},	/* 55 */
+    {0x0000, 0, {0}},	/* 56 */
+    {0x0000, 0, {0}},	/* 57 */
+    {0x0000, 0, {0}},	/* 58 */
+    {0x0000, 0, {0}},	/* 59 */
+    {0x0000, 0, {0}},	/* 5A */
+    {0x0000, 0, {0}},	/* 5B */
+    {0x0000, 0, {0}},	/* 5C */
+    {0x0000, 0, {0}},	/* 5D */
+    {0x0000, 0, {0}},	/* 5E */
+    {0x0000, 0, {0}},	/* 5F */
+    {0x0000, 0, {0}},	/* 60 */
+    {0x0000, 0, {0}},	/* 61 */
+    {0x0000, 0, {0}},	/* 62 */
+    {0x0000, 0, {0}},	/* 63 */
+    {0x0000, 0, {0}},	/* 64 */
+    {0x0000, 0, {0}},	/* 65 */
+    {0x0000, 0, {0}},	/* 66 */
+    {0x0000, 0, {0}},	/* 67 */
+    {0x0000, 0, {0}},	/* 68 */
+    {0x0000, 0, {0}},	/* 69 */
+    {0x0000, 0, {0}},	/* 6A */
+    {0x0000, 0, {0}},	/* 6B */
+    {0x0000, 0, {0}},	/* 6C */
+    {0x0000, 0, {0}},	/* 6D */
+    {0x0000, 0, {0}},	/* 6E */
+    {0x0000, 0, {0}},	/* 6F */
+    {0x0000, 0, {0}},	/* 70 */
+    {0x0000, 0, {0}},	/* 71 */
+    {0x0000, 0, {0}},	/* 72 */
+    {0x0000, 0, {0}},	/* 73 */
+    {0x0000, 0, {0}},	/* 74 */
+    {0x0000, 0, {0}},	/* 75 */
+    {0x0000, 0, {0}},	/* 76 */
+    {0x0000, 0, {0}},	/* 77 */
+    {0x0000, 0, {0}},	/* 78 */
+    {0x0000, 0, {0}},	/* 79 */
+    {0x0000, 0, {0}},	/* 7A */
+    {0x0000, 0, {0}},	/* 7B */
+    {0x0000, 0, {0}},	/* 7C */
+    {0x0000, 0, {0}},	/* 7D */
+    {0x0000, 0, {0}},	/* 7E */
+    {0x0000, 0, {0}},	/* 7F */
+    {0x0000, 0, {0}},	/* 80 */
+    {0x0000, 0, {0}},	/* 81 */
+    {0x0000, 0, {0}},	/* 82 */
+    {0x0000, 0, {0}},	/* 83 */
+    {0x0000, 0, {0}},	/* 84 */
+    {0x0000, 0, {0}},	/* 85 */
+    {0x0000, 0, {0}},	/* 86 */
+    {0x0000, 0, {0}},	/* 87 */
+    {0x0000, 0, {0}},	/* 88 */
+    {0x0000, 0, {0}},	/* 89 */
+    {0x0000, 0, {0}},	/* 8A */
+    {0x0000, 0, {0}},	/* 8B */
+    {0x0000, 0, {0}},	/* 8C */
+    {0x0000, 0, {0}},	/* 8D */
+    {0x0000, 0, {0}},	/* 8E */
+    {0x0000, 0, {0}},	/* 8F */
+    {0x0000, 0, {0}},	/* 90 */
+    {0x0000, 0, {0}},	/* 91 */
+    {0x0000, 0, {0}},	/* 92 */
+    {0x0000, 0, {0}},	/* 93 */
+    {0x0000, 0, {0}},	/* 94 */
+    {0x0000, 0, {0}},	/* 95 */
+    {0x0000, 0, {0}},	/* 96 */
+    {0x0000, 0, {0}},	/* 97 */
+    {0x0000, 0, {0}},	/* 98 */
+    {0x0000, 0, {0}},	/* 99 */
+    {0x0000, 0, {0}},	/* 9A */
+    {0x0000, 0, {0}},	/* 9B */
+    {0x0000, 0, {0}},	/* 9C */
+    {0x0000, 0, {0}},	/* 9D */
+    {0x0000, 0, {0}},	/* 9E */
+    {0x0000, 0, {0}},	/* 9F */
+    {0x0000, 0, {0}},	/* A0 */
+    {0x0000, 0, {0}},	/* A1 */
+    {0x0000, 0, {0}},	/* A2 */
+    {0x0000, 0, {0}},	/* A3 */
+    {0x0000, 0, {0}},	/* A4 */
+    {0x0000, 0, {0}},	/* A5 */
+    {0x0000, 0, {0}},	/* A6 */
+    {0x0000, 0, {0}},	/* A7 */
+    {0x0000, 0, {0}},	/* A8 */
+    {0x0000, 0, {0}},	/* A9 */
+    {0x00d7, 2, {0xc3, 0x97}},	/* AA */
+    {0x0000, 0, {0}},	/* AB */
+    {0x0000, 0, {0}},	/* AC */
+    {0x0000, 0, {0}},	/* AD */
+    {0x0000, 0, {0}},	/* AE */
+    {0x0000, 0, {0}},	/* AF */
+    {0x0000, 0, {0}},	/* B0 */
+    {0x0000, 0, {0}},	/* B1 */
+    {0x0000, 0, {0}},	/* B2 */
+    {0x0000, 0, {0}},	/* B3 */
+    {0x0000, 0, {0}},	/* B4 */
+    {0x0000, 0, {0}},	/* B5 */
+    {0x0000, 0, {0}},	/* B6 */
+    {0x0000, 0, {0}},	/* B7 */
+    {0x0000, 0, {0}},	/* B8 */
+    {0x0000, 0, {0}},	/* B9 */
+    {0x00f7, 2, {0xc3, 0xb7}},	/* BA */
+    {0x0000, 0, {0}},	/* BB */
+    {0x0000, 0, {0}},	/* BC */
+    {0x0000, 0, {0}},	/* BD */
+    {0x0000, 0, {0}},	/* BE */
+    {0x0000, 0, {0}},	/* BF */
+    {0x0000, 0, {0}},	/* C0 */
+    {0x0000, 0, {0}},	/* C1 */
+    {0x0000, 0, {0}},	/* C2 */
+    {0x0000, 0, {0}},	/* C3 */
+    {0x0000, 0, {0}},	/* C4 */
+    {0x0000, 0, {0}},	/* C5 */
+    {0x0000, 0, {0}},	/* C6 */
+    {0x0000, 0, {0}},	/* C7 */
+    {0x0000, 0, {0}},	/* C8 */
+    {0x0000, 0, {0}},	/* C9 */
+    {0x0000, 0, {0}},	/* CA */
+    {0x0000, 0, {0}},	/* CB */
+    {0x0000, 0, {0}},	/* CC */
+    {0x0000, 0, {0}},	/* CD */
+    {0x0000, 0, {0}},	/* CE */
+    {0x0000, 0, {0}},	/* CF */
+    {0x0000, 0, {0}},	/* D0 */
+    {0x0000, 0, {0}},	/* D1 */
+    {0x0000, 0, {0}},	/* D2 */
+    {0x0000, 0, {0}},	/* D3 */
+    {0x0000, 0, {0}},	/* D4 */
+    {0x0000, 0, {0}},	/* D5 */
+    {0x0000, 0, {0}},	/* D6 */
+    {0x0000, 0, {0}},	/* D7 */
+    {0x0000, 0, {0}},	/* D8 */
+    {0x0000, 0, {0}},	/* D9 */
+    {0x0000, 0, {0}},	/* DA */
+    {0x0000, 0, {0}},	/* DB */
+    {0x0000, 0, {0}},	/* DC */
+    {0x0000, 0, {0}},	/* DD */
+    {0x0000, 0, {0}},	/* DE */
+    {0x2017, 3, {0xe2, 0x80, 0x97}},	/* DF */
+    {0x05d0, 2, {0xd7, 0x90}},	/* E0 */
+    {0x05d1, 2, {0xd7, 0x91}},	/* E1 */
+    {0x05d2, 2, {0xd7, 0x92}},	/* E2 */
+    {0x05d3, 2, {0xd7, 0x93}},	/* E3 */
+    {0x05d4, 2, {0xd7, 0x94}},	/* E4 */
+    {0x05d5, 2, {0xd7, 0x95}},	/* E5 */
+    {0x05d6, 2, {0xd7, 0x96}},	/* E6 */
+    {0x05d7, 2, {0xd7, 0x97}},	/* E7 */
+    {0x05d8, 2, {0xd7, 0x98}},	/* E8 */
+    {0x05d9, 2, {0xd7, 0x99}},	/* E9 */
+    {0x05da, 2, {0xd7, 0x9a}},	/* EA */
+    {0x05db, 2, {0xd7, 0x9b}},	/* EB */
+    {0x05dc, 2, {0xd7, 0x9c}},	/* EC */
+    {0x05dd, 2, {0xd7, 0x9d}},	/* ED */
+    {0x05de, 2, {0xd7, 0x9e}},	/* EE */
+    {0x05df, 2, {0xd7, 0x9f}},	/* EF */
+    {0x05e0, 2, {0xd7, 0xa0}},	/* F0 */
+    {0x05e1, 2, {0xd7, 0xa1}},	/* F1 */
+    {0x05e2, 2, {0xd7, 0xa2}},	/* F2 */
+    {0x05e3, 2, {0xd7, 0xa3}},	/* F3 */
+    {0x05e4, 2, {0xd7, 0xa4}},	/* F4 */
+    {0x05e5, 2, {0xd7, 0xa5}},	/* F5 */
+    {0x05e6, 2, {0xd7, 0xa6}},	/* F6 */
+    {0x05e7, 2, {0xd7, 0xa7}},	/* F7 */
+    {0x05e8, 2, {0xd7, 0xa8}},	/* F8 */
+    {0x05e9, 2, {0xd7, 0xa9}},	/* F9 */
+    {0x05ea, 2, {0xd7, 0xaa}},	/* FA */
+    {0x0000, 0, {0}},	/* FB */
+    {0x0000, 0, {0}},	/* FC */
+    {0x200e, 3, {0xe2, 0x80, 0x8e}},	/* FD */
+    {0x200f, 3, {0xe2, 0x80, 0x8f}},	/* FE */
+    {0x0000, 0, {0}},	/* FF */
+};
+
+static const ReverseData iso8859_8_rev[] =
+{
+    {0x00d7, 0xAA},
+    {0x00f7, 0xBA},
+    {0x05d0, 0xE0},
+    {0x05d1, 0xE1},
+    {0x05d2, 0xE2},
+    {0x05d3, 0xE3},
+    {0x05d4, 0xE4},
+    {0x05d5, 0xE5},
+    {0x05d6, 0xE6},
+    {0x05d7, 0xE7},
+    {0x05d8, 0xE8},
+    {0x05d9, 0xE9},
+    {0x05da, 0xEA},
+    {0x05db, 0xEB},
+    {0x05dc, 0xEC},
+    {0x05dd, 0xED},
+    {0x05de, 0xEE},
+    {0x05df, 0xEF},
+    {0x05e0, 0xF0},
+    {0x05e1, 0xF1},
+    {0x05e2, 0xF2},
+    {0x05e3, 0xF3},
+    {0x05e4, 0xF4},
+    {0x05e5, 0xF5},
+    {0x05e6, 0xF6},
+    {0x05e7, 0xF7},
+    {0x05e8, 0xF8},
+    {0x05e9, 0xF9},
+    {0x05ea, 0xFA},
+    {0x200e, 0xFD},
+    {0x200f, 0xFE},
+    {0x2017, 0xDF},
+};
+
 static const BuiltInMapping iso8859_9[] =
 {
     /* iso8859-9 */
@@ -644,6 +4379,276 @@ static const BuiltInMapping iso8859_9[] =
     {0x00FE, 0x015F},
 };
 
+static const MappingData iso8859_9_utf8[] =
+{
+    {0x0000, 0, {0}},	/* 00 */
+    {0x0001, 0, {0}},	/* 01 */
+    {0x0002, 0, {0}},	/* 02 */
+    {0x0003, 0, {0}},	/* 03 */
+    {0x0004, 0, {0}},	/* 04 */
+    {0x0005, 0, {0}},	/* 05 */
+    {0x0000, 0, {0}},	/* 06 */
+    {0x0000, 0, {0}},	/* 07 */
+    {0x0000, 0, {0}},	/* 08 */
+    {0x0000, 0, {0}},	/* 09 */
+    {0x0000, 0, {0}},	/* 0A */
+    {0x0000, 0, {0}},	/* 0B */
+    {0x0000, 0, {0}},	/* 0C */
+    {0x0000, 0, {0}},	/* 0D */
+    {0x0000, 0, {0}},	/* 0E */
+    {0x0000, 0, {0}},	/* 0F */
+    {0x0000, 0, {0}},	/* 10 */
+    {0x0000, 0, {0}},	/* 11 */
+    {0x0000, 0, {0}},	/* 12 */
+    {0x0000, 0, {0}},	/* 13 */
+    {0x0000, 0, {0}},	/* 14 */
+    {0x0000, 0, {0}},	/* 15 */
+    {0x0000, 0, {0}},	/* 16 */
+    {0x0000, 0, {0}},	/* 17 */
+    {0x0000, 0, {0}},	/* 18 */
+    {0x0000, 0, {0}},	/* 19 */
+    {0x0000, 0, {0}},	/* 1A */
+    {0x0000, 0, {0}},	/* 1B */
+    {0x0000, 0, {0}},	/* 1C */
+    {0x0000, 0, {0}},	/* 1D */
+    {0x0000, 0, {0}},	/* 1E */
+    {0x0000, 0, {0}},	/* 1F */
+    {0x0000, 0, {0}},	/* 20 */
+    {0x0000, 0, {0}},	/* 21 */
+    {0x0000, 0, {0}},	/* 22 */
+    {0x0000, 0, {0}},	/* 23 */
+    {0x0000, 0, {0}},	/* 24 */
+    {0x0000, 0, {0}},	/* 25 */
+    {0x0000, 0, {0}},	/* 26 */
+    {0x0000, 0, {0}},	/* 27 */
+    {0x0000, 0, {0}},	/* 28 */
+    {0x0000, 0, {0}},	/* 29 */
+    {0x0000, 0, {0}},	/* 2A */
+    {0x0000, 0, {0}},	/* 2B */
+    {0x0000, 0, {0}},	/* 2C */
+    {0x0000, 0, {0}},	/* 2D */
+    {0x0000, 0, {0}},	/* 2E */
+    {0x0000, 0, {0}},	/* 2F */
+    {0x0000, 0, {0}},	/* 30 */
+    {0x0000, 0, {0}},	/* 31 */
+    {0x0000, 0, {0}},	/* 32 */
+    {0x0000, 0, {0}},	/* 33 */
+    {0x0000, 0, {0}},	/* 34 */
+    {0x0000, 0, {0}},	/* 35 */
+    {0x0000, 0, {0}},	/* 36 */
+    {0x0000, 0, {0}},	/* 37 */
+    {0x0000, 0, {0}},	/* 38 */
+    {0x0000, 0, {0}},	/* 39 */
+    {0x0000, 0, {0}},	/* 3A */
+    {0x0000, 0, {0}},	/* 3B */
+    {0x0000, 0, {0}},	/* 3C */
+    {0x0000, 0, {0}},	/* 3D */
+    {0x0000, 0, {0}},	/* 3E */
+    {0x0000, 0, {0}},	/* 3F */
+    {0x0000, 0, {0}},	/* 40 */
+    {0x0000, 0, {0}},	/* 41 */
+    {0x0000, 0, {0}},	/* 42 */
+    {0x0000, 0, {0}},	/* 43 */
+    {0x0000, 0, {0}},	/* 44 */
+    {0x0000, 0, {0}},	/* 45 */
+    {0x0000, 0, {0}},	/* 46 */
+    {0x0000, 0, {0}},	/* 47 */
+    {0x0000, 0, {0}},	/* 48 */
+    {0x0000, 0, {0}},	/* 49 */
+    {0x0000, 0, {0}},	/* 4A */
+    {0x0000, 0, {0}},	/* 4B */
+    {0x0000, 0, {0}},	/* 4C */
+    {0x0000, 0, {0}},	/* 4D */
+    {0x0000, 0, {0}},	/* 4E */
+    {0x0000, 0, {0}},	/* 4F */
+    {0x0000, 0, {0}},	/* 50 */
+    {0x0000, 0, {0}},	/* 51 */
+    {0x0000, 0, {0}},	/* 52 */
+    {0x0000, 0, {0}},	/* 53 */
+    {0x0000, 0, {0}},	/* 54 */
+    {0x0000, 0, {0}},	/* 55 */
+    {0x0000, 0, {0}},	/* 56 */
+    {0x0000, 0, {0}},	/* 57 */
+    {0x0000, 0, {0}},	/* 58 */
+    {0x0000, 0, {0}},	/* 59 */
+    {0x0000, 0, {0}},	/* 5A */
+    {0x0000, 0, {0}},	/* 5B */
+    {0x0000, 0, {0}},	/* 5C */
+    {0x0000, 0, {0}},	/* 5D */
+    {0x0000, 0, {0}},	/* 5E */
+    {0x0000, 0, {0}},	/* 5F */
+    {0x0000, 0, {0}},	/* 60 */
+    {0x0000, 0, {0}},	/* 61 */
+    {0x0000, 0, {0}},	/* 62 */
+    {0x0000, 0, {0}},	/* 63 */
+    {0x0000, 0, {0}},	/* 64 */
+    {0x0000, 0, {0}},	/* 65 */
+    {0x0000, 0, {0}},	/* 66 */
+    {0x0000, 0, {0}},	/* 67 */
+    {0x0000, 0, {0}},	/* 68 */
+    {0x0000, 0, {0}},	/* 69 */
+    {0x0000, 0, {0}},	/* 6A */
+    {0x0000, 0, {0}},	/* 6B */
+    {0x0000, 0, {0}},	/* 6C */
+    {0x0000, 0, {0}},	/* 6D */
+    {0x0000, 0, {0}},	/* 6E */
+    {0x0000, 0, {0}},	/* 6F */
+    {0x0000, 0, {0}},	/* 70 */
+    {0x0000, 0, {0}},	/* 71 */
+    {0x0000, 0, {0}},	/* 72 */
+    {0x0000, 0, {0}},	/* 73 */
+    {0x0000, 0, {0}},	/* 74 */
+    {0x0000, 0, {0}},	/* 75 */
+    {0x0000, 0, {0}},	/* 76 */
+    {0x0000, 0, {0}},	/* 77 */
+    {0x0000, 0, {0}},	/* 78 */
+    {0x0000, 0, {0}},	/* 79 */
+    {0x0000, 0, {0}},	/* 7A */
+    {0x0000, 0, {0}},	/* 7B */
+    {0x0000, 0, {0}},	/* 7C */
+    {0x0000, 0, {0}},	/* 7D */
+    {0x0000, 0, {0}},	/* 7E */
+    {0x0000, 0, {0}},	/* 7F */
+    {0x0000, 0, {0}},	/* 80 */
+    {0x0000, 0, {0}},	/* 81 */
+    {0x0000, 0, {0}},	/* 82 */
+    {0x0000, 0, {0}},	/* 83 */
+    {0x0000, 0, {0}},	/* 84 */
+    {0x0000, 0, {0}},	/* 85 */
+    {0x0000, 0, {0}},	/* 86 */
+    {0x0000, 0, {0}},	/* 87 */
+    {0x0000, 0, {0}},	/* 88 */
+    {0x0000, 0, {0}},	/* 89 */
+    {0x0000, 0, {0}},	/* 8A */
+    {0x0000, 0, {0}},	/* 8B */
+    {0x0000, 0, {0}},	/* 8C */
+    {0x0000, 0, {0}},	/* 8D */
+    {0x0000, 0, {0}},	/* 8E */
+    {0x0000, 0, {0}},	/* 8F */
+    {0x0000, 0, {0}},	/* 90 */
+    {0x0000, 0, {0}},	/* 91 */
+    {0x0000, 0, {0}},	/* 92 */
+    {0x0000, 0, {0}},	/* 93 */
+    {0x0000, 0, {0}},	/* 94 */
+    {0x0000, 0, {0}},	/* 95 */
+    {0x0000, 0, {0}},	/* 96 */
+    {0x0000, 0, {0}},	/* 97 */
+    {0x0000, 0, {0}},	/* 98 */
+    {0x0000, 0, {0}},	/* 99 */
+    {0x0000, 0, {0}},	/* 9A */
+    {0x0000, 0, {0}},	/* 9B */
+    {0x0000, 0, {0}},	/* 9C */
+    {0x0000, 0, {0}},	/* 9D */
+    {0x0000, 0, {0}},	/* 9E */
+    {0x0000, 0, {0}},	/* 9F */
+    {0x0000, 0, {0}},	/* A0 */
+    {0x0000, 0, {0}},	/* A1 */
+    {0x0000, 0, {0}},	/* A2 */
+    {0x0000, 0, {0}},	/* A3 */
+    {0x0000, 0, {0}},	/* A4 */
+    {0x0000, 0, {0}},	/* A5 */
+    {0x0000, 0, {0}},	/* A6 */
+    {0x0000, 0, {0}},	/* A7 */
+    {0x0000, 0, {0}},	/* A8 */
+    {0x0000, 0, {0}},	/* A9 */
+    {0x0000, 0, {0}},	/* AA */
+    {0x0000, 0, {0}},	/* AB */
+    {0x0000, 0, {0}},	/* AC */
+    {0x0000, 0, {0}},	/* AD */
+    {0x0000, 0, {0}},	/* AE */
+    {0x0000, 0, {0}},	/* AF */
+    {0x0000, 0, {0}},	/* B0 */
+    {0x0000, 0, {0}},	/* B1 */
+    {0x0000, 0, {0}},	/* B2 */
+    {0x0000, 0, {0}},	/* B3 */
+    {0x0000, 0, {0}},	/* B4 */
+    {0x0000, 0, {0}},	/* B5 */
+    {0x0000, 0, {0}},	/* B6 */
+    {0x0000, 0, {0}},	/* B7 */
+    {0x0000, 0, {0}},	/* B8 */
+    {0x0000, 0, {0}},	/* B9 */
+    {0x0000, 0, {0}},	/* BA */
+    {0x0000, 0, {0}},	/* BB */
+    {0x0000, 0, {0}},	/* BC */
+    {0x0000, 0, {0}},	/* BD */
+    {0x0000, 0, {0}},	/* BE */
+    {0x0000, 0, {0}},	/* BF */
+    {0x0000, 0, {0}},	/* C0 */
+    {0x0000, 0, {0}},	/* C1 */
+    {0x0000, 0, {0}},	/* C2 */
+    {0x0000, 0, {0}},	/* C3 */
+    {0x0000, 0, {0}},	/* C4 */
+    {0x0000, 0, {0}},	/* C5 */
+    {0x0000, 0, {0}},	/* C6 */
+    {0x0000, 0, {0}},	/* C7 */
+    {0x0000, 0, {0}},	/* C8 */
+    {0x0000, 0, {0}},	/* C9 */
+    {0x0000, 0, {0}},	/* CA */
+    {0x0000, 0, {0}},	/* CB */
+    {0x0000, 0, {0}},	/* CC */
+    {0x0000, 0, {0}},	/* CD */
+    {0x0000, 0, {0}},	/* CE */
+    {0x0000, 0, {0}},	/* CF */
+    {0x011e, 2, {0xc4, 0x9e}},	/* D0 */
+    {0x0000, 0, {0}},	/* D1 */
+    {0x0000, 0, {0}},	/* D2 */
+    {0x0000, 0, {0}},	/* D3 */
+    {0x0000, 0, {0}},	/* D4 */
+    {0x0000, 0, {0}},	/* D5 */
+    {0x0000, 0, {0}},	/* D6 */
+    {0x0000, 0, {0}},	/* D7 */
+    {0x0000, 0, {0}},	/* D8 */
+    {0x0000, 0, {0}},	/* D9 */
+    {0x0000, 0, {0}},	/* DA */
+    {0x0000, 0, {0}},	/* DB */
+    {0x0000, 0, {0}},	/* DC */
+    {0x0130, 2, {0xc4, 0xb0}},	/* DD */
+    {0x015e, 2, {0xc5, 0x9e}},	/* DE */
+    {0x0000, 0, {0}},	/* DF */
+    {0x0000, 0, {0}},	/* E0 */
+    {0x0000, 0, {0}},	/* E1 */
+    {0x0000, 0, {0}},	/* E2 */
+    {0x0000, 0, {0}},	/* E3 */
+    {0x0000, 0, {0}},	/* E4 */
+    {0x0000, 0, {0}},	/* E5 */
+    {0x0000, 0, {0}},	/* E6 */
+    {0x0000, 0, {0}},	/* E7 */
+    {0x0000, 0, {0}},	/* E8 */
+    {0x0000, 0, {0}},	/* E9 */
+    {0x0000, 0, {0}},	/* EA */
+    {0x0000, 0, {0}},	/* EB */
+    {0x0000, 0, {0}},	/* EC */
+    {0x0000, 0, {0}},	/* ED */
+    {0x0000, 0, {0}},	/* EE */
+    {0x0000, 0, {0}},	/* EF */
+    {0x011f, 2, {0xc4, 0x9f}},	/* F0 */
+    {0x0000, 0, {0}},	/* F1 */
+    {0x0000, 0, {0}},	/* F2 */
+    {0x0000, 0, {0}},	/* F3 */
+    {0x0000, 0, {0}},	/* F4 */
+    {0x0000, 0, {0}},	/* F5 */
+    {0x0000, 0, {0}},	/* F6 */
+    {0x0000, 0, {0}},	/* F7 */
+    {0x0000, 0, {0}},	/* F8 */
+    {0x0000, 0, {0}},	/* F9 */
+    {0x0000, 0, {0}},	/* FA */
+    {0x0000, 0, {0}},	/* FB */
+    {0x0000, 0, {0}},	/* FC */
+    {0x0131, 2, {0xc4, 0xb1}},	/* FD */
+    {0x015f, 2, {0xc5, 0x9f}},	/* FE */
+    {0x0000, 0, {0}},	/* FF */
+};
+
+static const ReverseData iso8859_9_rev[] =
+{
+    {0x011e, 0xD0},
+    {0x011f, 0xF0},
+    {0x0130, 0xDD},
+    {0x0131, 0xFD},
+    {0x015e, 0xDE},
+    {0x015f, 0xFE},
+};
+
 static const BuiltInMapping koi8_e[] =
 {
     /* koi8-e */
@@ -743,6 +4748,364 @@ static const BuiltInMapping koi8_e[] =
     {0x00FF, 0x042A},
 };
 
+static const MappingData koi8_e_utf8[] =
+{
+    {0x0000, 0, {0}},	/* 00 */
+    {0x0001, 0, {0}},	/* 01 */
+    {0x0002, 0, {0}},	/* 02 */
+    {0x0003, 0, {0}},	/* 03 */
+    {0x0004, 0, {0}},	/* 04 */
+    {0x0005, 0, {0}},	/* 05 */
+    {0x0006, 0, {0}},	/* 06 */
+    {0x0007, 0, {0}},	/* 07 */
+    {0x0008, 0, {0}},	/* 08 */
+    {0x0009, 0, {0}},	/* 09 */
+    {0x000a, 0, {0}},	/* 0A */
+    {0x000b, 0, {0}},	/* 0B */
+    {0x000c, 0, {0}},	/* 0C */
+    {0x000d, 0, {0}},	/* 0D */
+    {0x000e, 0, {0}},	/* 0E */
+    {0x000f, 0, {0}},	/* 0F */
+    {0x0010, 0, {0}},	/* 10 */
+    {0x0011, 0, {0}},	/* 11 */
+    {0x0012, 0, {0}},	/* 12 */
+    {0x0013, 0, {0}},	/* 13 */
+    {0x0014, 0, {0}},	/* 14 */
+    {0x0015, 0, {0}},	/* 15 */
+    {0x0016, 0, {0}},	/* 16 */
+    {0x0017, 0, {0}},	/* 17 */
+    {0x0018, 0, {0}},	/* 18 */
+    {0x0019, 0, {0}},	/* 19 */
+    {0x001a, 0, {0}},	/* 1A */
+    {0x001b, 0, {0}},	/* 1B */
+    {0x001c, 0, {0}},	/* 1C */
+    {0x001d, 0, {0}},	/* 1D */
+    {0x001e, 0, {0}},	/* 1E */
+    {0x001f, 0, {0}},	/* 1F */
+    {0x0020, 0, {0}},	/* 20 */
+    {0x0021, 0, {0}},	/* 21 */
+    {0x0022, 0, {0}},	/* 22 */
+    {0x0023, 0, {0}},	/* 23 */
+    {0x0024, 0, {0}},	/* 24 */
+    {0x0025, 0, {0}},	/* 25 */
+    {0x0026, 0, {0}},	/* 26 */
+    {0x0027, 0, {0}},	/* 27 */
+    {0x0028, 0, {0}},	/* 28 */
+    {0x0029, 0, {0}},	/* 29 */
+    {0x002a, 0, {0}},	/* 2A */
+    {0x002b, 0, {0}},	/* 2B */
+    {0x002c, 0, {0}},	/* 2C */
+    {0x002d, 0, {0}},	/* 2D */
+    {0x002e, 0, {0}},	/* 2E */
+    {0x002f, 0, {0}},	/* 2F */
+    {0x0030, 0, {0}},	/* 30 */
+    {0x0031, 0, {0}},	/* 31 */
+    {0x0032, 0, {0}},	/* 32 */
+    {0x0033, 0, {0}},	/* 33 */
+    {0x0034, 0, {0}},	/* 34 */
+    {0x0035, 0, {0}},	/* 35 */
+    {0x0036, 0, {0}},	/* 36 */
+    {0x0037, 0, {0}},	/* 37 */
+    {0x0038, 0, {0}},	/* 38 */
+    {0x0039, 0, {0}},	/* 39 */
+    {0x003a, 0, {0}},	/* 3A */
+    {0x003b, 0, {0}},	/* 3B */
+    {0x003c, 0, {0}},	/* 3C */
+    {0x003d, 0, {0}},	/* 3D */
+    {0x003e, 0, {0}},	/* 3E */
+    {0x003f, 0, {0}},	/* 3F */
+    {0x0040, 0, {0}},	/* 40 */
+    {0x0041, 0, {0}},	/* 41 */
+    {0x0042, 0, {0}},	/* 42 */
+    {0x0043, 0, {0}},	/* 43 */
+    {0x0044, 0, {0}},	/* 44 */
+    {0x0045, 0, {0}},	/* 45 */
+    {0x0046, 0, {0}},	/* 46 */
+    {0x0047, 0, {0}},	/* 47 */
+    {0x0048, 0, {0}},	/* 48 */
+    {0x0049, 0, {0}},	/* 49 */
+    {0x004a, 0, {0}},	/* 4A */
+    {0x004b, 0, {0}},	/* 4B */
+    {0x004c, 0, {0}},	/* 4C */
+    {0x004d, 0, {0}},	/* 4D */
+    {0x004e, 0, {0}},	/* 4E */
+    {0x004f, 0, {0}},	/* 4F */
+    {0x0050, 0, {0}},	/* 50 */
+    {0x0051, 0, {0}},	/* 51 */
+    {0x0052, 0, {0}},	/* 52 */
+    {0x0053, 0, {0}},	/* 53 */
+    {0x0054, 0, {0}},	/* 54 */
+    {0x0055, 0, {0}},	/* 55 */
+    {0x0056, 0, {0}},	/* 56 */
+    {0x0057, 0, {0}},	/* 57 */
+    {0x0058, 0, {0}},	/* 58 */
+    {0x0059, 0, {0}},	/* 59 */
+    {0x005a, 0, {0}},	/* 5A */
+    {0x005b, 0, {0}},	/* 5B */
+    {0x005c, 0, {0}},	/* 5C */
+    {0x005d, 0, {0}},	/* 5D */
+    {0x0000, 0, {0}},	/* 5E */
+    {0x0000, 0, {0}},	/* 5F */
+    {0x0000, 0, {0}},	/* 60 */
+    {0x0000, 0, {0}},	/* 61 */
+    {0x0000, 0, {0}},	/* 62 */
+    {0x0000, 0, {0}},	/* 63 */
+    {0x0000, 0, {0}},	/* 64 */
+    {0x0000, 0, {0}},	/* 65 */
+    {0x0000, 0, {0}},	/* 66 */
+    {0x0000, 0, {0}},	/* 67 */
+    {0x0000, 0, {0}},	/* 68 */
+    {0x0000, 0, {0}},	/* 69 */
+    {0x0000, 0, {0}},	/* 6A */
+    {0x0000, 0, {0}},	/* 6B */
+    {0x0000, 0, {0}},	/* 6C */
+    {0x0000, 0, {0}},	/* 6D */
+    {0x0000, 0, {0}},	/* 6E */
+    {0x0000, 0, {0}},	/* 6F */
+    {0x0000, 0, {0}},	/* 70 */
+    {0x0000, 0, {0}},	/* 71 */
+    {0x0000, 0, {0}},	/* 72 */
+    {0x0000, 0, {0}},	/* 73 */
+    {0x0000, 0, {0}},	/* 74 */
+    {0x0000, 0, {0}},	/* 75 */
+    {0x0000, 0, {0}},	/* 76 */
+    {0x0000, 0, {0}},	/* 77 */
+    {0x0000, 0, {0}},	/* 78 */
+    {0x0000, 0, {0}},	/* 79 */
+    {0x0000, 0, {0}},	/* 7A */
+    {0x0000, 0, {0}},	/* 7B */
+    {0x0000, 0, {0}},	/* 7C */
+    {0x0000, 0, {0}},	/* 7D */
+    {0x0000, 0, {0}},	/* 7E */
+    {0x0000, 0, {0}},	/* 7F */
+    {0x0000, 0, {0}},	/* 80 */
+    {0x0000, 0, {0}},	/* 81 */
+    {0x0000, 0, {0}},	/* 82 */
+    {0x0000, 0, {0}},	/* 83 */
+    {0x0000, 0, {0}},	/* 84 */
+    {0x0000, 0, {0}},	/* 85 */
+    {0x0000, 0, {0}},	/* 86 */
+    {0x0000, 0, {0}},	/* 87 */
+    {0x0000, 0, {0}},	/* 88 */
+    {0x0000, 0, {0}},	/* 89 */
+    {0x0000, 0, {0}},	/* 8A */
+    {0x0000, 0, {0}},	/* 8B */
+    {0x0000, 0, {0}},	/* 8C */
+    {0x0000, 0, {0}},	/* 8D */
+    {0x0000, 0, {0}},	/* 8E */
+    {0x0000, 0, {0}},	/* 8F */
+    {0x0000, 0, {0}},	/* 90 */
+    {0x0000, 0, {0}},	/* 91 */
+    {0x0000, 0, {0}},	/* 92 */
+    {0x0000, 0, {0}},	/* 93 */
+    {0x0000, 0, {0}},	/* 94 */
+    {0x0000, 0, {0}},	/* 95 */
+    {0x0000, 0, {0}},	/* 96 */
+    {0x0000, 0, {0}},	/* 97 */
+    {0x0000, 0, {0}},	/* 98 */
+    {0x0000, 0, {0}},	/* 99 */
+    {0x0000, 0, {0}},	/* 9A */
+    {0x0000, 0, {0}},	/* 9B */
+    {0x0000, 0, {0}},	/* 9C */
+    {0x0000, 0, {0}},	/* 9D */
+    {0x0000, 0, {0}},	/* 9E */
+    {0x0000, 0, {0}},	/* 9F */
+    {0x0000, 0, {0}},	/* A0 */
+    {0x0452, 2, {0xd1, 0x92}},	/* A1 */
+    {0x0453, 2, {0xd1, 0x93}},	/* A2 */
+    {0x0451, 2, {0xd1, 0x91}},	/* A3 */
+    {0x0454, 2, {0xd1, 0x94}},	/* A4 */
+    {0x0455, 2, {0xd1, 0x95}},	/* A5 */
+    {0x0456, 2, {0xd1, 0x96}},	/* A6 */
+    {0x0457, 2, {0xd1, 0x97}},	/* A7 */
+    {0x0458, 2, {0xd1, 0x98}},	/* A8 */
+    {0x0459, 2, {0xd1, 0x99}},	/* A9 */
+    {0x045a, 2, {0xd1, 0x9a}},	/* AA */
+    {0x045b, 2, {0xd1, 0x9b}},	/* AB */
+    {0x045c, 2, {0xd1, 0x9c}},	/* AC */
+    {0x0000, 0, {0}},	/* AD */
+    {0x045e, 2, {0xd1, 0x9e}},	/* AE */
+    {0x045f, 2, {0xd1, 0x9f}},	/* AF */
+    {0x2116, 3, {0xe2, 0x84, 0x96}},	/* B0 */
+    {0x0402, 2, {0xd0, 0x82}},	/* B1 */
+    {0x0403, 2, {0xd0, 0x83}},	/* B2 */
+    {0x0401, 2, {0xd0, 0x81}},	/* B3 */
+    {0x0404, 2, {0xd0, 0x84}},	/* B4 */
+    {0x0405, 2, {0xd0, 0x85}},	/* B5 */
+    {0x0406, 2, {0xd0, 0x86}},	/* B6 */
+    {0x0407, 2, {0xd0, 0x87}},	/* B7 */
+    {0x0408, 2, {0xd0, 0x88}},	/* B8 */
+    {0x0409, 2, {0xd0, 0x89}},	/* B9 */
+    {0x040a, 2, {0xd0, 0x8a}},	/* BA */
+    {0x040b, 2, {0xd0, 0x8b}},	/* BB */
+    {0x040c, 2, {0xd0, 0x8c}},	/* BC */
+    {0x00a4, 2, {0xc2, 0xa4}},	/* BD */
+    {0x040e, 2, {0xd0, 0x8e}},	/* BE */
+    {0x040f, 2, {0xd0, 0x8f}},	/* BF */
+    {0x044e, 2, {0xd1, 0x8e}},	/* C0 */
+    {0x0430, 2, {0xd0, 0xb0}},	/* C1 */
+    {0x0431, 2, {0xd0, 0xb1}},	/* C2 */
+    {0x0446, 2, {0xd1, 0x86}},	/* C3 */
+    {0x0434, 2, {0xd0, 0xb4}},	/* C4 */
+    {0x0435, 2, {0xd0, 0xb5}},	/* C5 */
+    {0x0444, 2, {0xd1, 0x84}},	/* C6 */
+    {0x0433, 2, {0xd0, 0xb3}},	/* C7 */
+    {0x0445, 2, {0xd1, 0x85}},	/* C8 */
+    {0x0438, 2, {0xd0, 0xb8}},	/* C9 */
+    {0x0439, 2, {0xd0, 0xb9}},	/* CA */
+    {0x043a, 2, {0xd0, 0xba}},	/* CB */
+    {0x043b, 2, {0xd0, 0xbb}},	/* CC */
+    {0x043c, 2, {0xd0, 0xbc}},	/* CD */
+    {0x043d, 2, {0xd0, 0xbd}},	/* CE */
+    {0x043e, 2, {0xd0, 0xbe}},	/* CF */
+    {0x043f, 2, {0xd0, 0xbf}},	/* D0 */
+    {0x044f, 2, {0xd1, 0x8f}},	/* D1 */
+    {0x0440, 2, {0xd1, 0x80}},	/* D2 */
+    {0x0441, 2, {0xd1, 0x81}},	/* D3 */
+    {0x0442, 2, {0xd1, 0x82}},	/* D4 */
+    {0x0443, 2, {0xd1, 0x83}},	/* D5 */
+    {0x0436, 2, {0xd0, 0xb6}},	/* D6 */
+    {0x0432, 2, {0xd0, 0xb2}},	/* D7 */
+    {0x044c, 2, {0xd1, 0x8c}},	/* D8 */
+    {0x044b, 2, {0xd1, 0x8b}},	/* D9 */
+    {0x0437, 2, {0xd0, 0xb7}},	/* DA */
+    {0x0448, 2, {0xd1, 0x88}},	/* DB */
+    {0x044d, 2, {0xd1, 0x8d}},	/* DC */
+    {0x0449, 2, {0xd1, 0x89}},	/* DD */
+    {0x0447, 2, {0xd1, 0x87}},	/* DE */
+    {0x044a, 2, {0xd1, 0x8a}},	/* DF */
+    {0x042e, 2, {0xd0, 0xae}},	/* E0 */
+    {0x0410, 2, {0xd0, 0x90}},	/* E1 */
+    {0x0411, 2, {0xd0, 0x91}},	/* E2 */
+    {0x0426, 2, {0xd0, 0xa6}},	/* E3 */
+    {0x0414, 2, {0xd0, 0x94}},	/* E4 */
+    {0x0415, 2, {0xd0, 0x95}},	/* E5 */
+    {0x0424, 2, {0xd0, 0xa4}},	/* E6 */
+    {0x0413, 2, {0xd0, 0x93}},	/* E7 */
+    {0x0425, 2, {0xd0, 0xa5}},	/* E8 */
+    {0x0418, 2, {0xd0, 0x98}},	/* E9 */
+    {0x0419, 2, {0xd0, 0x99}},	/* EA */
+    {0x041a, 2, {0xd0, 0x9a}},	/* EB */
+    {0x041b, 2, {0xd0, 0x9b}},	/* EC */
+    {0x041c, 2, {0xd0, 0x9c}},	/* ED */
+    {0x041d, 2, {0xd0, 0x9d}},	/* EE */
+    {0x041e, 2, {0xd0, 0x9e}},	/* EF */
+    {0x041f, 2, {0xd0, 0x9f}},	/* F0 */
+    {0x042f, 2, {0xd0, 0xaf}},	/* F1 */
+    {0x0420, 2, {0xd0, 0xa0}},	/* F2 */
+    {0x0421, 2, {0xd0, 0xa1}},	/* F3 */
+    {0x0422, 2, {0xd0, 0xa2}},	/* F4 */
+    {0x0423, 2, {0xd0, 0xa3}},	/* F5 */
+    {0x0416, 2, {0xd0, 0x96}},	/* F6 */
+    {0x0412, 2, {0xd0, 0x92}},	/* F7 */
+    {0x042c, 2, {0xd0, 0xac}},	/* F8 */
+    {0x042b, 2, {0xd0, 0xab}},	/* F9 */
+    {0x0417, 2, {0xd0, 0x97}},	/* FA */
+    {0x0428, 2, {0xd0, 0xa8}},	/* FB */
+    {0x042d, 2, {0xd0, 0xad}},	/* FC */
+    {0x0429, 2, {0xd0, 0xa9}},	/* FD */
+    {0x0427, 2, {0xd0, 0xa7}},	/* FE */
+    {0x042a, 2, {0xd0, 0xaa}},	/* FF */
+};
+
+static const ReverseData koi8_e_rev[] =
+{
+    {0x00a4, 0xBD},
+    {0x0401, 0xB3},
+    {0x0402, 0xB1},
+    {0x0403, 0xB2},
+    {0x0404, 0xB4},
+    {0x0405, 0xB5},
+    {0x0406, 0xB6},
+    {0x0407, 0xB7},
+    {0x0408, 0xB8},
+    {0x0409, 0xB9},
+    {0x040a, 0xBA},
+    {0x040b, 0xBB},
+    {0x040c, 0xBC},
+    {0x040e, 0xBE},
+    {0x040f, 0xBF},
+    {0x0410, 0xE1},
+    {0x0411, 0xE2},
+    {0x0412, 0xF7},
+    {0x0413, 0xE7},
+    {0x0414, 0xE4},
+    {0x0415, 0xE5},
+    {0x0416, 0xF6},
+    {0x0417, 0xFA},
+    {0x0418, 0xE9},
+    {0x0419, 0xEA},
+    {0x041a, 0xEB},
+    {0x041b, 0xEC},
+    {0x041c, 0xED},
+    {0x041d, 0xEE},
+    {0x041e, 0xEF},
+    {0x041f, 0xF0},
+    {0x0420, 0xF2},
+    {0x0421, 0xF3},
+    {0x0422, 0xF4},
+    {0x0423, 0xF5},
+    {0x0424, 0xE6},
+    {0x0425, 0xE8},
+    {0x0426, 0xE3},
+    {0x0427, 0xFE},
+    {0x0428, 0xFB},
+    {0x0429, 0xFD},
+    {0x042a, 0xFF},
+    {0x042b, 0xF9},
+    {0x042c, 0xF8},
+    {0x042d, 0xFC},
+    {0x042e, 0xE0},
+    {0x042f, 0xF1},
+    {0x0430, 0xC1},
+    {0x0431, 0xC2},
+    {0x0432, 0xD7},
+    {0x0433, 0xC7},
+    {0x0434, 0xC4},
+    {0x0435, 0xC5},
+    {0x0436, 0xD6},
+    {0x0437, 0xDA},
+    {0x0438, 0xC9},
+    {0x0439, 0xCA},
+    {0x043a, 0xCB},
+    {0x043b, 0xCC},
+    {0x043c, 0xCD},
+    {0x043d, 0xCE},
+    {0x043e, 0xCF},
+    {0x043f, 0xD0},
+    {0x0440, 0xD2},
+    {0x0441, 0xD3},
+    {0x0442, 0xD4},
+    {0x0443, 0xD5},
+    {0x0444, 0xC6},
+    {0x0445, 0xC8},
+    {0x0446, 0xC3},
+    {0x0447, 0xDE},
+    {0x0448, 0xDB},
+    {0x0449, 0xDD},
+    {0x044a, 0xDF},
+    {0x044b, 0xD9},
+    {0x044c, 0xD8},
+    {0x044d, 0xDC},
+    {0x044e, 0xC0},
+    {0x044f, 0xD1},
+    {0x0451, 0xA3},
+    {0x0452, 0xA1},
+    {0x0453, 0xA2},
+    {0x0454, 0xA4},
+    {0x0455, 0xA5},
+    {0x0456, 0xA6},
+    {0x0457, 0xA7},
+    {0x0458, 0xA8},
+    {0x0459, 0xA9},
+    {0x045a, 0xAA},
+    {0x045b, 0xAB},
+    {0x045c, 0xAC},
+    {0x045e, 0xAE},
+    {0x045f, 0xAF},
+    {0x2116, 0xB0},
+};
+
 static const BuiltInMapping koi8_r[] =
 {
     /* koi8-r */
@@ -876,6 +5239,398 @@ static const BuiltInMapping koi8_r[] =
     {0x00FF, 0x042A},
 };
 
+static const MappingData koi8_r_utf8[] =
+{
+    {0x0000, 0, {0}},	/* 00 */
+    {0x0001, 0, {0}},	/* 01 */
+    {0x0002, 0, {0}},	/* 02 */
+    {0x0003, 0, {0}},	/* 03 */
+    {0x0004, 0, {0}},	/* 04 */
+    {0x0005, 0, {0}},	/* 05 */
+    {0x0006, 0, {0}},	/* 06 */
+    {0x0007, 0, {0}},	/* 07 */
+    {0x0008, 0, {0}},	/* 08 */
+    {0x0009, 0, {0}},	/* 09 */
+    {0x000a, 0, {0}},	/* 0A */
+    {0x000b, 0, {0}},	/* 0B */
+    {0x000c, 0, {0}},	/* 0C */
+    {0x000d, 0, {0}},	/* 0D */
+    {0x000e, 0, {0}},	/* 0E */
+    {0x000f, 0, {0}},	/* 0F */
+    {0x0010, 0, {0}},	/* 10 */
+    {0x0011, 0, {0}},	/* 11 */
+    {0x0012, 0, {0}},	/* 12 */
+    {0x0013, 0, {0}},	/* 13 */
+    {0x0014, 0, {0}},	/* 14 */
+    {0x0015, 0, {0}},	/* 15 */
+    {0x0016, 0, {0}},	/* 16 */
+    {0x0017, 0, {0}},	/* 17 */
+    {0x0018, 0, {0}},	/* 18 */
+    {0x0019, 0, {0}},	/* 19 */
+    {0x001a, 0, {0}},	/* 1A */
+    {0x001b, 0, {0}},	/* 1B */
+    {0x001c, 0, {0}},	/* 1C */
+    {0x001d, 0, {0}},	/* 1D */
+    {0x001e, 0, {0}},	/* 1E */
+    {0x001f, 0, {0}},	/* 1F */
+    {0x0020, 0, {0}},	/* 20 */
+    {0x0021, 0, {0}},	/* 21 */
+    {0x0022, 0, {0}},	/* 22 */
+    {0x0023, 0, {0}},	/* 23 */
+    {0x0024, 0, {0}},	/* 24 */
+    {0x0025, 0, {0}},	/* 25 */
+    {0x0026, 0, {0}},	/* 26 */
+    {0x0027, 0, {0}},	/* 27 */
+    {0x0028, 0, {0}},	/* 28 */
+    {0x0029, 0, {0}},	/* 29 */
+    {0x002a, 0, {0}},	/* 2A */
+    {0x002b, 0, {0}},	/* 2B */
+    {0x002c, 0, {0}},	/* 2C */
+    {0x002d, 0, {0}},	/* 2D */
+    {0x002e, 0, {0}},	/* 2E */
+    {0x002f, 0, {0}},	/* 2F */
+    {0x0030, 0, {0}},	/* 30 */
+    {0x0031, 0, {0}},	/* 31 */
+    {0x0032, 0, {0}},	/* 32 */
+    {0x0033, 0, {0}},	/* 33 */
+    {0x0034, 0, {0}},	/* 34 */
+    {0x0035, 0, {0}},	/* 35 */
+    {0x0036, 0, {0}},	/* 36 */
+    {0x0037, 0, {0}},	/* 37 */
+    {0x0038, 0, {0}},	/* 38 */
+    {0x0039, 0, {0}},	/* 39 */
+    {0x003a, 0, {0}},	/* 3A */
+    {0x003b, 0, {0}},	/* 3B */
+    {0x003c, 0, {0}},	/* 3C */
+    {0x003d, 0, {0}},	/* 3D */
+    {0x003e, 0, {0}},	/* 3E */
+    {0x003f, 0, {0}},	/* 3F */
+    {0x0040, 0, {0}},	/* 40 */
+    {0x0041, 0, {0}},	/* 41 */
+    {0x0042, 0, {0}},	/* 42 */
+    {0x0043, 0, {0}},	/* 43 */
+    {0x0044, 0, {0}},	/* 44 */
+    {0x0045, 0, {0}},	/* 45 */
+    {0x0046, 0, {0}},	/* 46 */
+    {0x0047, 0, {0}},	/* 47 */
+    {0x0048, 0, {0}},	/* 48 */
+    {0x0049, 0, {0}},	/* 49 */
+    {0x004a, 0, {0}},	/* 4A */
+    {0x004b, 0, {0}},	/* 4B */
+    {0x004c, 0, {0}},	/* 4C */
+    {0x004d, 0, {0}},	/* 4D */
+    {0x004e, 0, {0}},	/* 4E */
+    {0x004f, 0, {0}},	/* 4F */
+    {0x0050, 0, {0}},	/* 50 */
+    {0x0051, 0, {0}},	/* 51 */
+    {0x0052, 0, {0}},	/* 52 */
+    {0x0053, 0, {0}},	/* 53 */
+    {0x0054, 0, {0}},	/* 54 */
+    {0x0055, 0, {0}},	/* 55 */
+    {0x0056, 0, {0}},	/* 56 */
+    {0x0057, 0, {0}},	/* 57 */
+    {0x0058, 0, {0}},	/* 58 */
+    {0x0059, 0, {0}},	/* 59 */
+    {0x005a, 0, {0}},	/* 5A */
+    {0x005b, 0, {0}},	/* 5B */
+    {0x005c, 0, {0}},	/* 5C */
+    {0x005d, 0, {0}},	/* 5D */
+    {0x005e, 0, {0}},	/* 5E */
+    {0x005f, 0, {0}},	/* 5F */
+    {0x0060, 0, {0}},	/* 60 */
+    {0x0061, 0, {0}},	/* 61 */
+    {0x0062, 0, {0}},	/* 62 */
+    {0x0063, 0, {0}},	/* 63 */
+    {0x0064, 0, {0}},	/* 64 */
+    {0x0065, 0, {0}},	/* 65 */
+    {0x0066, 0, {0}},	/* 66 */
+    {0x0067, 0, {0}},	/* 67 */
+    {0x0068, 0, {0}},	/* 68 */
+    {0x0069, 0, {0}},	/* 69 */
+    {0x006a, 0, {0}},	/* 6A */
+    {0x006b, 0, {0}},	/* 6B */
+    {0x006c, 0, {0}},	/* 6C */
+    {0x006d, 0, {0}},	/* 6D */
+    {0x006e, 0, {0}},	/* 6E */
+    {0x006f, 0, {0}},	/* 6F */
+    {0x0070, 0, {0}},	/* 70 */
+    {0x0071, 0, {0}},	/* 71 */
+    {0x0072, 0, {0}},	/* 72 */
+    {0x0073, 0, {0}},	/* 73 */
+    {0x0074, 0, {0}},	/* 74 */
+    {0x0075, 0, {0}},	/* 75 */
+    {0x0076, 0, {0}},	/* 76 */
+    {0x0077, 0, {0}},	/* 77 */
+    {0x0078, 0, {0}},	/* 78 */
+    {0x0079, 0, {0}},	/* 79 */
+    {0x007a, 0, {0}},	/* 7A */
+    {0x007b, 0, {0}},	/* 7B */
+    {0x007c, 0, {0}},	/* 7C */
+    {0x007d, 0, {0}},	/* 7D */
+    {0x007e, 0, {0}},	/* 7E */
+    {0x007f, 0, {0}},	/* 7F */
+    {0x2500, 3, {0xe2, 0x94, 0x80}},	/* 80 */
+    {0x2502, 3, {0xe2, 0x94, 0x82}},	/* 81 */
+    {0x250c, 3, {0xe2, 0x94, 0x8c}},	/* 82 */
+    {0x2510, 3, {0xe2, 0x94, 0x90}},	/* 83 */
+    {0x2514, 3, {0xe2, 0x94, 0x94}},	/* 84 */
+    {0x2518, 3, {0xe2, 0x94, 0x98}},	/* 85 */
+    {0x251c, 3, {0xe2, 0x94, 0x9c}},	/* 86 */
+    {0x2524, 3, {0xe2, 0x94, 0xa4}},	/* 87 */
+    {0x252c, 3, {0xe2, 0x94, 0xac}},	/* 88 */
+    {0x2534, 3, {0xe2, 0x94, 0xb4}},	/* 89 */
+    {0x253c, 3, {0xe2, 0x94, 0xbc}},	/* 8A */
+    {0x2580, 3, {0xe2, 0x96, 0x80}},	/* 8B */
+    {0x2584, 3, {0xe2, 0x96, 0x84}},	/* 8C */
+    {0x2588, 3, {0xe2, 0x96, 0x88}},	/* 8D */
+    {0x258c, 3, {0xe2, 0x96, 0x8c}},	/* 8E */
+    {0x2590, 3, {0xe2, 0x96, 0x90}},	/* 8F */
+    {0x2591, 3, {0xe2, 0x96, 0x91}},	/* 90 */
+    {0x2592, 3, {0xe2, 0x96, 0x92}},	/* 91 */
+    {0x2593, 3, {0xe2, 0x96, 0x93}},	/* 92 */
+    {0x2320, 3, {0xe2, 0x8c, 0xa0}},	/* 93 */
+    {0x25a0, 3, {0xe2, 0x96, 0xa0}},	/* 94 */
+    {0x2219, 3, {0xe2, 0x88, 0x99}},	/* 95 */
+    {0x221a, 3, {0xe2, 0x88, 0x9a}},	/* 96 */
+    {0x2248, 3, {0xe2, 0x89, 0x88}},	/* 97 */
+    {0x2264, 3, {0xe2, 0x89, 0xa4}},	/* 98 */
+    {0x2265, 3, {0xe2, 0x89, 0xa5}},	/* 99 */
+    {0x00a0, 2, {0xc2, 0xa0}},	/* 9A */
+    {0x2321, 3, {0xe2, 0x8c, 0xa1}},	/* 9B */
+    {0x00b0, 2, {0xc2, 0xb0}},	/* 9C */
+    {0x00b2, 2, {0xc2, 0xb2}},	/* 9D */
+    {0x00b7, 2, {0xc2, 0xb7}},	/* 9E */
+    {0x00f7, 2, {0xc3, 0xb7}},	/* 9F */
+    {0x2550, 3, {0xe2, 0x95, 0x90}},	/* A0 */
+    {0x2551, 3, {0xe2, 0x95, 0x91}},	/* A1 */
+    {0x2552, 3, {0xe2, 0x95, 0x92}},	/* A2 */
+    {0x0451, 2, {0xd1, 0x91}},	/* A3 */
+    {0x2553, 3, {0xe2, 0x95, 0x93}},	/* A4 */
+    {0x2554, 3, {0xe2, 0x95, 0x94}},	/* A5 */
+    {0x2555, 3, {0xe2, 0x95, 0x95}},	/* A6 */
+    {0x2556, 3, {0xe2, 0x95, 0x96}},	/* A7 */
+    {0x2557, 3, {0xe2, 0x95, 0x97}},	/* A8 */
+    {0x2558, 3, {0xe2, 0x95, 0x98}},	/* A9 */
+    {0x2559, 3, {0xe2, 0x95, 0x99}},	/* AA */
+    {0x255a, 3, {0xe2, 0x95, 0x9a}},	/* AB */
+    {0x255b, 3, {0xe2, 0x95, 0x9b}},	/* AC */
+    {0x255c, 3, {0xe2, 0x95, 0x9c}},	/* AD */
+    {0x255d, 3, {0xe2, 0x95, 0x9d}},	/* AE */
+    {0x255e, 3, {0xe2, 0x95, 0x9e}},	/* AF */
+    {0x255f, 3, {0xe2, 0x95, 0x9f}},	/* B0 */
+    {0x2560, 3, {0xe2, 0x95, 0xa0}},	/* B1 */
+    {0x2561, 3, {0xe2, 0x95, 0xa1}},	/* B2 */
+    {0x0401, 2, {0xd0, 0x81}},	/* B3 */
+    {0x2562, 3, {0xe2, 0x95, 0xa2}},	/* B4 */
+    {0x2563, 3, {0xe2, 0x95, 0xa3}},	/* B5 */
+    {0x2564, 3, {0xe2, 0x95, 0xa4}},	/* B6 */
+    {0x2565, 3, {0xe2, 0x95, 0xa5}},	/* B7 */
+    {0x2566, 3, {0xe2, 0x95, 0xa6}},	/* B8 */
+    {0x2567, 3, {0xe2, 0x95, 0xa7}},	/* B9 */
+    {0x2568, 3, {0xe2, 0x95, 0xa8}},	/* BA */
+    {0x2569, 3, {0xe2, 0x95, 0xa9}},	/* BB */
+    {0x256a, 3, {0xe2, 0x95, 0xaa}},	/* BC */
+    {0x256b, 3, {0xe2, 0x95, 0xab}},	/* BD */
+    {0x256c, 3, {0xe2, 0x95, 0xac}},	/* BE */
+    {0x00a9, 2, {0xc2, 0xa9}},	/* BF */
+    {0x044e, 2, {0xd1, 0x8e}},	/* C0 */
+    {0x0430, 2, {0xd0, 0xb0}},	/* C1 */
+    {0x0431, 2, {0xd0, 0xb1}},	/* C2 */
+    {0x0446, 2, {0xd1, 0x86}},	/* C3 */
+    {0x0434, 2, {0xd0, 0xb4}},	/* C4 */
+    {0x0435, 2, {0xd0, 0xb5}},	/* C5 */
+    {0x0444, 2, {0xd1, 0x84}},	/* C6 */
+    {0x0433, 2, {0xd0, 0xb3}},	/* C7 */
+    {0x0445, 2, {0xd1, 0x85}},	/* C8 */
+    {0x0438, 2, {0xd0, 0xb8}},	/* C9 */
+    {0x0439, 2, {0xd0, 0xb9}},	/* CA */
+    {0x043a, 2, {0xd0, 0xba}},	/* CB */
+    {0x043b, 2, {0xd0, 0xbb}},	/* CC */
+    {0x043c, 2, {0xd0, 0xbc}},	/* CD */
+    {0x043d, 2, {0xd0, 0xbd}},	/* CE */
+    {0x043e, 2, {0xd0, 0xbe}},	/* CF */
+    {0x043f, 2, {0xd0, 0xbf}},	/* D0 */
+    {0x044f, 2, {0xd1, 0x8f}},	/* D1 */
+    {0x0440, 2, {0xd1, 0x80}},	/* D2 */
+    {0x0441, 2, {0xd1, 0x81}},	/* D3 */
+    {0x0442, 2, {0xd1, 0x82}},	/* D4 */
+    {0x0443, 2, {0xd1, 0x83}},	/* D5 */
+    {0x0436, 2, {0xd0, 0xb6}},	/* D6 */
+    {0x0432, 2, {0xd0, 0xb2}},	/* D7 */
+    {0x044c, 2, {0xd1, 0x8c}},	/* D8 */
+    {0x044b, 2, {0xd1, 0x8b}},	/* D9 */
+    {0x0437, 2, {0xd0, 0xb7}},	/* DA */
+    {0x0448, 2, {0xd1, 0x88}},	/* DB */
+    {0x044d, 2, {0xd1, 0x8d}},	/* DC */
+    {0x0449, 2, {0xd1, 0x89}},	/* DD */
+    {0x0447, 2, {0xd1, 0x87}},	/* DE */
+    {0x044a, 2, {0xd1, 0x8a}},	/* DF */
+    {0x042e, 2, {0xd0, 0xae}},	/* E0 */
+    {0x0410, 2, {0xd0, 0x90}},	/* E1 */
+    {0x0411, 2, {0xd0, 0x91}},	/* E2 */
+    {0x0426, 2, {0xd0, 0xa6}},	/* E3 */
+    {0x0414, 2, {0xd0, 0x94}},	/* E4 */
+    {0x0415, 2, {0xd0, 0x95}},	/* E5 */
+    {0x0424, 2, {0xd0, 0xa4}},	/* E6 */
+    {0x0413, 2, {0xd0, 0x93}},	/* E7 */
+    {0x0425, 2, {0xd0, 0xa5}},	/* E8 */
+    {0x0418, 2, {0xd0, 0x98}},	/* E9 */
+    {0x0419, 2, {0xd0, 0x99}},	/* EA */
+    {0x041a, 2, {0xd0, 0x9a}},	/* EB */
+    {0x041b, 2, {0xd0, 0x9b}},	/* EC */
+    {0x041c, 2, {0xd0, 0x9c}},	/* ED */
+    {0x041d, 2, {0xd0, 0x9d}},	/* EE */
+    {0x041e, 2, {0xd0, 0x9e}},	/* EF */
+    {0x041f, 2, {0xd0, 0x9f}},	/* F0 */
+    {0x042f, 2, {0xd0, 0xaf}},	/* F1 */
+    {0x0420, 2, {0xd0, 0xa0}},	/* F2 */
+    {0x0421, 2, {0xd0, 0xa1}},	/* F3 */
+    {0x0422, 2, {0xd0, 0xa2}},	/* F4 */
+    {0x0423, 2, {0xd0, 0xa3}},	/* F5 */
+    {0x0416, 2, {0xd0, 0x96}},	/* F6 */
+    {0x0412, 2, {0xd0, 0x92}},	/* F7 */
+    {0x042c, 2, {0xd0, 0xac}},	/* F8 */
+    {0x042b, 2, {0xd0, 0xab}},	/* F9 */
+    {0x0417, 2, {0xd0, 0x97}},	/* FA */
+    {0x0428, 2, {0xd0, 0xa8}},	/* FB */
+    {0x042d, 2, {0xd0, 0xad}},	/* FC */
+    {0x0429, 2, {0xd0, 0xa9}},	/* FD */
+    {0x0427, 2, {0xd0, 0xa7}},	/* FE */
+    {0x042a, 2, {0xd0, 0xaa}},	/* FF */
+};
+
+static const ReverseData koi8_r_rev[] =
+{
+    {0x00a0, 0x9A},
+    {0x00a9, 0xBF},
+    {0x00b0, 0x9C},
+    {0x00b2, 0x9D},
+    {0x00b7, 0x9E},
+    {0x00f7, 0x9F},
+    {0x0401, 0xB3},
+    {0x0410, 0xE1},
+    {0x0411, 0xE2},
+    {0x0412, 0xF7},
+    {0x0413, 0xE7},
+    {0x0414, 0xE4},
+    {0x0415, 0xE5},
+    {0x0416, 0xF6},
+    {0x0417, 0xFA},
+    {0x0418, 0xE9},
+    {0x0419, 0xEA},
+    {0x041a, 0xEB},
+    {0x041b, 0xEC},
+    {0x041c, 0xED},
+    {0x041d, 0xEE},
+    {0x041e, 0xEF},
+    {0x041f, 0xF0},
+    {0x0420, 0xF2},
+    {0x0421, 0xF3},
+    {0x0422, 0xF4},
+    {0x0423, 0xF5},
+    {0x0424, 0xE6},
+    {0x0425, 0xE8},
+    {0x0426, 0xE3},
+    {0x0427, 0xFE},
+    {0x0428, 0xFB},
+    {0x0429, 0xFD},
+    {0x042a, 0xFF},
+    {0x042b, 0xF9},
+    {0x042c, 0xF8},
+    {0x042d, 0xFC},
+    {0x042e, 0xE0},
+    {0x042f, 0xF1},
+    {0x0430, 0xC1},
+    {0x0431, 0xC2},
+    {0x0432, 0xD7},
+    {0x0433, 0xC7},
+    {0x0434, 0xC4},
+    {0x0435, 0xC5},
+    {0x0436, 0xD6},
+    {0x0437, 0xDA},
+    {0x0438, 0xC9},
+    {0x0439, 0xCA},
+    {0x043a, 0xCB},
+    {0x043b, 0xCC},
+    {0x043c, 0xCD},
+    {0x043d, 0xCE},
+    {0x043e, 0xCF},
+    {0x043f, 0xD0},
+    {0x0440, 0xD2},
+    {0x0441, 0xD3},
+    {0x0442, 0xD4},
+    {0x0443, 0xD5},
+    {0x0444, 0xC6},
+    {0x0445, 0xC8},
+    {0x0446, 0xC3},
+    {0x0447, 0xDE},
+    {0x0448, 0xDB},
+    {0x0449, 0xDD},
+    {0x044a, 0xDF},
+    {0x044b, 0xD9},
+    {0x044c, 0xD8},
+    {0x044d, 0xDC},
+    {0x044e, 0xC0},
+    {0x044f, 0xD1},
+    {0x0451, 0xA3},
+    {0x2219, 0x95},
+    {0x221a, 0x96},
+    {0x2248, 0x97},
+    {0x2264, 0x98},
+    {0x2265, 0x99},
+    {0x2320, 0x93},
+    {0x2321, 0x9B},
+    {0x2500, 0x80},
+    {0x2502, 0x81},
+    {0x250c, 0x82},
+    {0x2510, 0x83},
+    {0x2514, 0x84},
+    {0x2518, 0x85},
+    {0x251c, 0x86},
+    {0x2524, 0x87},
+    {0x252c, 0x88},
+    {0x2534, 0x89},
+    {0x253c, 0x8A},
+    {0x2550, 0xA0},
+    {0x2551, 0xA1},
+    {0x2552, 0xA2},
+    {0x2553, 0xA4},
+    {0x2554, 0xA5},
+    {0x2555, 0xA6},
+    {0x2556, 0xA7},
+    {0x2557, 0xA8},
+    {0x2558, 0xA9},
+    {0x2559, 0xAA},
+    {0x255a, 0xAB},
+    {0x255b, 0xAC},
+    {0x255c, 0xAD},
+    {0x255d, 0xAE},
+    {0x255e, 0xAF},
+    {0x255f, 0xB0},
+    {0x2560, 0xB1},
+    {0x2561, 0xB2},
+    {0x2562, 0xB4},
+    {0x2563, 0xB5},
+    {0x2564, 0xB6},
+    {0x2565, 0xB7},
+    {0x2566, 0xB8},
+    {0x2567, 0xB9},
+    {0x2568, 0xBA},
+    {0x2569, 0xBB},
+    {0x256a, 0xBC},
+    {0x256b, 0xBD},
+    {0x256c, 0xBE},
+    {0x2580, 0x8B},
+    {0x2584, 0x8C},
+    {0x2588, 0x8D},
+    {0x258c, 0x8E},
+    {0x2590, 0x8F},
+    {0x2591, 0x90},
+    {0x2592, 0x91},
+    {0x2593, 0x92},
+    {0x25a0, 0x94},
+};
+
 static const BuiltInMapping koi8_ru[] =
 {
     /* koi8-ru */
@@ -1009,6 +5764,398 @@ static const BuiltInMapping koi8_ru[] =
     {0x00FF, 0x042A},
 };
 
+static const MappingData koi8_ru_utf8[] =
+{
+    {0x0000, 0, {0}},	/* 00 */
+    {0x0001, 0, {0}},	/* 01 */
+    {0x0002, 0, {0}},	/* 02 */
+    {0x0003, 0, {0}},	/* 03 */
+    {0x0004, 0, {0}},	/* 04 */
+    {0x0005, 0, {0}},	/* 05 */
+    {0x0006, 0, {0}},	/* 06 */
+    {0x0007, 0, {0}},	/* 07 */
+    {0x0008, 0, {0}},	/* 08 */
+    {0x0009, 0, {0}},	/* 09 */
+    {0x000a, 0, {0}},	/* 0A */
+    {0x000b, 0, {0}},	/* 0B */
+    {0x000c, 0, {0}},	/* 0C */
+    {0x000d, 0, {0}},	/* 0D */
+    {0x000e, 0, {0}},	/* 0E */
+    {0x000f, 0, {0}},	/* 0F */
+    {0x0010, 0, {0}},	/* 10 */
+    {0x0011, 0, {0}},	/* 11 */
+    {0x0012, 0, {0}},	/* 12 */
+    {0x0013, 0, {0}},	/* 13 */
+    {0x0014, 0, {0}},	/* 14 */
+    {0x0015, 0, {0}},	/* 15 */
+    {0x0016, 0, {0}},	/* 16 */
+    {0x0017, 0, {0}},	/* 17 */
+    {0x0018, 0, {0}},	/* 18 */
+    {0x0019, 0, {0}},	/* 19 */
+    {0x001a, 0, {0}},	/* 1A */
+    {0x001b, 0, {0}},	/* 1B */
+    {0x001c, 0, {0}},	/* 1C */
+    {0x001d, 0, {0}},	/* 1D */
+    {0x001e, 0, {0}},	/* 1E */
+    {0x001f, 0, {0}},	/* 1F */
+    {0x0020, 0, {0}},	/* 20 */
+    {0x0021, 0, {0}},	/* 21 */
+    {0x0022, 0, {0}},	/* 22 */
+    {0x0023, 0, {0}},	/* 23 */
+    {0x0024, 0, {0}},	/* 24 */
+    {0x0025, 0, {0}},	/* 25 */
+    {0x0026, 0, {0}},	/* 26 */
+    {0x0027, 0, {0}},	/* 27 */
+    {0x0028, 0, {0}},	/* 28 */
+    {0x0029, 0, {0}},	/* 29 */
+    {0x002a, 0, {0}},	/* 2A */
+    {0x002b, 0, {0}},	/* 2B */
+    {0x002c, 0, {0}},	/* 2C */
+    {0x002d, 0, {0}},	/* 2D */
+    {0x002e, 0, {0}},	/* 2E */
+    {0x002f, 0, {0}},	/* 2F */
+    {0x0030, 0, {0}},	/* 30 */
+    {0x0031, 0, {0}},	/* 31 */
+    {0x0032, 0, {0}},	/* 32 */
+    {0x0033, 0, {0}},	/* 33 */
+    {0x0034, 0, {0}},	/* 34 */
+    {0x0035, 0, {0}},	/* 35 */
+    {0x0036, 0, {0}},	/* 36 */
+    {0x0037, 0, {0}},	/* 37 */
+    {0x0038, 0, {0}},	/* 38 */
+    {0x0039, 0, {0}},	/* 39 */
+    {0x003a, 0, {0}},	/* 3A */
+    {0x003b, 0, {0}},	/* 3B */
+    {0x003c, 0, {0}},	/* 3C */
+    {0x003d, 0, {0}},	/* 3D */
+    {0x003e, 0, {0}},	/* 3E */
+    {0x003f, 0, {0}},	/* 3F */
+    {0x0040, 0, {0}},	/* 40 */
+    {0x0041, 0, {0}},	/* 41 */
+    {0x0042, 0, {0}},	/* 42 */
+    {0x0043, 0, {0}},	/* 43 */
+    {0x0044, 0, {0}},	/* 44 */
+    {0x0045, 0, {0}},	/* 45 */
+    {0x0046, 0, {0}},	/* 46 */
+    {0x0047, 0, {0}},	/* 47 */
+    {0x0048, 0, {0}},	/* 48 */
+    {0x0049, 0, {0}},	/* 49 */
+    {0x004a, 0, {0}},	/* 4A */
+    {0x004b, 0, {0}},	/* 4B */
+    {0x004c, 0, {0}},	/* 4C */
+    {0x004d, 0, {0}},	/* 4D */
+    {0x004e, 0, {0}},	/* 4E */
+    {0x004f, 0, {0}},	/* 4F */
+    {0x0050, 0, {0}},	/* 50 */
+    {0x0051, 0, {0}},	/* 51 */
+    {0x0052, 0, {0}},	/* 52 */
+    {0x0053, 0, {0}},	/* 53 */
+    {0x0054, 0, {0}},	/* 54 */
+    {0x0055, 0, {0}},	/* 55 */
+    {0x0056, 0, {0}},	/* 56 */
+    {0x0057, 0, {0}},	/* 57 */
+    {0x0058, 0, {0}},	/* 58 */
+    {0x0059, 0, {0}},	/* 59 */
+    {0x005a, 0, {0}},	/* 5A */
+    {0x005b, 0, {0}},	/* 5B */
+    {0x005c, 0, {0}},	/* 5C */
+    {0x005d, 0, {0}},	/* 5D */
+    {0x005e, 0, {0}},	/* 5E */
+    {0x005f, 0, {0}},	/* 5F */
+    {0x0060, 0, {0}},	/* 60 */
+    {0x0061, 0, {0}},	/* 61 */
+    {0x0062, 0, {0}},	/* 62 */
+    {0x0063, 0, {0}},	/* 63 */
+    {0x0064, 0, {0}},	/* 64 */
+    {0x0065, 0, {0}},	/* 65 */
+    {0x0066, 0, {0}},	/* 66 */
+    {0x0067, 0, {0}},	/* 67 */
+    {0x0068, 0, {0}},	/* 68 */
+    {0x0069, 0, {0}},	/* 69 */
+    {0x006a, 0, {0}},	/* 6A */
+    {0x006b, 0, {0}},	/* 6B */
+    {0x006c, 0, {0}},	/* 6C */
+    {0x006d, 0, {0}},	/* 6D */
+    {0x006e, 0, {0}},	/* 6E */
+    {0x006f, 0, {0}},	/* 6F */
+    {0x0070, 0, {0}},	/* 70 */
+    {0x0071, 0, {0}},	/* 71 */
+    {0x0072, 0, {0}},	/* 72 */
+    {0x0073, 0, {0}},	/* 73 */
+    {0x0074, 0, {0}},	/* 74 */
+    {0x0075, 0, {0}},	/* 75 */
+    {0x0076, 0, {0}},	/* 76 */
+    {0x0077, 0, {0}},	/* 77 */
+    {0x0078, 0, {0}},	/* 78 */
+    {0x0079, 0, {0}},	/* 79 */
+    {0x007a, 0, {0}},	/* 7A */
+    {0x007b, 0, {0}},	/* 7B */
+    {0x007c, 0, {0}},	/* 7C */
+    {0x007d, 0, {0}},	/* 7D */
+    {0x007e, 0, {0}},	/* 7E */
+    {0x007f, 0, {0}},	/* 7F */
+    {0x2500, 3, {0xe2, 0x94, 0x80}},	/* 80 */
+    {0x2502, 3, {0xe2, 0x94, 0x82}},	/* 81 */
+    {0x250c, 3, {0xe2, 0x94, 0x8c}},	/* 82 */
+    {0x2510, 3, {0xe2, 0x94, 0x90}},	/* 83 */
+    {0x2514, 3, {0xe2, 0x94, 0x94}},	/* 84 */
+    {0x2518, 3, {0xe2, 0x94, 0x98}},	/* 85 */
+    {0x251c, 3, {0xe2, 0x94, 0x9c}},	/* 86 */
+    {0x2524, 3, {0xe2, 0x94, 0xa4}},	/* 87 */
+    {0x252c, 3, {0xe2, 0x94, 0xac}},	/* 88 */
+    {0x2534, 3, {0xe2, 0x94, 0xb4}},	/* 89 */
+    {0x253c, 3, {0xe2, 0x94, 0xbc}},	/* 8A */
+    {0x2580, 3, {0xe2, 0x96, 0x80}},	/* 8B */
+    {0x2584, 3, {0xe2, 0x96, 0x84}},	/* 8C */
+    {0x2588, 3, {0xe2, 0x96, 0x88}},	/* 8D */
+    {0x258c, 3, {0xe2, 0x96, 0x8c}},	/* 8E */
+    {0x2590, 3, {0xe2, 0x96, 0x90}},	/* 8F */
+    {0x2591, 3, {0xe2, 0x96, 0x91}},	/* 90 */
+    {0x2592, 3, {0xe2, 0x96, 0x92}},	/* 91 */
+    {0x2593, 3, {0xe2, 0x96, 0x93}},	/* 92 */
+    {0x201c, 3, {0xe2, 0x80, 0x9c}},	/* 93 */
+    {0x25a0, 3, {0xe2, 0x96, 0xa0}},	/* 94 */
+    {0x2219, 3, {0xe2, 0x88, 0x99}},	/* 95 */
+    {0x201d, 3, {0xe2, 0x80, 0x9d}},	/* 96 */
+    {0x2014, 3, {0xe2, 0x80, 0x94}},	/* 97 */
+    {0x2116, 3, {0xe2, 0x84, 0x96}},	/* 98 */
+    {0x2122, 3, {0xe2, 0x84, 0xa2}},	/* 99 */
+    {0x00a0, 2, {0xc2, 0xa0}},	/* 9A */
+    {0x00bb, 2, {0xc2, 0xbb}},	/* 9B */
+    {0x00ae, 2, {0xc2, 0xae}},	/* 9C */
+    {0x00ab, 2, {0xc2, 0xab}},	/* 9D */
+    {0x00b7, 2, {0xc2, 0xb7}},	/* 9E */
+    {0x00a4, 2, {0xc2, 0xa4}},	/* 9F */
+    {0x2550, 3, {0xe2, 0x95, 0x90}},	/* A0 */
+    {0x2551, 3, {0xe2, 0x95, 0x91}},	/* A1 */
+    {0x2552, 3, {0xe2, 0x95, 0x92}},	/* A2 */
+    {0x0451, 2, {0xd1, 0x91}},	/* A3 */
+    {0x0454, 2, {0xd1, 0x94}},	/* A4 */
+    {0x2554, 3, {0xe2, 0x95, 0x94}},	/* A5 */
+    {0x0456, 2, {0xd1, 0x96}},	/* A6 */
+    {0x0457, 2, {0xd1, 0x97}},	/* A7 */
+    {0x2557, 3, {0xe2, 0x95, 0x97}},	/* A8 */
+    {0x2558, 3, {0xe2, 0x95, 0x98}},	/* A9 */
+    {0x2559, 3, {0xe2, 0x95, 0x99}},	/* AA */
+    {0x255a, 3, {0xe2, 0x95, 0x9a}},	/* AB */
+    {0x255b, 3, {0xe2, 0x95, 0x9b}},	/* AC */
+    {0x0491, 2, {0xd2, 0x91}},	/* AD */
+    {0x045e, 2, {0xd1, 0x9e}},	/* AE */
+    {0x255e, 3, {0xe2, 0x95, 0x9e}},	/* AF */
+    {0x255f, 3, {0xe2, 0x95, 0x9f}},	/* B0 */
+    {0x2560, 3, {0xe2, 0x95, 0xa0}},	/* B1 */
+    {0x2561, 3, {0xe2, 0x95, 0xa1}},	/* B2 */
+    {0x0401, 2, {0xd0, 0x81}},	/* B3 */
+    {0x0404, 2, {0xd0, 0x84}},	/* B4 */
+    {0x2563, 3, {0xe2, 0x95, 0xa3}},	/* B5 */
+    {0x0406, 2, {0xd0, 0x86}},	/* B6 */
+    {0x0407, 2, {0xd0, 0x87}},	/* B7 */
+    {0x2566, 3, {0xe2, 0x95, 0xa6}},	/* B8 */
+    {0x2567, 3, {0xe2, 0x95, 0xa7}},	/* B9 */
+    {0x2568, 3, {0xe2, 0x95, 0xa8}},	/* BA */
+    {0x2569, 3, {0xe2, 0x95, 0xa9}},	/* BB */
+    {0x256a, 3, {0xe2, 0x95, 0xaa}},	/* BC */
+    {0x0490, 2, {0xd2, 0x90}},	/* BD */
+    {0x040e, 2, {0xd0, 0x8e}},	/* BE */
+    {0x00a9, 2, {0xc2, 0xa9}},	/* BF */
+    {0x044e, 2, {0xd1, 0x8e}},	/* C0 */
+    {0x0430, 2, {0xd0, 0xb0}},	/* C1 */
+    {0x0431, 2, {0xd0, 0xb1}},	/* C2 */
+    {0x0446, 2, {0xd1, 0x86}},	/* C3 */
+    {0x0434, 2, {0xd0, 0xb4}},	/* C4 */
+    {0x0435, 2, {0xd0, 0xb5}},	/* C5 */
+    {0x0444, 2, {0xd1, 0x84}},	/* C6 */
+    {0x0433, 2, {0xd0, 0xb3}},	/* C7 */
+    {0x0445, 2, {0xd1, 0x85}},	/* C8 */
+    {0x0438, 2, {0xd0, 0xb8}},	/* C9 */
+    {0x0439, 2, {0xd0, 0xb9}},	/* CA */
+    {0x043a, 2, {0xd0, 0xba}},	/* CB */
+    {0x043b, 2, {0xd0, 0xbb}},	/* CC */
+    {0x043c, 2, {0xd0, 0xbc}},	/* CD */
+    {0x043d, 2, {0xd0, 0xbd}},	/* CE */
+    {0x043e, 2, {0xd0, 0xbe}},	/* CF */
+    {0x043f, 2, {0xd0, 0xbf}},	/* D0 */
+    {0x044f, 2, {0xd1, 0x8f}},	/* D1 */
+    {0x0440, 2, {0xd1, 0x80}},	/* D2 */
+    {0x0441, 2, {0xd1, 0x81}},	/* D3 */
+    {0x0442, 2, {0xd1, 0x82}},	/* D4 */
+    {0x0443, 2, {0xd1, 0x83}},	/* D5 */
+    {0x0436, 2, {0xd0, 0xb6}},	/* D6 */
+    {0x0432, 2, {0xd0, 0xb2}},	/* D7 */
+    {0x044c, 2, {0xd1, 0x8c}},	/* D8 */
+    {0x044b, 2, {0xd1, 0x8b}},	/* D9 */
+    {0x0437, 2, {0xd0, 0xb7}},	/* DA */
+    {0x0448, 2, {0xd1, 0x88}},	/* DB */
+    {0x044d, 2, {0xd1, 0x8d}},	/* DC */
+    {0x0449, 2, {0xd1, 0x89}},	/* DD */
+    {0x0447, 2, {0xd1, 0x87}},	/* DE */
+    {0x044a, 2, {0xd1, 0x8a}},	/* DF */
+    {0x042e, 2, {0xd0, 0xae}},	/* E0 */
+    {0x0410, 2, {0xd0, 0x90}},	/* E1 */
+    {0x0411, 2, {0xd0, 0x91}},	/* E2 */
+    {0x0426, 2, {0xd0, 0xa6}},	/* E3 */
+    {0x0414, 2, {0xd0, 0x94}},	/* E4 */
+    {0x0415, 2, {0xd0, 0x95}},	/* E5 */
+    {0x0424, 2, {0xd0, 0xa4}},	/* E6 */
+    {0x0413, 2, {0xd0, 0x93}},	/* E7 */
+    {0x0425, 2, {0xd0, 0xa5}},	/* E8 */
+    {0x0418, 2, {0xd0, 0x98}},	/* E9 */
+    {0x0419, 2, {0xd0, 0x99}},	/* EA */
+    {0x041a, 2, {0xd0, 0x9a}},	/* EB */
+    {0x041b, 2, {0xd0, 0x9b}},	/* EC */
+    {0x041c, 2, {0xd0, 0x9c}},	/* ED */
+    {0x041d, 2, {0xd0, 0x9d}},	/* EE */
+    {0x041e, 2, {0xd0, 0x9e}},	/* EF */
+    {0x041f, 2, {0xd0, 0x9f}},	/* F0 */
+    {0x042f, 2, {0xd0, 0xaf}},	/* F1 */
+    {0x0420, 2, {0xd0, 0xa0}},	/* F2 */
+    {0x0421, 2, {0xd0, 0xa1}},	/* F3 */
+    {0x0422, 2, {0xd0, 0xa2}},	/* F4 */
+    {0x0423, 2, {0xd0, 0xa3}},	/* F5 */
+    {0x0416, 2, {0xd0, 0x96}},	/* F6 */
+    {0x0412, 2, {0xd0, 0x92}},	/* F7 */
+    {0x042c, 2, {0xd0, 0xac}},	/* F8 */
+    {0x042b, 2, {0xd0, 0xab}},	/* F9 */
+    {0x0417, 2, {0xd0, 0x97}},	/* FA */
+    {0x0428, 2, {0xd0, 0xa8}},	/* FB */
+    {0x042d, 2, {0xd0, 0xad}},	/* FC */
+    {0x0429, 2, {0xd0, 0xa9}},	/* FD */
+    {0x0427, 2, {0xd0, 0xa7}},	/* FE */
+    {0x042a, 2, {0xd0, 0xaa}},	/* FF */
+};
+
+static const ReverseData koi8_ru_rev[] =
+{
+    {0x00a0, 0x9A},
+    {0x00a4, 0x9F},
+    {0x00a9, 0xBF},
+    {0x00ab, 0x9D},
+    {0x00ae, 0x9C},
+    {0x00b7, 0x9E},
+    {0x00bb, 0x9B},
+    {0x0401, 0xB3},
+    {0x0404, 0xB4},
+    {0x0406, 0xB6},
+    {0x0407, 0xB7},
+    {0x040e, 0xBE},
+    {0x0410, 0xE1},
+    {0x0411, 0xE2},
+    {0x0412, 0xF7},
+    {0x0413, 0xE7},
+    {0x0414, 0xE4},
+    {0x0415, 0xE5},
+    {0x0416, 0xF6},
+    {0x0417, 0xFA},
+    {0x0418, 0xE9},
+    {0x0419, 0xEA},
+    {0x041a, 0xEB},
+    {0x041b, 0xEC},
+    {0x041c, 0xED},
+    {0x041d, 0xEE},
+    {0x041e, 0xEF},
+    {0x041f, 0xF0},
+    {0x0420, 0xF2},
+    {0x0421, 0xF3},
+    {0x0422, 0xF4},
+    {0x0423, 0xF5},
+    {0x0424, 0xE6},
+    {0x0425, 0xE8},
+    {0x0426, 0xE3},
+    {0x0427, 0xFE},
+    {0x0428, 0xFB},
+    {0x0429, 0xFD},
+    {0x042a, 0xFF},
+    {0x042b, 0xF9},
+    {0x042c, 0xF8},
+    {0x042d, 0xFC},
+    {0x042e, 0xE0},
+    {0x042f, 0xF1},
+    {0x0430, 0xC1},
+    {0x0431, 0xC2},
+    {0x0432, 0xD7},
+    {0x0433, 0xC7},
+    {0x0434, 0xC4},
+    {0x0435, 0xC5},
+    {0x0436, 0xD6},
+    {0x0437, 0xDA},
+    {0x0438, 0xC9},
+    {0x0439, 0xCA},
+    {0x043a, 0xCB},
+    {0x043b, 0xCC},
+    {0x043c, 0xCD},
+    {0x043d, 0xCE},
+    {0x043e, 0xCF},
+    {0x043f, 0xD0},
+    {0x0440, 0xD2},
+    {0x0441, 0xD3},
+    {0x0442, 0xD4},
+    {0x0443, 0xD5},
+    {0x0444, 0xC6},
+    {0x0445, 0xC8},
+    {0x0446, 0xC3},
+    {0x0447, 0xDE},
+    {0x0448, 0xDB},
+    {0x0449, 0xDD},
+    {0x044a, 0xDF},
+    {0x044b, 0xD9},
+    {0x044c, 0xD8},
+    {0x044d, 0xDC},
+    {0x044e, 0xC0},
+    {0x044f, 0xD1},
+    {0x0451, 0xA3},
+    {0x0454, 0xA4},
+    {0x0456, 0xA6},
+    {0x0457, 0xA7},
+    {0x045e, 0xAE},
+    {0x0490, 0xBD},
+    {0x0491, 0xAD},
+    {0x2014, 0x97},
+    {0x201c, 0x93},
+    {0x201d, 0x96},
+    {0x2116, 0x98},
+    {0x2122, 0x99},
+    {0x2219, 0x95},
+    {0x2500, 0x80},
+    {0x2502, 0x81},
+    {0x250c, 0x82},
+    {0x2510, 0x83},
+    {0x2514, 0x84},
+    {0x2518, 0x85},
+    {0x251c, 0x86},
+    {0x2524, 0x87},
+    {0x252c, 0x88},
+    {0x2534, 0x89},
+    {0x253c, 0x8A},
+    {0x2550, 0xA0},
+    {0x2551, 0xA1},
+    {0x2552, 0xA2},
+    {0x2554, 0xA5},
+    {0x2557, 0xA8},
+    {0x2558, 0xA9},
+    {0x2559, 0xAA},
+    {0x255a, 0xAB},
+    {0x255b, 0xAC},
+    {0x255e, 0xAF},
+    {0x255f, 0xB0},
+    {0x2560, 0xB1},
+    {0x2561, 0xB2},
+    {0x2563, 0xB5},
+    {0x2566, 0xB8},
+    {0x2567, 0xB9},
+    {0x2568, 0xBA},
+    {0x2569, 0xBB},
+    {0x256a, 0xBC},
+    {0x2580, 0x8B},
+    {0x2584, 0x8C},
+    {0x2588, 0x8D},
+    {0x258c, 0x8E},
+    {0x2590, 0x8F},
+    {0x2591, 0x90},
+    {0x2592, 0x91},
+    {0x2593, 0x92},
+    {0x25a0, 0x94},
+};
+
 static const BuiltInMapping koi8_u[] =
 {
     /* koi8-u */
@@ -1142,25 +6289,417 @@ static const BuiltInMapping koi8_u[] =
     {0x00FF, 0x042A},
 };
 
+static const MappingData koi8_u_utf8[] =
+{
+    {0x0000, 0, {0}},	/* 00 */
+    {0x0001, 0, {0}},	/* 01 */
+    {0x0002, 0, {0}},	/* 02 */
+    {0x0003, 0, {0}},	/* 03 */
+    {0x0004, 0, {0}},	/* 04 */
+    {0x0005, 0, {0}},	/* 05 */
+    {0x0006, 0, {0}},	/* 06 */
+    {0x0007, 0, {0}},	/* 07 */
+    {0x0008, 0, {0}},	/* 08 */
+    {0x0009, 0, {0}},	/* 09 */
+    {0x000a, 0, {0}},	/* 0A */
+    {0x000b, 0, {0}},	/* 0B */
+    {0x000c, 0, {0}},	/* 0C */
+    {0x000d, 0, {0}},	/* 0D */
+    {0x000e, 0, {0}},	/* 0E */
+    {0x000f, 0, {0}},	/* 0F */
+    {0x0010, 0, {0}},	/* 10 */
+    {0x0011, 0, {0}},	/* 11 */
+    {0x0012, 0, {0}},	/* 12 */
+    {0x0013, 0, {0}},	/* 13 */
+    {0x0014, 0, {0}},	/* 14 */
+    {0x0015, 0, {0}},	/* 15 */
+    {0x0016, 0, {0}},	/* 16 */
+    {0x0017, 0, {0}},	/* 17 */
+    {0x0018, 0, {0}},	/* 18 */
+    {0x0019, 0, {0}},	/* 19 */
+    {0x001a, 0, {0}},	/* 1A */
+    {0x001b, 0, {0}},	/* 1B */
+    {0x001c, 0, {0}},	/* 1C */
+    {0x001d, 0, {0}},	/* 1D */
+    {0x001e, 0, {0}},	/* 1E */
+    {0x001f, 0, {0}},	/* 1F */
+    {0x0020, 0, {0}},	/* 20 */
+    {0x0021, 0, {0}},	/* 21 */
+    {0x0022, 0, {0}},	/* 22 */
+    {0x0023, 0, {0}},	/* 23 */
+    {0x0024, 0, {0}},	/* 24 */
+    {0x0025, 0, {0}},	/* 25 */
+    {0x0026, 0, {0}},	/* 26 */
+    {0x0027, 0, {0}},	/* 27 */
+    {0x0028, 0, {0}},	/* 28 */
+    {0x0029, 0, {0}},	/* 29 */
+    {0x002a, 0, {0}},	/* 2A */
+    {0x002b, 0, {0}},	/* 2B */
+    {0x002c, 0, {0}},	/* 2C */
+    {0x002d, 0, {0}},	/* 2D */
+    {0x002e, 0, {0}},	/* 2E */
+    {0x002f, 0, {0}},	/* 2F */
+    {0x0030, 0, {0}},	/* 30 */
+    {0x0031, 0, {0}},	/* 31 */
+    {0x0032, 0, {0}},	/* 32 */
+    {0x0033, 0, {0}},	/* 33 */
+    {0x0034, 0, {0}},	/* 34 */
+    {0x0035, 0, {0}},	/* 35 */
+    {0x0036, 0, {0}},	/* 36 */
+    {0x0037, 0, {0}},	/* 37 */
+    {0x0038, 0, {0}},	/* 38 */
+    {0x0039, 0, {0}},	/* 39 */
+    {0x003a, 0, {0}},	/* 3A */
+    {0x003b, 0, {0}},	/* 3B */
+    {0x003c, 0, {0}},	/* 3C */
+    {0x003d, 0, {0}},	/* 3D */
+    {0x003e, 0, {0}},	/* 3E */
+    {0x003f, 0, {0}},	/* 3F */
+    {0x0040, 0, {0}},	/* 40 */
+    {0x0041, 0, {0}},	/* 41 */
+    {0x0042, 0, {0}},	/* 42 */
+    {0x0043, 0, {0}},	/* 43 */
+    {0x0044, 0, {0}},	/* 44 */
+    {0x0045, 0, {0}},	/* 45 */
+    {0x0046, 0, {0}},	/* 46 */
+    {0x0047, 0, {0}},	/* 47 */
+    {0x0048, 0, {0}},	/* 48 */
+    {0x0049, 0, {0}},	/* 49 */
+    {0x004a, 0, {0}},	/* 4A */
+    {0x004b, 0, {0}},	/* 4B */
+    {0x004c, 0, {0}},	/* 4C */
+    {0x004d, 0, {0}},	/* 4D */
+    {0x004e, 0, {0}},	/* 4E */
+    {0x004f, 0, {0}},	/* 4F */
+    {0x0050, 0, {0}},	/* 50 */
+    {0x0051, 0, {0}},	/* 51 */
+    {0x0052, 0, {0}},	/* 52 */
+    {0x0053, 0, {0}},	/* 53 */
+    {0x0054, 0, {0}},	/* 54 */
+    {0x0055, 0, {0}},	/* 55 */
+    {0x0056, 0, {0}},	/* 56 */
+    {0x0057, 0, {0}},	/* 57 */
+    {0x0058, 0, {0}},	/* 58 */
+    {0x0059, 0, {0}},	/* 59 */
+    {0x005a, 0, {0}},	/* 5A */
+    {0x005b, 0, {0}},	/* 5B */
+    {0x005c, 0, {0}},	/* 5C */
+    {0x005d, 0, {0}},	/* 5D */
+    {0x005e, 0, {0}},	/* 5E */
+    {0x005f, 0, {0}},	/* 5F */
+    {0x0060, 0, {0}},	/* 60 */
+    {0x0061, 0, {0}},	/* 61 */
+    {0x0062, 0, {0}},	/* 62 */
+    {0x0063, 0, {0}},	/* 63 */
+    {0x0064, 0, {0}},	/* 64 */
+    {0x0065, 0, {0}},	/* 65 */
+    {0x0066, 0, {0}},	/* 66 */
+    {0x0067, 0, {0}},	/* 67 */
+    {0x0068, 0, {0}},	/* 68 */
+    {0x0069, 0, {0}},	/* 69 */
+    {0x006a, 0, {0}},	/* 6A */
+    {0x006b, 0, {0}},	/* 6B */
+    {0x006c, 0, {0}},	/* 6C */
+    {0x006d, 0, {0}},	/* 6D */
+    {0x006e, 0, {0}},	/* 6E */
+    {0x006f, 0, {0}},	/* 6F */
+    {0x0070, 0, {0}},	/* 70 */
+    {0x0071, 0, {0}},	/* 71 */
+    {0x0072, 0, {0}},	/* 72 */
+    {0x0073, 0, {0}},	/* 73 */
+    {0x0074, 0, {0}},	/* 74 */
+    {0x0075, 0, {0}},	/* 75 */
+    {0x0076, 0, {0}},	/* 76 */
+    {0x0077, 0, {0}},	/* 77 */
+    {0x0078, 0, {0}},	/* 78 */
+    {0x0079, 0, {0}},	/* 79 */
+    {0x007a, 0, {0}},	/* 7A */
+    {0x007b, 0, {0}},	/* 7B */
+    {0x007c, 0, {0}},	/* 7C */
+    {0x007d, 0, {0}},	/* 7D */
+    {0x007e, 0, {0}},	/* 7E */
+    {0x007f, 0, {0}},	/* 7F */
+    {0x2500, 3, {0xe2, 0x94, 0x80}},	/* 80 */
+    {0x2502, 3, {0xe2, 0x94, 0x82}},	/* 81 */
+    {0x250c, 3, {0xe2, 0x94, 0x8c}},	/* 82 */
+    {0x2510, 3, {0xe2, 0x94, 0x90}},	/* 83 */
+    {0x2514, 3, {0xe2, 0x94, 0x94}},	/* 84 */
+    {0x2518, 3, {0xe2, 0x94, 0x98}},	/* 85 */
+    {0x251c, 3, {0xe2, 0x94, 0x9c}},	/* 86 */
+    {0x2524, 3, {0xe2, 0x94, 0xa4}},	/* 87 */
+    {0x252c, 3, {0xe2, 0x94, 0xac}},	/* 88 */
+    {0x2534, 3, {0xe2, 0x94, 0xb4}},	/* 89 */
+    {0x253c, 3, {0xe2, 0x94, 0xbc}},	/* 8A */
+    {0x2580, 3, {0xe2, 0x96, 0x80}},	/* 8B */
+    {0x2584, 3, {0xe2, 0x96, 0x84}},	/* 8C */
+    {0x2588, 3, {0xe2, 0x96, 0x88}},	/* 8D */
+    {0x258c, 3, {0xe2, 0x96, 0x8c}},	/* 8E */
+    {0x2590, 3, {0xe2, 0x96, 0x90}},	/* 8F */
+    {0x2591, 3, {0xe2, 0x96, 0x91}},	/* 90 */
+    {0x2592, 3, {0xe2, 0x96, 0x92}},	/* 91 */
+    {0x2593, 3, {0xe2, 0x96, 0x93}},	/* 92 */
+    {0x2320, 3, {0xe2, 0x8c, 0xa0}},	/* 93 */
+    {0x25a0, 3, {0xe2, 0x96, 0xa0}},	/* 94 */
+    {0x2219, 3, {0xe2, 0x88, 0x99}},	/* 95 */
+    {0x221a, 3, {0xe2, 0x88, 0x9a}},	/* 96 */
+    {0x2248, 3, {0xe2, 0x89, 0x88}},	/* 97 */
+    {0x2264, 3, {0xe2, 0x89, 0xa4}},	/* 98 */
+    {0x2265, 3, {0xe2, 0x89, 0xa5}},	/* 99 */
+    {0x00a0, 2, {0xc2, 0xa0}},	/* 9A */
+    {0x2321, 3, {0xe2, 0x8c, 0xa1}},	/* 9B */
+    {0x00b0, 2, {0xc2, 0xb0}},	/* 9C */
+    {0x00b2, 2, {0xc2, 0xb2}},	/* 9D */
+    {0x00b7, 2, {0xc2, 0xb7}},	/* 9E */
+    {0x00f7, 2, {0xc3, 0xb7}},	/* 9F */
+    {0x2550, 3, {0xe2, 0x95, 0x90}},	/* A0 */
+    {0x2551, 3, {0xe2, 0x95, 0x91}},	/* A1 */
+    {0x2552, 3, {0xe2, 0x95, 0x92}},	/* A2 */
+    {0x0451, 2, {0xd1, 0x91}},	/* A3 */
+    {0x0454, 2, {0xd1, 0x94}},	/* A4 */
+    {0x2554, 3, {0xe2, 0x95, 0x94}},	/* A5 */
+    {0x0456, 2, {0xd1, 0x96}},	/* A6 */
+    {0x0457, 2, {0xd1, 0x97}},	/* A7 */
+    {0x2557, 3, {0xe2, 0x95, 0x97}},	/* A8 */
+    {0x2558, 3, {0xe2, 0x95, 0x98}},	/* A9 */
+    {0x2559, 3, {0xe2, 0x95, 0x99}},	/* AA */
+    {0x255a, 3, {0xe2, 0x95, 0x9a}},	/* AB */
+    {0x255b, 3, {0xe2, 0x95, 0x9b}},	/* AC */
+    {0x0491, 2, {0xd2, 0x91}},	/* AD */
+    {0x255d, 3, {0xe2, 0x95, 0x9d}},	/* AE */
+    {0x255e, 3, {0xe2, 0x95, 0x9e}},	/* AF */
+    {0x255f, 3, {0xe2, 0x95, 0x9f}},	/* B0 */
+    {0x2560, 3, {0xe2, 0x95, 0xa0}},	/* B1 */
+    {0x2561, 3, {0xe2, 0x95, 0xa1}},	/* B2 */
+    {0x0401, 2, {0xd0, 0x81}},	/* B3 */
+    {0x0404, 2, {0xd0, 0x84}},	/* B4 */
+    {0x2563, 3, {0xe2, 0x95, 0xa3}},	/* B5 */
+    {0x0406, 2, {0xd0, 0x86}},	/* B6 */
+    {0x0407, 2, {0xd0, 0x87}},	/* B7 */
+    {0x2566, 3, {0xe2, 0x95, 0xa6}},	/* B8 */
+    {0x2567, 3, {0xe2, 0x95, 0xa7}},	/* B9 */
+    {0x2568, 3, {0xe2, 0x95, 0xa8}},	/* BA */
+    {0x2569, 3, {0xe2, 0x95, 0xa9}},	/* BB */
+    {0x256a, 3, {0xe2, 0x95, 0xaa}},	/* BC */
+    {0x0490, 2, {0xd2, 0x90}},	/* BD */
+    {0x256c, 3, {0xe2, 0x95, 0xac}},	/* BE */
+    {0x00a9, 2, {0xc2, 0xa9}},	/* BF */
+    {0x044e, 2, {0xd1, 0x8e}},	/* C0 */
+    {0x0430, 2, {0xd0, 0xb0}},	/* C1 */
+    {0x0431, 2, {0xd0, 0xb1}},	/* C2 */
+    {0x0446, 2, {0xd1, 0x86}},	/* C3 */
+    {0x0434, 2, {0xd0, 0xb4}},	/* C4 */
+    {0x0435, 2, {0xd0, 0xb5}},	/* C5 */
+    {0x0444, 2, {0xd1, 0x84}},	/* C6 */
+    {0x0433, 2, {0xd0, 0xb3}},	/* C7 */
+    {0x0445, 2, {0xd1, 0x85}},	/* C8 */
+    {0x0438, 2, {0xd0, 0xb8}},	/* C9 */
+    {0x0439, 2, {0xd0, 0xb9}},	/* CA */
+    {0x043a, 2, {0xd0, 0xba}},	/* CB */
+    {0x043b, 2, {0xd0, 0xbb}},	/* CC */
+    {0x043c, 2, {0xd0, 0xbc}},	/* CD */
+    {0x043d, 2, {0xd0, 0xbd}},	/* CE */
+    {0x043e, 2, {0xd0, 0xbe}},	/* CF */
+    {0x043f, 2, {0xd0, 0xbf}},	/* D0 */
+    {0x044f, 2, {0xd1, 0x8f}},	/* D1 */
+    {0x0440, 2, {0xd1, 0x80}},	/* D2 */
+    {0x0441, 2, {0xd1, 0x81}},	/* D3 */
+    {0x0442, 2, {0xd1, 0x82}},	/* D4 */
+    {0x0443, 2, {0xd1, 0x83}},	/* D5 */
+    {0x0436, 2, {0xd0, 0xb6}},	/* D6 */
+    {0x0432, 2, {0xd0, 0xb2}},	/* D7 */
+    {0x044c, 2, {0xd1, 0x8c}},	/* D8 */
+    {0x044b, 2, {0xd1, 0x8b}},	/* D9 */
+    {0x0437, 2, {0xd0, 0xb7}},	/* DA */
+    {0x0448, 2, {0xd1, 0x88}},	/* DB */
+    {0x044d, 2, {0xd1, 0x8d}},	/* DC */
+    {0x0449, 2, {0xd1, 0x89}},	/* DD */
+    {0x0447, 2, {0xd1, 0x87}},	/* DE */
+    {0x044a, 2, {0xd1, 0x8a}},	/* DF */
+    {0x042e, 2, {0xd0, 0xae}},	/* E0 */
+    {0x0410, 2, {0xd0, 0x90}},	/* E1 */
+    {0x0411, 2, {0xd0, 0x91}},	/* E2 */
+    {0x0426, 2, {0xd0, 0xa6}},	/* E3 */
+    {0x0414, 2, {0xd0, 0x94}},	/* E4 */
+    {0x0415, 2, {0xd0, 0x95}},	/* E5 */
+    {0x0424, 2, {0xd0, 0xa4}},	/* E6 */
+    {0x0413, 2, {0xd0, 0x93}},	/* E7 */
+    {0x0425, 2, {0xd0, 0xa5}},	/* E8 */
+    {0x0418, 2, {0xd0, 0x98}},	/* E9 */
+    {0x0419, 2, {0xd0, 0x99}},	/* EA */
+    {0x041a, 2, {0xd0, 0x9a}},	/* EB */
+    {0x041b, 2, {0xd0, 0x9b}},	/* EC */
+    {0x041c, 2, {0xd0, 0x9c}},	/* ED */
+    {0x041d, 2, {0xd0, 0x9d}},	/* EE */
+    {0x041e, 2, {0xd0, 0x9e}},	/* EF */
+    {0x041f, 2, {0xd0, 0x9f}},	/* F0 */
+    {0x042f, 2, {0xd0, 0xaf}},	/* F1 */
+    {0x0420, 2, {0xd0, 0xa0}},	/* F2 */
+    {0x0421, 2, {0xd0, 0xa1}},	/* F3 */
+    {0x0422, 2, {0xd0, 0xa2}},	/* F4 */
+    {0x0423, 2, {0xd0, 0xa3}},	/* F5 */
+    {0x0416, 2, {0xd0, 0x96}},	/* F6 */
+    {0x0412, 2, {0xd0, 0x92}},	/* F7 */
+    {0x042c, 2, {0xd0, 0xac}},	/* F8 */
+    {0x042b, 2, {0xd0, 0xab}},	/* F9 */
+    {0x0417, 2, {0xd0, 0x97}},	/* FA */
+    {0x0428, 2, {0xd0, 0xa8}},	/* FB */
+    {0x042d, 2, {0xd0, 0xad}},	/* FC */
+    {0x0429, 2, {0xd0, 0xa9}},	/* FD */
+    {0x0427, 2, {0xd0, 0xa7}},	/* FE */
+    {0x042a, 2, {0xd0, 0xaa}},	/* FF */
+};
+
+static const ReverseData koi8_u_rev[] =
+{
+    {0x00a0, 0x9A},
+    {0x00a9, 0xBF},
+    {0x00b0, 0x9C},
+    {0x00b2, 0x9D},
+    {0x00b7, 0x9E},
+    {0x00f7, 0x9F},
+    {0x0401, 0xB3},
+    {0x0404, 0xB4},
+    {0x0406, 0xB6},
+    {0x0407, 0xB7},
+    {0x0410, 0xE1},
+    {0x0411, 0xE2},
+    {0x0412, 0xF7},
+    {0x0413, 0xE7},
+    {0x0414, 0xE4},
+    {0x0415, 0xE5},
+    {0x0416, 0xF6},
+    {0x0417, 0xFA},
+    {0x0418, 0xE9},
+    {0x0419, 0xEA},
+    {0x041a, 0xEB},
+    {0x041b, 0xEC},
+    {0x041c, 0xED},
+    {0x041d, 0xEE},
+    {0x041e, 0xEF},
+    {0x041f, 0xF0},
+    {0x0420, 0xF2},
+    {0x0421, 0xF3},
+    {0x0422, 0xF4},
+    {0x0423, 0xF5},
+    {0x0424, 0xE6},
+    {0x0425, 0xE8},
+    {0x0426, 0xE3},
+    {0x0427, 0xFE},
+    {0x0428, 0xFB},
+    {0x0429, 0xFD},
+    {0x042a, 0xFF},
+    {0x042b, 0xF9},
+    {0x042c, 0xF8},
+    {0x042d, 0xFC},
+    {0x042e, 0xE0},
+    {0x042f, 0xF1},
+    {0x0430, 0xC1},
+    {0x0431, 0xC2},
+    {0x0432, 0xD7},
+    {0x0433, 0xC7},
+    {0x0434, 0xC4},
+    {0x0435, 0xC5},
+    {0x0436, 0xD6},
+    {0x0437, 0xDA},
+    {0x0438, 0xC9},
+    {0x0439, 0xCA},
+    {0x043a, 0xCB},
+    {0x043b, 0xCC},
+    {0x043c, 0xCD},
+    {0x043d, 0xCE},
+    {0x043e, 0xCF},
+    {0x043f, 0xD0},
+    {0x0440, 0xD2},
+    {0x0441, 0xD3},
+    {0x0442, 0xD4},
+    {0x0443, 0xD5},
+    {0x0444, 0xC6},
+    {0x0445, 0xC8},
+    {0x0446, 0xC3},
+    {0x0447, 0xDE},
+    {0x0448, 0xDB},
+    {0x0449, 0xDD},
+    {0x044a, 0xDF},
+    {0x044b, 0xD9},
+    {0x044c, 0xD8},
+    {0x044d, 0xDC},
+    {0x044e, 0xC0},
+    {0x044f, 0xD1},
+    {0x0451, 0xA3},
+    {0x0454, 0xA4},
+    {0x0456, 0xA6},
+    {0x0457, 0xA7},
+    {0x0490, 0xBD},
+    {0x0491, 0xAD},
+    {0x2219, 0x95},
+    {0x221a, 0x96},
+    {0x2248, 0x97},
+    {0x2264, 0x98},
+    {0x2265, 0x99},
+    {0x2320, 0x93},
+    {0x2321, 0x9B},
+    {0x2500, 0x80},
+    {0x2502, 0x81},
+    {0x250c, 0x82},
+    {0x2510, 0x83},
+    {0x2514, 0x84},
+    {0x2518, 0x85},
+    {0x251c, 0x86},
+    {0x2524, 0x87},
+    {0x252c, 0x88},
+    {0x2534, 0x89},
+    {0x253c, 0x8A},
+    {0x2550, 0xA0},
+    {0x2551, 0xA1},
+    {0x2552, 0xA2},
+    {0x2554, 0xA5},
+    {0x2557, 0xA8},
+    {0x2558, 0xA9},
+    {0x2559, 0xAA},
+    {0x255a, 0xAB},
+    {0x255b, 0xAC},
+    {0x255d, 0xAE},
+    {0x255e, 0xAF},
+    {0x255f, 0xB0},
+    {0x2560, 0xB1},
+    {0x2561, 0xB2},
+    {0x2563, 0xB5},
+    {0x2566, 0xB8},
+    {0x2567, 0xB9},
+    {0x2568, 0xBA},
+    {0x2569, 0xBB},
+    {0x256a, 0xBC},
+    {0x256c, 0xBE},
+    {0x2580, 0x8B},
+    {0x2584, 0x8C},
+    {0x2588, 0x8D},
+    {0x258c, 0x8E},
+    {0x2590, 0x8F},
+    {0x2591, 0x90},
+    {0x2592, 0x91},
+    {0x2593, 0x92},
+    {0x25a0, 0x94},
+};
+
 #define DATA(name) name, SizeOf(name)
 const BuiltInCharsetRec builtin_encodings[] =
 {
-    { "dec-special", DATA(dec_special) },
-    { "dec-technical", DATA(dec_technical) },
-    { "iso8859-1", DATA(iso8859_1) },
-    { "iso8859-10", DATA(iso8859_10) },
-    { "iso8859-15", DATA(iso8859_15) },
-    { "iso8859-2", DATA(iso8859_2) },
-    { "iso8859-3", DATA(iso8859_3) },
-    { "iso8859-4", DATA(iso8859_4) },
-    { "iso8859-5", DATA(iso8859_5) },
-    { "iso8859-6", DATA(iso8859_6) },
-    { "iso8859-7", DATA(iso8859_7) },
-    { "iso8859-8", DATA(iso8859_8) },
-    { "iso8859-9", DATA(iso8859_9) },
-    { "koi8-e", DATA(koi8_e) },
-    { "koi8-r", DATA(koi8_r) },
-    { "koi8-ru", DATA(koi8_ru) },
-    { "koi8-u", DATA(koi8_u) },
-    { 0, 0, 0 }
+    { "dec-special", DATA(dec_special), dec_special_utf8, DATA(dec_special_rev) },
+    { "dec-technical", DATA(dec_technical), dec_technical_utf8, DATA(dec_technical_rev) },
+    { "iso8859-1", DATA(iso8859_1), iso8859_1_utf8, iso8859_1_rev, 0 },
+    { "iso8859-10", DATA(iso8859_10), iso8859_10_utf8, DATA(iso8859_10_rev) },
+    { "iso8859-15", DATA(iso8859_15), iso8859_15_utf8, DATA(iso8859_15_rev) },
+    { "iso8859-2", DATA(iso8859_2), iso8859_2_utf8, DATA(iso8859_2_rev) },
+    { "iso8859-3", DATA(iso8859_3), iso8859_3_utf8, DATA(iso8859_3_rev) },
+    { "iso8859-4", DATA(iso8859_4), iso8859_4_utf8, DATA(iso8859_4_rev) },
+    { "iso8859-5", DATA(iso8859_5), iso8859_5_utf8, DATA(iso8859_5_rev) },
+    { "iso8859-6", DATA(iso8859_6), iso8859_6_utf8, DATA(iso8859_6_rev) },
+    { "iso8859-7", DATA(iso8859_7), iso8859_7_utf8, DATA(iso8859_7_rev) },
+    { "iso8859-8", DATA(iso8859_8), iso8859_8_utf8, DATA(iso8859_8_rev) },
+    { "iso8859-9", DATA(iso8859_9), iso8859_9_utf8, DATA(iso8859_9_rev) },
+    { "koi8-e", DATA(koi8_e), koi8_e_utf8, DATA(koi8_e_rev) },
+    { "koi8-r", DATA(koi8_r), koi8_r_utf8, DATA(koi8_r_rev) },
+    { "koi8-ru", DATA(koi8_ru), koi8_ru_utf8, DATA(koi8_ru_rev) },
+    { "koi8-u", DATA(koi8_u), koi8_u_utf8, DATA(koi8_u_rev) },
+    { 0, 0, 0, 0, 0, 0 }
 };
@@ -0,0 +1,483 @@
+/*
+ * Copyright 2026 by the luit contributors
+ *
+ * All Rights Reserved
+ *
+ * Permission to use, copy, modify, and distribute this software and its
+ * documentation for any purpose and without fee is hereby granted,
+ * provided that the above copyright notice appear in all copies and that
+ * both that copyright notice and this permission notice appear in
+ * supporting documentation, and that the name of the above listed
+ * copyright holder(s) not be used in advertising or publicity pertaining
+ * to distribution of the software without specific, written prior
+ * permission.
+ *
+ * THE ABOVE LISTED COPYRIGHT HOLDER(S) DISCLAIM ALL WARRANTIES WITH REGARD
+ * TO THIS SOFTWARE, INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS, IN NO EVENT SHALL THE ABOVE LISTED COPYRIGHT HOLDER(S) BE
+ * LIABLE FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * A capture records each read and write which luit makes, with the time and
+ * direction, so that a session can be replayed through the converter later.
+ *
+ * The file begins with the 8 bytes "luitcap1" and the starting time(), as a
+ * number.  Each record follows as
+ *
+ *	type	one byte, CAP_KEYBOARD, CAP_PROGRAM, CAP_TO_PROGRAM or
+ *		CAP_TO_TERMINAL
+ *	delay	number, microseconds since the previous record
+ *	size	number
+ *	data	size bytes
+ *
+ * Numbers are unsigned, written 7 bits per byte starting with the low bits,
+ * and the high bit set on all but the last byte.
+ *
+ * Records are collected in memory, and passed in blocks from the main loop to
+ * the log writer (see logfile.c), rather than one at a time.  If the name
+ * ends with ".gz", the file is compressed.
+ *
+ * The flight recorder keeps only the most recent records, in a ring of fixed
+ * size, and writes them in the same format when asked.
+ */
+
+#include <capture.h>
+
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifdef USE_ZLIB
+#include <zlib.h>
+#endif
+
+#include <sys.h>
+#include <logfile.h>
+
+#define CAPTURE_MAGIC	"luitcap1"
+#define CAPTURE_BLOCK	65536	/* write when this much is pending */
+#define CAPTURE_DELAY	1000000UL	/* or when it has waited this long */
+#define NUMBER_MAX	10	/* bytes for an unsigned long */
+#define RECORD_MAX	(16 * CAPTURE_BLOCK)	/* longest record to replay */
+#define FLIGHT_MIN	4096	/* smallest flight recorder ring */
+
+int capturing = 0;
+int recording = 0;
+
+static int capture_log = -1;
+static unsigned char *capture_buf;
+static size_t capture_len;
+static size_t capture_count;
+static unsigned long capture_last;	/* time of the last record */
+static unsigned long capture_since;	/* time of the oldest pending data */
+
+static void
+captureReserve(size_t count)
+{
+    size_t need = capture_count + count;
+
+    if (need > capture_len) {
+	need = ((need / CAPTURE_BLOCK) + 2) * CAPTURE_BLOCK;
+	capture_buf = realloc(capture_buf, need);
+	if (capture_buf == NULL)
+	    FatalError("Couldn't grow capture buffer.\n");
+	capture_len = need;
+    }
+}
+
+static size_t
+encodeNumber(unsigned char *buf, unsigned long value)
+{
+    size_t n = 0;
+
+    while (value >= 0x80) {
+	buf[n++] = (unsigned char) (0x80 | (value & 0x7F));
+	value >>= 7;
+    }
+    buf[n++] = (unsigned char) value;
+    return n;
+}
+
+static void
+captureNumber(unsigned long value)
+{
+    capture_count += encodeNumber(capture_buf + capture_count, value);
+}
+
+int
+openCapture(const char *name)
+{
+    capture_log = openLog(name, 0600);
+    if (capture_log < 0)
+	return -1;
+    captureReserve(sizeof(CAPTURE_MAGIC) + NUMBER_MAX);
+    memcpy(capture_buf, CAPTURE_MAGIC, sizeof(CAPTURE_MAGIC) - 1);
+    capture_count = sizeof(CAPTURE_MAGIC) - 1;
+    captureNumber((unsigned long) time(NULL));
+    capture_last = capture_since = monotonicUsecs();
+    capturing = 1;
+    return 0;
+}
+
+/*
+ * Begin a record of the given size.  Its data follows in one or more calls to
+ * captureData().
+ */
+void
+captureStart(int type, size_t size)
+{
+    unsigned long now = monotonicUsecs();
+
+    captureReserve(1 + 2 * NUMBER_MAX + size);
+    capture_buf[capture_count++] = (unsigned char) type;
+    captureNumber(now - capture_last);
+    captureNumber((unsigned long) size);
+    capture_last = now;
+}
+
+void
+captureData(const unsigned char *data, size_t size)
+{
+    captureReserve(size);
+    memcpy(capture_buf + capture_count, data, size);
+    capture_count += size;
+}
+
+void
+captureChunk(int type, const unsigned char *data, size_t size)
+{
+    captureStart(type, size);
+    captureData(data, size);
+}
+
+/*
+ * Write the pending records if there is a block of them, if they have waited
+ * long enough, or if "force" is set.
+ */
+void
+flushCapture(int force)
+{
+    unsigned long now;
+
+    if (capture_log < 0 || capture_count == 0)
+	return;
+    now = monotonicUsecs();
+    if (!force
+	&& capture_count < CAPTURE_BLOCK
+	&& (now - capture_since) < CAPTURE_DELAY)
+	return;
+
+    writeLog(capture_log, capture_buf, capture_count);
+    capture_count = 0;
+    capture_since = now;
+}
+
+void
+closeCapture(void)
+{
+    flushCapture(1);
+    capture_log = -1;
+    capturing = 0;
+    if (capture_buf != NULL) {
+	free(capture_buf);
+	capture_buf = NULL;
+    }
+    capture_len = 0;
+    capture_count = 0;
+}
+
+/*
+ * Each record in the flight recorder's ring is a FlightHead followed by its
+ * data, either of which may wrap around the end of the ring.  The oldest
+ * records are discarded to make room for new ones.
+ */
+typedef struct {
+    unsigned long when;		/* monotonicUsecs() */
+    size_t size;
+    int type;
+} FlightHead;
+
+static unsigned char *flight_ring;
+static size_t flight_len;
+static size_t flight_head;	/* offset of the oldest record */
+static size_t flight_used;
+static size_t flight_skip;	/* leading bytes of a record too large to keep */
+
+static void
+flightPut(const void *data, size_t size)
+{
+    const unsigned char *s = data;
+    size_t at = (flight_head + flight_used) % flight_len;
+    size_t part = flight_len - at;
+
+    if (part > size)
+	part = size;
+    memcpy(flight_ring + at, s, part);
+    memcpy(flight_ring, s + part, size - part);
+    flight_used += size;
+}
+
+static void
+flightGet(size_t at, void *data, size_t size)
+{
+    unsigned char *s = data;
+    size_t part = flight_len - at;
+
+    if (part > size)
+	part = size;
+    memcpy(s, flight_ring + at, part);
+    memcpy(s + part, flight_ring, size - part);
+}
+
+int
+openFlight(size_t size)
+{
+    if (size < FLIGHT_MIN)
+	size = FLIGHT_MIN;
+    if ((flight_ring = malloc(size)) == NULL)
+	return -1;
+    flight_len = size;
+    flight_head = 0;
+    flight_used = 0;
+    recording = 1;
+    return 0;
+}
+
+/*
+ * Begin a record of the given size, discarding old records to make room.  A
+ * record larger than the ring keeps only its end.
+ */
+void
+flightStart(int type, size_t size)
+{
+    FlightHead head;
+    size_t room = flight_len - sizeof(head);
+
+    flight_skip = 0;
+    if (size > room) {
+	flight_skip = size - room;
+	size = room;
+    }
+    while (flight_used + sizeof(head) + size > flight_len) {
+	FlightHead old;
+
+	flightGet(flight_head, &old, sizeof(old));
+	flight_head = (flight_head + sizeof(old) + old.size) % flight_len;
+	flight_used -= sizeof(old) + old.size;
+    }
+    head.when = monotonicUsecs();
+    head.size = size;
+    head.type = type;
+    flightPut(&head, sizeof(head));
+}
+
+void
+flightData(const unsigned char *data, size_t size)
+{
+    if (flight_skip != 0) {
+	size_t skip = (size < flight_skip) ? size : flight_skip;
+
+	data += skip;
+	size -= skip;
+	flight_skip -= skip;
+    }
+    flightPut(data, size);
+}
+
+void
+flightChunk(int type, const unsigned char *data, size_t size)
+{
+    flightStart(type, size);
+    flightData(data, size);
+}
+
+static int
+writeAll(int fd, const unsigned char *data, size_t size)
+{
+    while (size != 0) {
+	ssize_t rc = write(fd, data, size);
+
+	if (rc < 0) {
+	    if (errno == EINTR)
+		continue;
+	    return -1;
+	}
+	data += rc;
+	size -= (size_t) rc;
+    }
+    return 0;
+}
+
+/*
+ * Write the flight recorder's records to "fd" as a capture file.  This uses
+ * only functions which are safe in a signal handler, so that it can be called
+ * after a crash.  A record which was being added at the time may be garbled.
+ */
+int
+dumpFlight(int fd)
+{
+    unsigned char buf[sizeof(CAPTURE_MAGIC) + 2 * NUMBER_MAX];
+    FlightHead head;
+    size_t at = flight_head;
+    size_t left = flight_used;
+    size_t part;
+    size_t n;
+    unsigned long now = monotonicUsecs();
+    unsigned long last = now;
+
+    if (left >= sizeof(head)) {
+	flightGet(at, &head, sizeof(head));
+	last = head.when;
+    }
+    memcpy(buf, CAPTURE_MAGIC, sizeof(CAPTURE_MAGIC) - 1);
+    n = sizeof(CAPTURE_MAGIC) - 1;
+    n += encodeNumber(buf + n,
+		      (unsigned long) time(NULL) - (now - last) / 1000000UL);
+    if (writeAll(fd, buf, n) < 0)
+	return -1;
+
+    while (left >= sizeof(head)) {
+	flightGet(at, &head, sizeof(head));
+	if (head.size > left - sizeof(head))
+	    break;
+	buf[0] = (unsigned char) head.type;
+	n = 1;
+	n += encodeNumber(buf + n, head.when - last);
+	n += encodeNumber(buf + n, (unsigned long) head.size);
+	last = head.when;
+
+	at = (at + sizeof(head)) % flight_len;
+	part = flight_len - at;
+	if (part > head.size)
+	    part = head.size;
+	if (writeAll(fd, buf, n) < 0
+	    || writeAll(fd, flight_ring + at, part) < 0
+	    || writeAll(fd, flight_ring, head.size - part) < 0)
+	    return -1;
+	at = (at + head.size) % flight_len;
+	left -= sizeof(head) + head.size;
+    }
+    return 0;
+}
+
+void
+closeFlight(void)
+{
+    recording = 0;
+    if (flight_ring != NULL) {
+	free(flight_ring);
+	flight_ring = NULL;
+    }
+    flight_len = 0;
+    flight_used = 0;
+}
+
+/*
+ * A capture file is read with zlib if possible, which also reads files which
+ * are not compressed.
+ */
+struct _ReplayFile {
+#ifdef USE_ZLIB
+    gzFile fp;
+#else
+    FILE *fp;
+#endif
+};
+
+#ifdef USE_ZLIB
+#define ReplayOpen(name)	  gzopen(name, "rb")
+#define ReplayGetc(fp)		  gzgetc(fp)
+#define ReplayRead(fp, buf, size) (gzread(fp, buf, (unsigned) (size)) == (int) (size))
+#define ReplayClose(fp)		  gzclose(fp)
+#else
+#define ReplayOpen(name)	  fopen(name, "rb")
+#define ReplayGetc(fp)		  fgetc(fp)
+#define ReplayRead(fp, buf, size) (fread(buf, size, (size_t) 1, fp) == 1)
+#define ReplayClose(fp)		  fclose(fp)
+#endif
+
+static int
+replayNumber(ReplayFile * rf, unsigned long *value)
+{
+    unsigned shift = 0;
+    int ch;
+
+    *value = 0;
+    while ((ch = ReplayGetc(rf->fp)) != EOF) {
+	if (shift >= 8 * sizeof(*value))
+	    return -1;
+	*value |= (unsigned long) (ch & 0x7F) << shift;
+	if (!(ch & 0x80))
+	    return 0;
+	shift += 7;
+    }
+    return -1;
+}
+
+/*
+ * Open a capture file for replay, checking its header.
+ */
+ReplayFile *
+openReplay(const char *name)
+{
+    ReplayFile *rf;
+    char magic[sizeof(CAPTURE_MAGIC)];
+    unsigned long started;
+
+    if ((rf = TypeCalloc(ReplayFile)) == NULL)
+	return NULL;
+    if ((rf->fp = ReplayOpen(name)) == NULL) {
+	free(rf);
+	return NULL;
+    }
+    if (!ReplayRead(rf->fp, magic, sizeof(magic) - 1)
+	|| memcmp(magic, CAPTURE_MAGIC, sizeof(magic) - 1)
+	|| replayNumber(rf, &started) < 0) {
+	closeReplay(rf);
+	errno = EINVAL;
+	return NULL;
+    }
+    return rf;
+}
+
+/*
+ * Read the next record into "rec", reusing its data buffer.  Returns 1 for a
+ * record, 0 at the end of the file, or -1 if the file is truncated or corrupt.
+ * Each record holds a single read or write, of at most a few times
+ * BUFFER_SIZE, so a length beyond RECORD_MAX means the file is corrupt.
+ */
+int
+readReplay(ReplayFile * rf, CaptureRec * rec)
+{
+    unsigned long size;
+    int ch;
+
+    if ((ch = ReplayGetc(rf->fp)) == EOF)
+	return 0;
+    rec->type = ch;
+    if (replayNumber(rf, &rec->delay) < 0
+	|| replayNumber(rf, &size) < 0
+	|| size > RECORD_MAX)
+	return -1;
+    if (size > rec->data_len) {
+	rec->data = realloc(rec->data, (size_t) size);
+	if (rec->data == NULL)
+	    FatalError("Couldn't allocate replay buffer.\n");
+	rec->data_len = (size_t) size;
+    }
+    rec->size = (size_t) size;
+    if (size != 0 && !ReplayRead(rf->fp, rec->data, rec->size))
+	return -1;
+    return 1;
+}
+
+void
+closeReplay(ReplayFile * rf)
+{
+    ReplayClose(rf->fp);
+    free(rf);
+}
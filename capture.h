@@ -0,0 +1,68 @@
+/*
+ * Copyright 2026 by the luit contributors
+ *
+ * All Rights Reserved
+ *
+ * Permission to use, copy, modify, and distribute this software and its
+ * documentation for any purpose and without fee is hereby granted,
+ * provided that the above copyright notice appear in all copies and that
+ * both that copyright notice and this permission notice appear in
+ * supporting documentation, and that the name of the above listed
+ * copyright holder(s) not be used in advertising or publicity pertaining
+ * to distribution of the software without specific, written prior
+ * permission.
+ *
+ * THE ABOVE LISTED COPYRIGHT HOLDER(S) DISCLAIM ALL WARRANTIES WITH REGARD
+ * TO THIS SOFTWARE, INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS, IN NO EVENT SHALL THE ABOVE LISTED COPYRIGHT HOLDER(S) BE
+ * LIABLE FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef LUIT_CAPTURE_H
+#define LUIT_CAPTURE_H 1
+
+#include <luit.h>
+
+/*
+ * Record types in a capture file.
+ */
+#define CAP_KEYBOARD	'k'	/* read from the keyboard */
+#define CAP_PROGRAM	'p'	/* read from the program, on the pty */
+#define CAP_TO_PROGRAM	'K'	/* converted keyboard input, written */
+#define CAP_TO_TERMINAL	'P'	/* converted program output, written */
+
+typedef struct {
+    int type;
+    unsigned long delay;	/* microseconds since the previous record */
+    size_t size;
+    unsigned char *data;
+    size_t data_len;		/* allocated size of data */
+} CaptureRec;
+
+typedef struct _ReplayFile ReplayFile;
+
+extern int capturing;
+extern int recording;
+
+int openCapture(const char *);
+void captureStart(int, size_t);
+void captureData(const unsigned char *, size_t);
+void captureChunk(int, const unsigned char *, size_t);
+void flushCapture(int);
+void closeCapture(void);
+
+int openFlight(size_t);
+void flightStart(int, size_t);
+void flightData(const unsigned char *, size_t);
+void flightChunk(int, const unsigned char *, size_t);
+int dumpFlight(int);
+void closeFlight(void);
+
+ReplayFile *openReplay(const char *);
+int readReplay(ReplayFile *, CaptureRec *);
+void closeReplay(ReplayFile *);
+
+#endif /* LUIT_CAPTURE_H */
@@ -183,6 +183,133 @@ compare1(const char *s, const char *t, size_t n)
     return result;
 }
 
+/*
+ * Lookups by name use a canonical key: the name in lowercase, without the
+ * characters that lcStrCmp() ignores.  Two names match with lcStrCmp() exactly
+ * when their keys are equal, so the tables below hash on the key rather than
+ * scanning with lcStrCmp().
+ */
+#define NAME_HASH	128
+#define NAME_KEY	256
+
+typedef struct {
+    unsigned hash;
+    char text[NAME_KEY];
+} NameKey;
+
+typedef struct _NameEntry {
+    struct _NameEntry *next;
+    const void *data;
+    void *item;			/* data, for tables which are updated */
+    char key[1];
+} NameEntry, *NameEntryPtr;
+
+typedef struct {
+    int ready;
+    NameEntryPtr bucket[NAME_HASH];
+} NameTable;
+
+/*
+ * Returns false if the name is too long to be a key; no charset has a name
+ * that long, so the caller can treat that as a miss.
+ */
+static int
+makeNameKey(NameKey * key, const char *name)
+{
+    size_t n = 0;
+
+    key->hash = 0;
+    while (*name) {
+	if (!lcIgnore(*name)) {
+	    if (n + 1 >= sizeof(key->text))
+		return 0;
+	    key->text[n] = (char) tolower(UChar(*name));
+	    key->hash = (key->hash * 31) + UChar(key->text[n]);
+	    ++n;
+	}
+	++name;
+    }
+    key->text[n] = '\0';
+    key->hash %= NAME_HASH;
+    return 1;
+}
+
+/*
+ * Find the first entry for the key, or the next one after "after".
+ */
+static NameEntryPtr
+findName(NameTable * table, const NameKey * key, NameEntryPtr after)
+{
+    NameEntryPtr p = (after != NULL) ? after->next : table->bucket[key->hash];
+
+    while (p != NULL && strcmp(p->key, key->text))
+	p = p->next;
+    return p;
+}
+
+/*
+ * Entries are appended, so that findName() returns them in table order.
+ */
+static NameEntryPtr
+addName(NameTable * table, const NameKey * key, const void *data)
+{
+    NameEntryPtr *pp = &(table->bucket[key->hash]);
+    NameEntryPtr p;
+
+    if ((p = malloc(sizeof(NameEntry) + strlen(key->text))) != NULL) {
+	p->next = NULL;
+	p->data = data;
+	p->item = NULL;
+	strcpy(p->key, key->text);
+	while (*pp != NULL)
+	    pp = &((*pp)->next);
+	*pp = p;
+    }
+    return p;
+}
+
+static void
+addNames(NameTable * table, const char *name, const void *data)
+{
+    NameKey key;
+
+    if (makeNameKey(&key, name))
+	addName(table, &key, data);
+}
+
+static void
+addItems(NameTable * table, const char *name, void *item)
+{
+    NameKey key;
+    NameEntryPtr p;
+
+    if (makeNameKey(&key, name)
+	&& (p = addName(table, &key, item)) != NULL)
+	p->item = item;
+}
+
+#ifdef NO_LEAKS
+static void
+freeNames(NameTable * table)
+{
+    int n;
+
+    for (n = 0; n < NAME_HASH; ++n) {
+	while (table->bucket[n] != NULL) {
+	    NameEntryPtr next = table->bucket[n]->next;
+	    free(table->bucket[n]);
+	    table->bucket[n] = next;
+	}
+    }
+    table->ready = 0;
+}
+#endif
+
+static NameTable fontencNames;
+static NameTable otherNames;
+static NameTable localeNames;
+static NameTable cachedNames;	/* cached charsets, and names that failed */
+
 static unsigned int
 FontencCharsetRecode(unsigned int n, const CharsetRec * self)
 {
@@ -191,14 +318,35 @@ FontencCharsetRecode(unsigned int n, const CharsetRec * self)
 
     result = MapCodeValue(n + fc->shift, fc->mapping);
 
-    TRACE(("FontencCharsetRecode %#x ->%#x%s\n",
-	   n,
-	   result,
-	   (n != result) ? " map" : ""));
+    TRACE_EVENT(evRecode, n, result, 0);
 
     return result;
 }
 
+#ifdef USE_ICONV
+/*
+ * Return the forward table used by FontencCharsetRecode(), with the offset it
+ * adds to each code, so that a run of text can be decoded without a call for
+ * each character.
+ */
+const MappingData *
+getCharsetTable(const CharsetRec * self, unsigned *shift, size_t *size)
+{
+    const MappingData *result = NULL;
+    const LuitConv *conv;
+
+    if (self->recode == FontencCharsetRecode) {
+	const FontencCharsetRec *fc = (const FontencCharsetRec *) (self->data);
+	if ((conv = luitLookupEncoding(fc->mapping)) != NULL) {
+	    *shift = fc->shift;
+	    *size = conv->table_size;
+	    result = conv->table_utf8;
+	}
+    }
+    return result;
+}
+#endif
+
 static int
 FontencCharsetReverse(unsigned int i, const CharsetRec * self)
 {
@@ -237,32 +385,113 @@ FontencCharsetReverse(unsigned int i, const CharsetRec * self)
 #undef IS_GL
     }
 
-    TRACE(("FontencCharsetReverse %#x ->%#x%s\n",
-	   i,
-	   result,
-	   ((int) i != result) ? " map" : ""));
+    TRACE_EVENT(evReverse, i, (unsigned) result, 0);
 
     return result;
 }
 
 static CharsetPtr cachedCharsets = NULL;
 
-static CharsetPtr
+static const CharsetRec *
 getCachedCharset(unsigned final, int type, const char *name)
 {
     CharsetPtr c;
+
+    if (name != NULL) {
+	NameKey key;
+	NameEntryPtr p;
+
+	if (makeNameKey(&key, name)
+	    && (p = findName(&cachedNames, &key, NULL)) != NULL
+	    && p->data != NULL) {
+	    return (const CharsetRec *) p->data;
+	}
+	return NULL;
+    }
     for (c = cachedCharsets; c; c = c->next) {
-	if (((c->type == type && c->final == final) ||
-	     (name && !lcStrCmp(c->name, name))) &&
-	    (c->type != T_FAILED))
+	if (c->type == type && c->final == final && c->type != T_FAILED)
 	    return c;
     }
     return NULL;
 }
 
+/*
+ * Record the result of a lookup by name.  A null charset marks a name which
+ * could not be resolved, so that it is not searched for again.
+ */
+static void
+cacheCharsetName(const char *name, const CharsetRec * c)
+{
+    NameKey key;
+    NameEntryPtr p;
+
+    if (makeNameKey(&key, name)) {
+	if ((p = findName(&cachedNames, &key, NULL)) != NULL)
+	    p->data = c;
+	else
+	    addName(&cachedNames, &key, c);
+    }
+}
+
+static int
+failedCharsetName(const char *name)
+{
+    NameKey key;
+    NameEntryPtr p;
+
+    return (makeNameKey(&key, name)
+	    && (p = findName(&cachedNames, &key, NULL)) != NULL
+	    && p->data == NULL);
+}
+
+/*
+ * Designations (ESC ( F, ESC $ ) F, etc.) are resolved once per (type, final)
+ * pair and remembered here, including the fallback to an unknown charset, so
+ * that applications which switch sets many times per screen do not repeat the
+ * list walk and fontenc search.
+ */
+#define DESIGNATE_MIN	0x30
+#define DESIGNATE_MAX	0x7f
+#define DESIGNATE_TYPES	4
+#define DESIGNATE_SIZE	(DESIGNATE_MAX + 1 - DESIGNATE_MIN)
+
+static const CharsetRec *designations[DESIGNATE_TYPES][DESIGNATE_SIZE];
+
+static const CharsetRec **
+designationSlot(unsigned final, int type)
+{
+    int n;
+
+    switch (type) {
+    case T_94:
+	n = 0;
+	break;
+    case T_96:
+	n = 1;
+	break;
+    case T_9494:
+	n = 2;
+	break;
+    case T_9696:
+	n = 3;
+	break;
+    default:
+	return NULL;
+    }
+    if (final < DESIGNATE_MIN || final > DESIGNATE_MAX)
+	return NULL;
+    return &designations[n][final - DESIGNATE_MIN];
+}
+
 static void
 cacheCharset(CharsetPtr c)
 {
+    const CharsetRec **slot;
+
+    /* a newer entry for the same designation hides the older one */
+    if ((slot = designationSlot(c->final, c->type)) != NULL)
+	*slot = NULL;
+    cacheCharsetName(c->name, c);
     c->next = cachedCharsets;
     cachedCharsets = c;
     VERBOSE(2, ("cachedCharset '%s'\n", c->name));
@@ -290,6 +519,28 @@ cpSize(FontencCharsetPtr fc)
 }
 #endif
 
+static FontencCharsetPtr
+findFontencCharset(const char *name)
+{
+    NameKey key;
+    NameEntryPtr p = NULL;
+
+    if (!fontencNames.ready) {
+	FontencCharsetPtr fc;
+	for (fc = fontencCharsets; fc->name; ++fc)
+	    addItems(&fontencNames, fc->name, fc);
+	fontencNames.ready = 1;
+    }
+    if (makeNameKey(&key, name)) {
+	while ((p = findName(&fontencNames, &key, p)) != NULL) {
+	    FontencCharsetPtr fc = (FontencCharsetPtr) p->item;
+	    if (fc->type != T_FAILED)
+		return fc;
+	}
+    }
+    return NULL;
+}
+
 static CharsetPtr
 getFontencCharset(unsigned final, int type, const char *name)
 {
@@ -300,16 +551,18 @@ getFontencCharset(unsigned final, int type, const char *name)
     CharsetPtr result = NULL;
 
     TRACE(("getFontencCharset(final %#x, type %d, name %s)\n", final, type, name));
-    fc = fontencCharsets;
-    while (fc->name) {
-	if (((fc->type == type && fc->final == final) ||
-	     (name && !lcStrCmp(fc->name, name))) &&
-	    (fc->type != T_FAILED))
-	    break;
-	fc++;
+    if (name != NULL) {
+	fc = findFontencCharset(name);
+    } else {
+	for (fc = fontencCharsets; fc->name; fc++) {
+	    if (fc->type == type && fc->final == final && fc->type != T_FAILED)
+		break;
+	}
+	if (!fc->name)
+	    fc = NULL;
     }
 
-    if (!fc->name) {
+    if (fc == NULL) {
 	VERBOSE(2, ("...no match for '%s' in FontEnc charsets\n", NonNull(name)));
     } else if ((c = TypeCalloc(CharsetRec)) == 0) {
 	VERBOSE(2, ("malloc failed\n"));
@@ -344,13 +597,21 @@ static const OtherCharsetRec *
 findOtherCharset(const char *name)
 {
     const OtherCharsetRec *fc;
-    fc = otherCharsets;
-    while (fc->name) {
-	if (name && !lcStrCmp(fc->name, name))
-	    break;
-	fc++;
+    NameKey key;
+    NameEntryPtr p;
+
+    if (!otherNames.ready) {
+	for (fc = otherCharsets; fc->name; ++fc)
+	    addNames(&otherNames, fc->name, fc);
+	otherNames.ready = 1;
+    }
+    if (name
+	&& makeNameKey(&key, name)
+	&& (p = findName(&otherNames, &key, NULL)) != NULL) {
+	return (const OtherCharsetRec *) p->data;
     }
-    return fc;
+    /* not found: return the terminating entry */
+    return otherCharsets + SizeOf(otherCharsets) - 1;
 }
 
 int
@@ -432,21 +693,62 @@ getUnknownCharset(int type)
     }
 }
 
+/*
+ * True if the charset maps its graphic characters 0x21 to 0x7E to the same
+ * codes, e.g., ASCII, so that text in it can be copied without recoding.
+ * The last few answers are kept, since applications such as ncurses switch
+ * GL between ASCII and the DEC line-drawing set many times per screen.
+ */
+typedef struct {
+    const CharsetRec *charset;
+    int identity;
+} IdentityRec;
+
+static IdentityRec identities[8];
+static unsigned identityNext;
+
+int
+isIdentityCharset(const CharsetRec * self)
+{
+    IdentityRec *p;
+    unsigned n;
+
+    for (n = 0; n < SizeOf(identities); ++n) {
+	if (identities[n].charset == self)
+	    return identities[n].identity;
+    }
+
+    p = &identities[identityNext++ % SizeOf(identities)];
+    p->charset = self;
+    p->identity = 1;
+    for (n = 0x21; n <= 0x7E; ++n) {
+	if (self->recode(n, self) != n) {
+	    p->identity = 0;
+	    break;
+	}
+    }
+    return p->identity;
+}
+
 const CharsetRec *
 getCharset(unsigned final, int type)
 {
+    const CharsetRec **slot = designationSlot(final, type);
     const CharsetRec *c;
 
     TRACE(("getCharset(final=%c, type=%d)\n", final, type));
-    c = getCachedCharset(final, type, NULL);
-    if (c)
-	return c;
+    if (slot != NULL && *slot != NULL)
+	return *slot;
 
-    c = getFontencCharset(final, type, NULL);
-    if (c)
-	return c;
-
-    return getUnknownCharset(type);
+    c = getCachedCharset(final, type, NULL);
+    if (c == NULL)
+	c = getFontencCharset(final, type, NULL);
+    if (c == NULL)
+	c = getUnknownCharset(type);
+
+    if (slot != NULL)
+	*slot = c;
+    return c;
 }
 
 const CharsetRec *
@@ -464,6 +766,9 @@ getCharsetByName(const char *name)
     if (c)
 	return c;
 
+    if (failedCharsetName(name))
+	return getUnknownCharset(T_94);
+
     c = getFontencCharset(0, 0, name);
     if (c)
 	return c;
@@ -472,6 +777,7 @@ getCharsetByName(const char *name)
     if (c)
 	return c;
 
+    cacheCharsetName(name, NULL);
     return getUnknownCharset(T_94);
 }
 /* *INDENT-OFF* */
@@ -642,24 +948,34 @@ canFakeLocaleCharset(FontEncPtr enc)
 }
 #endif
 
+/*
+ * Find the record for the given charset.  If "guess" is set, and the charset
+ * is not in the table, look for a similar record (which may require loading
+ * the charset's mapping).
+ */
 static const LocaleCharsetRec *
-findLocaleCharset(const char *charset)
+findLocaleCharset(const char *charset, int guess)
 {
     const LocaleCharsetRec *p;
     const LocaleCharsetRec *result = 0;
+    NameKey key;
+    NameEntryPtr entry;
 
-    for (p = localeCharsets; p->name; p++) {
-	if (lcStrCmp(p->name, charset) == 0) {
-	    result = p;
-	    break;
-	}
+    if (!localeNames.ready) {
+	for (p = localeCharsets; p->name; p++)
+	    addNames(&localeNames, p->name, p);
+	localeNames.ready = 1;
+    }
+    if (makeNameKey(&key, charset)
+	&& (entry = findName(&localeNames, &key, NULL)) != NULL) {
+	result = (const LocaleCharsetRec *) entry->data;
     }
 #ifdef USE_ICONV
     /*
      * The table is useful, but not complete.
      * If we can find a mapping for an 8-bit encoding, fake a table entry.
      */
-    if (result == 0) {
+    if (result == 0 && guess) {
 	FontEncPtr enc = luitGetFontEnc(charset,
 					(UM_MODE) ((int) umICONV
 						   | (int) umFONTENC
@@ -688,7 +1004,7 @@ findLocaleCharset(const char *charset)
 }
 
 static const LocaleCharsetRec *
-matchLocaleCharset(const char *charset)
+matchLocaleCharset(const char *charset, int guess)
 {
     static const struct {
 	const char *source;
@@ -717,11 +1033,12 @@ matchLocaleCharset(const char *charset)
 
 	sprintf(source, "%.*s", MAX_KEYWORD_LENGTH, charset);
 	if ((euro = strrchr(source, '@')) != 0 && !strcmp(euro, "@euro")) {
-	    Warning("the euro character may not be supported\n");
+	    if (guess)
+		Warning("the euro character may not be supported\n");
 	    *euro = 0;
 	}
 
-	p = findLocaleCharset(source);
+	p = findLocaleCharset(source, guess);
 
 	if (p == 0) {
 	    size_t have = strlen(source);
@@ -737,7 +1054,7 @@ matchLocaleCharset(const char *charset)
 		    strcpy(target, prefixes[n].target);
 		    strcpy(target + prefixes[n].target_len,
 			   source + prefixes[n].source_len);
-		    if ((p = findLocaleCharset(target)) != 0) {
+		    if ((p = findLocaleCharset(target, guess)) != 0) {
 			break;
 		    }
 		}
@@ -747,6 +1064,41 @@ matchLocaleCharset(const char *charset)
     return p;
 }
 
+/*
+ * Return the name of the record in localeCharsets which matches the charset,
+ * without guessing.  This is used for indexing locale.alias.
+ */
+const char *
+localeCharsetName(const char *charset)
+{
+    const LocaleCharsetRec *p = matchLocaleCharset(charset, 0);
+    return p ? p->name : 0;
+}
+
+/*
+ * Return the name of the n'th record in localeCharsets, or null past the end.
+ */
+const char *
+localeCharsetEntry(unsigned n)
+{
+    return (n < SizeOf(localeCharsets) - 1) ? localeCharsets[n].name : 0;
+}
+
+static const LocaleCharsetRec *
+findLocaleRecord(const char *name)
+{
+    const LocaleCharsetRec *p;
+    const LocaleCharsetRec *result = 0;
+
+    for (p = localeCharsets; p->name; p++) {
+	if (!strcmp(p->name, name)) {
+	    result = p;
+	    break;
+	}
+    }
+    return result;
+}
+
 int
 getLocaleState(const char *locale,
 	       const char *charset,
@@ -759,14 +1111,17 @@ getLocaleState(const char *locale,
 {
     int result = 0;
     char *resolved = 0;
-    const LocaleCharsetRec *p;
+    char *record = 0;
+    const LocaleCharsetRec *p = 0;
 
     TRACE(("getLocaleState(locale=%s, charset=%s)\n", locale, NonNull(charset)));
     if (!charset) {
 	if (ignore_locale) {
 	    charset = locale;
 	} else {
-	    resolved = resolveLocale(locale);
+	    profileBegin("resolveLocale", locale);
+	    resolved = resolveLocale(locale, &record);
+	    profileEnd(resolved ? "found" : "none");
 	    if (!resolved)
 		return -1;
 	    if ((charset = strrchr(resolved, '.')) != 0) {
@@ -777,7 +1132,16 @@ getLocaleState(const char *locale,
 	}
     }
 
-    if ((p = matchLocaleCharset(charset)) != 0) {
+    if (record != 0) {
+	p = findLocaleRecord(record);
+	free(record);
+    }
+    if (p == 0) {
+	profileBegin("matchLocaleCharset", charset);
+	p = matchLocaleCharset(charset, 1);
+	profileEnd(p ? "found" : "none");
+    }
+    if (p != 0) {
 	*gl_return = p->gl;
 	*gr_return = p->gr;
 	*g0_return = getCharsetByName(p->g0);
@@ -964,6 +1328,12 @@ destroyCharset(CharsetPtr p)
 void
 charset_leaks(void)
 {
+    memset(designations, 0, sizeof(designations));
+    memset(identities, 0, sizeof(identities));
+    freeNames(&fontencNames);
+    freeNames(&otherNames);
+    freeNames(&localeNames);
+    freeNames(&cachedNames);
     while (cachedCharsets != 0) {
 	CharsetPtr next = cachedCharsets->next;
 	destroyCharset(cachedCharsets);
@@ -82,12 +82,18 @@ typedef struct _LocaleCharset {
 int isOtherCharset(const char *);
 int lcStrCmp(const char *, const char *);
 const CharsetRec *getUnknownCharset(int);
+int isIdentityCharset(const CharsetRec *);
 const CharsetRec *getCharset(unsigned, int);
 const CharsetRec *getCharsetByName(const char *);
 const FontencCharsetRec *getFontencByName(const char *);
 const FontencCharsetRec *getCompositePart(const char *, unsigned);
 const char *getCompositeCharset(const char *);
 void reportCharsets(void);
+const char *localeCharsetName(const char *);
+const char *localeCharsetEntry(unsigned);
+#ifdef USE_ICONV
+const MappingData *getCharsetTable(const CharsetRec *, unsigned *, size_t *);
+#endif
 int getLocaleState(const char *locale, const char *charset,
 		   int *gl_return, int *gr_return,
 		   const CharsetRec * *g0_return,
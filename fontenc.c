@@ -30,6 +30,14 @@
 #include <zlib.h>
 #endif
 
+#if defined(HAVE_MMAP) && defined(HAVE_SYS_MMAN_H)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define USE_MMAP 1
+#endif
+
 #define flatUCode(row,col) (((row) << 8) + (col))
 
 typedef enum {
@@ -99,19 +107,26 @@ FontEncDirectory(void)
  * of the ".enc" file, and may be unrelated to the actual filename.
  */
 typedef struct {
-    char *alias;
-    char *path;
+    char *alias;		/* points into encodings_text */
+    char *value;		/* pathname as given, also in encodings_text */
+    char *path;			/* absolute pathname, computed on demand */
+    size_t line;		/* order in file, to keep the first duplicate */
     FontEncPtr data;
 } ENCODINGS_DIR;
 
 static ENCODINGS_DIR *encodings_dir;
+static ENCODINGS_DIR **encodings_index;	/* sorted ignoring case */
+static size_t encodings_count;
+static char *encodings_text;	/* contents of encodings.dir */
 
+#ifndef USE_FONTENC
+#ifdef USE_ZLIB
 /*
  * Read a buffer, trimming trailing whitespace (unlike getline, which in turn
  * is not portable enough in any case).
  */
 static char *
-getFileBuffer(char **bufferp, size_t *lengthp, FILE *fp)
+getGzipBuffer(char **bufferp, size_t *lengthp, gzFile fp)
 {
     size_t used = 0;
     char extra[BUFSIZ];
@@ -120,7 +135,7 @@ getFileBuffer(char **bufferp, size_t *lengthp, FILE *fp)
     if (*bufferp != 0)
 	**bufferp = '\0';
 
-    while (fgets(extra, (int) sizeof(extra) - 1, fp)) {
+    while (gzgets(fp, extra, (int) sizeof(extra) - 1)) {
 	size_t have = strlen(extra);
 	int found = 0;
 	finished = 0;
@@ -139,8 +154,6 @@ getFileBuffer(char **bufferp, size_t *lengthp, FILE *fp)
 	    size_t need = have + used + 2;
 	    if (*lengthp < need) {
 		*bufferp = realloc(*bufferp, need);
-		if (*bufferp == 0)
-		    return 0;
 		*lengthp = need;
 	    }
 	    strcpy(*bufferp + used, extra);
@@ -154,52 +167,95 @@ getFileBuffer(char **bufferp, size_t *lengthp, FILE *fp)
     return !finished ? *bufferp : 0;
 }
 
-#ifndef USE_FONTENC
-#ifdef USE_ZLIB
 /*
- * Read a buffer, trimming trailing whitespace (unlike getline, which in turn
- * is not portable enough in any case).
+ * Encoding files are read using zlib, which also handles uncompressed files.
+ * But if a file is uncompressed, we can map it, and read lines directly from
+ * memory.
  */
-static char *
-getGzipBuffer(char **bufferp, size_t *lengthp, gzFile fp)
-{
-    size_t used = 0;
-    char extra[BUFSIZ];
-    int finished = 1;
-
-    if (*bufferp != 0)
-	**bufferp = '\0';
+typedef struct {
+    gzFile gz;
+    char *data;			/* mapped contents of uncompressed file */
+    size_t size;
+    size_t next;
+} ENC_SOURCE;
 
-    while (gzgets(fp, extra, (int) sizeof(extra) - 1)) {
-	size_t have = strlen(extra);
-	int found = 0;
-	finished = 0;
-	while (have != 0) {
-	    --have;
-	    if (extra[have] == '\n') {
-		found = 1;
-	    }
-	    if (isspace(UChar(extra[have]))) {
-		extra[have] = '\0';
-	    } else {
-		break;
-	    }
-	}
-	if (have) {
-	    size_t need = have + used + 2;
-	    if (*lengthp < need) {
-		*bufferp = realloc(*bufferp, need);
-		*lengthp = need;
+static int
+openEncSource(ENC_SOURCE * source, const char *path)
+{
+    memset(source, 0, sizeof(*source));
+#ifdef USE_MMAP
+    {
+	int fd;
+	struct stat sb;
+	void *addr;
+
+	if ((fd = open(path, O_RDONLY)) >= 0) {
+	    if (fstat(fd, &sb) == 0
+		&& sb.st_size > 2
+		&& (addr = mmap(NULL, (size_t) sb.st_size, PROT_READ,
+				MAP_PRIVATE, fd, (off_t) 0)) != MAP_FAILED) {
+		const unsigned char *magic = (const unsigned char *) addr;
+		if (magic[0] == 0x1f && magic[1] == 0x8b) {
+		    munmap(addr, (size_t) sb.st_size);	/* gzip'd */
+		} else {
+		    TRACE(("mapped %s\n", path));
+		    source->data = (char *) addr;
+		    source->size = (size_t) sb.st_size;
+		}
 	    }
-	    strcpy(*bufferp + used, extra);
-	    used += have;
-	}
-	if (found) {
-	    break;
+	    close(fd);
 	}
     }
+    if (source->data == 0)
+#endif
+	source->gz = gzopen(path, "r");
+    return (source->data != 0 || source->gz != 0);
+}
 
-    return !finished ? *bufferp : 0;
+static void
+closeEncSource(ENC_SOURCE * source)
+{
+#ifdef USE_MMAP
+    if (source->data != 0)
+	munmap(source->data, source->size);
+    else
+#endif
+	gzclose(source->gz);
+}
+
+/*
+ * Read a line from an encoding file, trimming trailing whitespace.
+ */
+static char *
+getEncBuffer(char **bufferp, size_t *lengthp, ENC_SOURCE * source)
+{
+    char *result = 0;
+
+    if (source->data == 0) {
+	result = getGzipBuffer(bufferp, lengthp, source->gz);
+    } else if (source->next < source->size) {
+	const char *first = source->data + source->next;
+	const char *limit = source->data + source->size;
+	const char *last = memchr(first, '\n', (size_t) (limit - first));
+	size_t have;
+
+	source->next = (size_t) ((last ? (last + 1) : limit) - source->data);
+	if (last == 0)
+	    last = limit;
+	while (last != first && isspace(UChar(last[-1])))
+	    --last;
+	have = (size_t) (last - first);
+	if (*lengthp < have + 2) {
+	    *bufferp = realloc(*bufferp, have + 2);
+	    if (*bufferp == 0)
+		return 0;
+	    *lengthp = have + 2;
+	}
+	memcpy(*bufferp, first, have);
+	(*bufferp)[have] = '\0';
+	result = *bufferp;
+    }
+    return result;
 }
 #endif /* USE_ZLIB */
 #endif /* USE_FONTENC */
@@ -236,7 +292,25 @@ compare_aliases(const void *a, const void *b)
 {
     const ENCODINGS_DIR *p = a;
     const ENCODINGS_DIR *q = b;
-    return strcmp(p->alias, q->alias);
+    int result = strcmp(p->alias, q->alias);
+    if (result == 0)
+	result = (p->line > q->line) ? 1 : ((p->line < q->line) ? -1 : 0);
+    return result;
+}
+
+/*
+ * Order the index by the case-folded alias which lookupOneFontenc() matches,
+ * breaking ties as in the (case-sensitive) directory order.
+ */
+static int
+compare_folded(const void *a, const void *b)
+{
+    const ENCODINGS_DIR *const *p = a;
+    const ENCODINGS_DIR *const *q = b;
+    int result = StrCaseCmp((*p)->alias, (*q)->alias);
+    if (result == 0)
+	result = strcmp((*p)->alias, (*q)->alias);
+    return result;
 }
 
 static char *
@@ -253,27 +327,89 @@ skipToWhite(char *value)
     return result;
 }
 
+/*
+ * Read the whole of encodings.dir into memory.
+ */
+static char *
+readEncodingsDir(const char *path)
+{
+    char *result = 0;
+    FILE *fp;
+
+    if ((fp = fopen(path, "r")) == 0) {
+	FatalError("cannot open %s\n", path);
+    } else {
+	size_t used = 0;
+	size_t have = BUFSIZ;
+	size_t got;
+
+	result = malloc(have + 1);
+	while (result != 0
+	       && (got = fread(result + used, (size_t) 1, have - used, fp)) != 0) {
+	    used += got;
+	    if (used == have) {
+		have *= 2;
+		result = realloc(result, have + 1);
+	    }
+	}
+	if (result == 0)
+	    FatalError("cannot allocate buffer for %s\n", path);
+	result[used] = '\0';
+	fclose(fp);
+    }
+    return result;
+}
+
+/*
+ * Return the next line from the buffer, trimming trailing whitespace.
+ */
+static char *
+nextDirLine(char **textp)
+{
+    char *result = *textp;
+
+    if (*result == '\0') {
+	result = 0;
+    } else {
+	char *next = strchr(result, '\n');
+	char *last;
+
+	if (next != 0) {
+	    *next++ = '\0';
+	} else {
+	    next = result + strlen(result);
+	}
+	*textp = next;
+	last = result + strlen(result);
+	while (last != result && isspace(UChar(last[-1])))
+	    *--last = '\0';
+    }
+    return result;
+}
+
+/*
+ * Load the list of aliases from encodings.dir.  The aliases and pathnames
+ * point into a single buffer holding the file; the absolute pathname of an
+ * encoding is not computed until it is needed.
+ */
 static void
 loadEncodingsDir(void)
 {
     if (encodings_dir == 0) {
-	FILE *fp;
 	char *path = FontEncDirectory();
-	char *buffer = 0;
-	size_t entry = 0;
-	size_t length = 0;
+	char *buffer;
+	char *text;
 	size_t entries = 0;
 	char *value;
-	int used = 0;
-	int n, found;
+	size_t used = 0;
+	size_t n;
 	int row = 0;
 
 	if (path == 0) {
 	    TRACE(("cannot find encodings.dir\n"));
-	} else if ((fp = fopen(path, "r")) == 0) {
-	    FatalError("cannot open %s\n", path);
-	} else {
-	    while (getFileBuffer(&buffer, &length, fp) != 0) {
+	} else if ((encodings_text = readEncodingsDir(path)) != 0) {
+	    text = encodings_text;
+	    while ((buffer = nextDirLine(&text)) != 0) {
 		++row;
 		if (*buffer == '\0')
 		    continue;
@@ -290,37 +426,55 @@ loadEncodingsDir(void)
 		    }
 		} else if ((value = skipToWhite(buffer)) != 0) {
 		    *value++ = '\0';
-		    /* get rid of duplicates - they do occur */
-		    for (n = found = 0; n < used; ++n) {
-			if (!strcmp(buffer, encodings_dir[n].alias)) {
-			    found = 1;
-			    break;
-			}
-		    }
-		    if (!found) {
-			encodings_dir[used].alias = strmalloc(buffer);
-			encodings_dir[used].path = absolutePath(value, path);
-			++used;
-		    }
-
-		    if (++entry >= entries)
+		    encodings_dir[used].alias = buffer;
+		    encodings_dir[used].value = value;
+		    encodings_dir[used].line = used;
+		    if (++used >= entries)
 			break;
 		} else {
 		    FatalError("incorrect format of line %d:%s\n", row, buffer);
 		}
 	    }
-	    fclose(fp);
-	    free(buffer);
+
+	    /* sort, and get rid of duplicates - they do occur */
 	    if (used > 1) {
+		size_t k;
+
 		qsort(encodings_dir,
-		      (size_t) used,
+		      used,
 		      sizeof(encodings_dir[0]),
 		      compare_aliases);
+		for (n = k = 1; n < used; ++n) {
+		    if (strcmp(encodings_dir[k - 1].alias,
+			       encodings_dir[n].alias)) {
+			encodings_dir[k++] = encodings_dir[n];
+		    }
+		}
+		memset(encodings_dir + k, 0, (used - k) * sizeof(*encodings_dir));
+		used = k;
 	    }
+
+	    encodings_count = used;
+	    if ((encodings_index = TypeCallocN(ENCODINGS_DIR *, used + 1)) == 0)
+		FatalError("cannot allocate index for %s\n", path);
+	    for (n = 0; n < used; ++n)
+		encodings_index[n] = &encodings_dir[n];
+	    qsort(encodings_index,
+		  used,
+		  sizeof(encodings_index[0]),
+		  compare_folded);
 	}
     }
 }
 
+static const char *
+encodingPath(ENCODINGS_DIR * entry)
+{
+    if (entry->path == 0)
+	entry->path = absolutePath(entry->value, FontEncDirectory());
+    return entry->path;
+}
+
 #ifndef USE_FONTENC
 /*
  * The fontenc library attempts to fill in the one-one mapping in the setCode
@@ -641,7 +795,7 @@ loadFontEncRec(const char *charset, const char *path)
 #if defined(USE_FONTENC)
     result = FontEncReallyLoad(charset, path);
 #elif defined(USE_ZLIB)
-    gzFile fp;
+    ENC_SOURCE source;
     char *buffer = 0;
     size_t length = 0;
     size_t numAliases = 0;
@@ -655,11 +809,10 @@ loadFontEncRec(const char *charset, const char *path)
     if ((result = calloc((size_t) 1, sizeof(*result))) == 0)
 	return 0;
 
-    fp = gzopen(path, "r");
-    if (fp != 0) {
+    if (openEncSource(&source, path)) {
 	int count = 0;
 	int ignore = 0;
-	while (!done && getGzipBuffer(&buffer, &length, fp)) {
+	while (!done && getEncBuffer(&buffer, &length, &source)) {
 	    char *later;
 	    ++count;
 	    switch (getLineType(buffer, &later)) {
@@ -810,7 +963,7 @@ loadFontEncRec(const char *charset, const char *path)
 		break;
 	    }
 	}
-	gzclose(fp);
+	closeEncSource(&source);
 	free(buffer);
     }
 
@@ -824,13 +977,53 @@ loadFontEncRec(const char *charset, const char *path)
     return result;
 }
 
+/*
+ * Find the encodings.dir entry for an encoding, given its name.
+ */
+static ENCODINGS_DIR *
+findEncodingsEntry(const char *name)
+{
+    ENCODINGS_DIR *entry = 0;
+
+    loadEncodingsDir();
+    if (encodings_index != 0) {
+	size_t lo = 0;
+	size_t hi = encodings_count;
+
+	/* find the first of the aliases which match, ignoring case */
+	while (lo < hi) {
+	    size_t mid = (lo + hi) / 2;
+	    if (StrCaseCmp(encodings_index[mid]->alias, name) < 0) {
+		lo = mid + 1;
+	    } else {
+		hi = mid;
+	    }
+	}
+	if (lo < encodings_count
+	    && !StrCaseCmp(name, encodings_index[lo]->alias)) {
+	    entry = encodings_index[lo];
+	}
+    }
+    return entry;
+}
+
+/*
+ * Return the pathname of the ".enc" file for an encoding, without loading it.
+ */
+const char *
+fontencPath(const char *name)
+{
+    ENCODINGS_DIR *entry = findEncodingsEntry(name);
+
+    return (entry != 0) ? encodingPath(entry) : 0;
+}
+
 /*
  * Find an encoding, given its name.
  */
 FontEncPtr
 lookupOneFontenc(const char *name)
 {
-    int n;
     FontEncPtr result = 0;
 
 #ifdef USE_FONTENC
@@ -838,22 +1031,14 @@ lookupOneFontenc(const char *name)
     if (result == 0)
 #endif
     {
-	loadEncodingsDir();
-	if (encodings_dir != 0) {
-	    for (n = 0; encodings_dir[n].alias != 0; ++n) {
-		if (!StrCaseCmp(name, encodings_dir[n].alias)) {
-		    if ((result = encodings_dir[n].data) == 0) {
-			result = loadFontEncRec(encodings_dir[n].alias,
-						encodings_dir[n].path);
-			if (result == 0) {
-			    Warning("cannot load data for %s\n",
-				    encodings_dir[n].path);
-			}
-			encodings_dir[n].data = result;
-		    }
-		    break;
-		}
+	ENCODINGS_DIR *entry = findEncodingsEntry(name);
+
+	if (entry != 0 && (result = entry->data) == 0) {
+	    result = loadFontEncRec(entry->alias, encodingPath(entry));
+	    if (result == 0) {
+		Warning("cannot load data for %s\n", entry->path);
 	    }
+	    entry->data = result;
 	}
     }
     return result;
@@ -960,7 +1145,7 @@ reportFontencCharsets(void)
 	for (n = 0; encodings_dir[n].alias != 0; ++n) {
 	    printf("%s\n\t%s\n",
 		   encodings_dir[n].alias,
-		   encodings_dir[n].path);
+		   encodingPath(&encodings_dir[n]));
 	    encodings_dir[n].data = reportOneFontenc(encodings_dir[n].alias,
 						     encodings_dir[n].path);
 	    if (encodings_dir[n].data != 0) {
@@ -1137,10 +1322,11 @@ fontenc_leaks(void)
 	int enc;
 	for (enc = 0; encodings_dir[enc].alias != 0; ++enc) {
 	    freeFontEncRec(encodings_dir[enc].data);
-	    free(encodings_dir[enc].alias);
 	    free(encodings_dir[enc].path);
 	}
 	free(encodings_dir);
+	free(encodings_index);
+	free(encodings_text);
     }
 }
 #endif
@@ -0,0 +1,79 @@
+/*
+Copyright 2010-2012,2013 by Thomas E. Dickey
+Copyright (c) 2001 by Juliusz Chroboczek
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+/*
+ * Settings and messages shared by luit and luit-bench, so that the benchmark
+ * runs with the same defaults and lookup order as luit.
+ */
+
+#include <luit.h>
+
+#include <sys.h>
+#include <iso2022.h>
+
+const char *locale_alias = LOCALE_ALIAS_FILE;
+const char *table_cache = NULL;
+
+int ilog = -1;
+int olog = -1;
+int verbose = 0;
+int ignore_locale = 0;
+int fill_fontenc = 0;
+int warnings = 0;
+
+#ifdef USE_ICONV
+UM_MODE lookup_order[MAX_LOOKUP] =
+{
+    umFONTENC, umBUILTIN, umICONV, umPOSIX, umNONE
+};
+#endif
+
+void
+Message(const char *f,...)
+{
+    va_list args;
+    va_start(args, f);
+    vfprintf(stderr, f, args);
+    va_end(args);
+}
+
+void
+Warning(const char *f,...)
+{
+    va_list args;
+    va_start(args, f);
+    fputs("Warning: ", stderr);
+    vfprintf(stderr, f, args);
+    va_end(args);
+    ++warnings;
+}
+
+void
+FatalError(const char *f,...)
+{
+    va_list args;
+    va_start(args, f);
+    vfprintf(stderr, f, args);
+    va_end(args);
+    ExitFailure();
+}
@@ -28,7 +28,13 @@ THE SOFTWARE.
 #include <unistd.h>
 #include <errno.h>
 
+#ifdef HAVE_SYS_UIO_H
+#include <sys/uio.h>
+#endif
+
 #include <sys.h>
+#include <capture.h>
+#include <logfile.h>
 
 #define BUFFERED_INPUT_SIZE 4
 static unsigned char buffered_input[BUFFERED_INPUT_SIZE];
@@ -37,7 +43,14 @@ static int buffered_input_count = 0;
 static void terminateEsc(Iso2022Ptr, int, unsigned char *, unsigned);
 static void terminate(Iso2022Ptr, int);
 
-#define OUTBUF_FREE(is, count) ((is)->outbuf_count + (count) <= BUFFER_SIZE)
+/*
+ * copyOut() reserves enough space for the worst case before converting, so the
+ * flush here is only a safeguard.  Each input byte yields at most 3 bytes of
+ * UTF-8; the slack covers bytes withheld from a previous call, e.g., an ESC
+ * which might begin ST.
+ */
+#define OUTBUF_SLACK 16
+#define OUTBUF_FREE(is, count) ((is)->outbuf_count + (count) <= (is)->outbuf_size)
 #define OUTBUF_MAKE_FREE(is, fd, count) \
     if(!OUTBUF_FREE((is), (count))) outbuf_flush((is), (fd))
 
@@ -86,31 +99,150 @@ trace_iso2022(const char *tag, const Iso2022Ptr ptr)
 #define trace_iso2022(tag, ptr)	/* nothing */
 #endif
 
+/*
+ * Output is a list of spans:  converted text in outbuf, and long runs of bytes
+ * which pass through unchanged, e.g., sixel data or an escape sequence which
+ * spanned reads.  Those are written from where they are rather than copied
+ * into outbuf.  Short runs are cheaper to copy.
+ */
+#define OUTSPAN_MIN 64
+
+static void
+outspan_close(Iso2022Ptr is)
+{
+    if (is->outbuf_count > is->outbuf_mark) {
+	OutSpan *span = &(is->outspan[is->outspan_count++]);
+	span->data = is->outbuf + is->outbuf_mark;
+	span->size = is->outbuf_count - is->outbuf_mark;
+	is->outbuf_mark = is->outbuf_count;
+    }
+}
+
 static void
 outbuf_flush(Iso2022Ptr is, int fd)
 {
+    OutSpan *span = is->outspan;
+    unsigned n = 0;
     int rc;
-    unsigned i = 0;
+    unsigned long bytes_out = is->stats.bytes_out;
+    unsigned long stall_usecs = is->stats.stall_usecs;
+
+    outspan_close(is);
+    if (is->outspan_count != 0)
+	is->stats.flushes++;
+
+    if (olog >= 0) {
+	for (n = 0; n < is->outspan_count; ++n)
+	    writeLog(olog, span[n].data, span[n].size);
+	n = 0;
+    }
+
+    if (recording && is->outspan_count != 0) {
+	size_t total = 0;
 
-    if (olog >= 0)
-	IGNORE_RC(write(olog, is->outbuf, is->outbuf_count));
+	for (n = 0; n < is->outspan_count; ++n)
+	    total += span[n].size;
+	flightStart(CAP_TO_TERMINAL, total);
+	for (n = 0; n < is->outspan_count; ++n)
+	    flightData(span[n].data, span[n].size);
+	n = 0;
+    }
+
+    if (capturing && is->outspan_count != 0) {
+	size_t total = 0;
+
+	for (n = 0; n < is->outspan_count; ++n)
+	    total += span[n].size;
+	captureStart(CAP_TO_TERMINAL, total);
+	for (n = 0; n < is->outspan_count; ++n)
+	    captureData(span[n].data, span[n].size);
+	n = 0;
+    }
 
-    while (i < is->outbuf_count) {
-	rc = (int) write(fd, is->outbuf + i, is->outbuf_count - i);
+    while (n < is->outspan_count) {
+#ifdef HAVE_WRITEV
+	if (is->outspan_count - n > 1) {
+	    struct iovec vec[OUTSPAN_MAX];
+	    unsigned k;
+
+	    for (k = n; k < is->outspan_count; ++k) {
+		vec[k - n].iov_base = span[k].data;
+		vec[k - n].iov_len = span[k].size;
+	    }
+	    rc = (int) writev(fd, vec, (int) (is->outspan_count - n));
+	} else
+#endif
+	    rc = (int) write(fd, span[n].data, span[n].size);
+	is->stats.writes++;
 	if (rc > 0) {
-	    i += (unsigned) rc;
+	    size_t done = (size_t) rc;
+
+	    is->stats.bytes_out += done;
+
+	    while (n < is->outspan_count && done >= span[n].size) {
+		done -= span[n].size;
+		++n;
+	    }
+	    if (done != 0) {
+		span[n].data += done;
+		span[n].size -= done;
+	    }
 	} else {
 	    if (rc < 0 && errno == EINTR)
 		continue;
 	    else if ((rc == 0) || ((rc < 0) && (errno == EAGAIN))) {
-		if (waitForOutput(fd) == IO_Closed)
+		unsigned long started = monotonicUsecs();
+
+		is->stats.stalls++;
+		rc = waitForOutput(fd);
+		is->stats.stall_usecs += monotonicUsecs() - started;
+		if (rc == IO_Closed)
 		    break;
 		continue;
 	    } else
 		break;
 	}
     }
+    is->outspan_count = 0;
     is->outbuf_count = 0;
+    is->outbuf_mark = 0;
+    if (is->retired != NULL) {
+	free(is->retired);
+	is->retired = NULL;
+    }
+    PROBE3(flush, fd,
+	   is->stats.bytes_out - bytes_out,
+	   is->stats.stall_usecs - stall_usecs);
+}
+
+/*
+ * Add a span of output, leaving room for the converted text which follows.
+ */
+static void
+outbuf_span(Iso2022Ptr is, int fd, unsigned char *data, size_t size)
+{
+    OutSpan *span;
+
+    if (is->outspan_count + 3 > OUTSPAN_MAX)
+	outbuf_flush(is, fd);
+    outspan_close(is);
+    span = &(is->outspan[is->outspan_count++]);
+    span->data = data;
+    span->size = size;
+}
+
+static void
+outbuf_reserve(Iso2022Ptr is, size_t count)
+{
+    size_t need = is->outbuf_count + count;
+
+    if (need > is->outbuf_size) {
+	need = ((need + BUFFER_SIZE - 1) / BUFFER_SIZE) * BUFFER_SIZE;
+	is->outbuf = realloc(is->outbuf, need);
+	if (is->outbuf == NULL)
+	    FatalError("Couldn't grow outbuf.\n");
+	is->outbuf_size = need;
+    }
 }
 
 static void
@@ -142,6 +274,27 @@ outbufUTF8(Iso2022Ptr is, int fd, unsigned c)
     }
 }
 
+static void
+outbufBlock(Iso2022Ptr is, int fd, unsigned char *s, size_t count)
+{
+    if (count >= OUTSPAN_MIN) {
+	outbuf_span(is, fd, s, count);
+	return;
+    }
+    while (count != 0) {
+	size_t part;
+
+	OUTBUF_MAKE_FREE(is, fd, 1);
+	part = is->outbuf_size - is->outbuf_count;
+	if (part > count)
+	    part = count;
+	memcpy(is->outbuf + is->outbuf_count, s, part);
+	is->outbuf_count += part;
+	s += part;
+	count -= part;
+    }
+}
+
 static void
 buffer(Iso2022Ptr is, unsigned c)
 {
@@ -163,28 +316,20 @@ buffer(Iso2022Ptr is, unsigned c)
     is->buffered[is->buffered_count++] = UChar(c);
 }
 
-static void
-outbuf_buffered_carefully(Iso2022Ptr is, int fd)
-{
-    /* This should never happen in practice */
-    unsigned i = 0;
-
-    while (i < is->buffered_count) {
-	OUTBUF_MAKE_FREE(is, fd, 1);
-	is->outbuf[is->outbuf_count++] = is->buffered[i++];
-    }
-    is->buffered_count = 0;
-}
-
 static void
 outbuf_buffered(Iso2022Ptr is, int fd)
 {
-    if (is->buffered_count > BUFFER_SIZE)
-	outbuf_buffered_carefully(is, fd);
-
-    OUTBUF_MAKE_FREE(is, fd, is->buffered_count);
-    memcpy(is->outbuf + is->outbuf_count, is->buffered, is->buffered_count);
-    is->outbuf_count += is->buffered_count;
+    if (is->buffered_count >= OUTSPAN_MIN) {
+	/* write from buffered[], and use a new one for later sequences */
+	if (is->retired != NULL)
+	    outbuf_flush(is, fd);
+	outbuf_span(is, fd, is->buffered, is->buffered_count);
+	is->retired = is->buffered;
+	is->buffered = NULL;
+	is->buffered_len = 0;
+    } else {
+	outbufBlock(is, fd, is->buffered, is->buffered_count);
+    }
     is->buffered_count = 0;
 }
 
@@ -209,6 +354,7 @@ allocIso2022(void)
 
     is->inputFlags = IF_EIGHTBIT | IF_SS | IF_SSGR;
     is->outputFlags = OF_SS | OF_LS | OF_SELECT;
+    is->engine = E_UNKNOWN;
 
     is->buffered = NULL;
     is->buffered_len = 0;
@@ -221,22 +367,23 @@ allocIso2022(void)
 	free(is);
 	return NULL;
     }
+    is->outbuf_size = BUFFER_SIZE;
     is->outbuf_count = 0;
 
     return is;
 }
 
-#ifdef NO_LEAKS
 void
 destroyIso2022(Iso2022Ptr is)
 {
     if (is->buffered)
 	free(is->buffered);
+    if (is->retired)
+	free(is->retired);
     if (is->outbuf)
 	free(is->outbuf);
     free(is);
 }
-#endif
 
 static int
 identifyCharset(Iso2022Ptr i, const CharsetRec * *p)
@@ -273,6 +420,113 @@ reportIso2022(const char *tag, Iso2022Ptr i)
     Message("GR is G%d.\n", identifyCharset(i, i->grp));
 }
 
+static unsigned
+latencyBucket(unsigned long usecs)
+{
+    unsigned shift = 0;
+
+    while ((usecs >> shift) >= 2 * LATENCY_SUB)
+	++shift;
+    if (shift + 1 >= LATENCY_BUCKETS / LATENCY_SUB)
+	return LATENCY_BUCKETS - 1;
+    return (shift * LATENCY_SUB) + (unsigned) (usecs >> shift);
+}
+
+/*
+ * The largest value which falls in a bucket.
+ */
+static unsigned long
+latencyLimit(unsigned n)
+{
+    unsigned shift;
+
+    if (n < 2 * LATENCY_SUB)
+	return n;
+    shift = (n / LATENCY_SUB) - 1;
+    return ((unsigned long) ((n % LATENCY_SUB) + LATENCY_SUB + 1) << shift) - 1;
+}
+
+/*
+ * Record the time from the caller's read to the end of its writes.
+ */
+static void
+addLatency(Iso2022Ptr is)
+{
+    if (is->read_usecs != 0) {
+	Latency *lp = &(is->stats.latency);
+	unsigned long usecs = monotonicUsecs() - is->read_usecs;
+
+	lp->count++;
+	lp->bucket[latencyBucket(usecs)]++;
+	if (usecs > lp->max)
+	    lp->max = usecs;
+	is->read_usecs = 0;
+    }
+}
+
+/*
+ * Returns the latency below which the given fraction (in thousandths) of the
+ * samples fall, as the limit of its bucket.
+ */
+static unsigned long
+latencyPercentile(Latency * lp, unsigned long permille)
+{
+    unsigned long want = (lp->count * permille + 999) / 1000;
+    unsigned long seen = 0;
+    unsigned n;
+
+    for (n = 0; n < LATENCY_BUCKETS; ++n) {
+	seen += lp->bucket[n];
+	if (seen >= want && seen != 0) {
+	    unsigned long limit = latencyLimit(n);
+	    return (limit < lp->max) ? limit : lp->max;
+	}
+    }
+    return lp->max;
+}
+
+/*
+ * Write the counters as "tag.name value" lines.  The latency histogram is
+ * summarized by percentiles, followed by its non-empty buckets, named by the
+ * largest latency each holds.
+ */
+void
+statsIso2022(FILE *fp, const char *tag, Iso2022Ptr i)
+{
+    Latency *lp = &(i->stats.latency);
+    unsigned n;
+
+#define DATA(name) fprintf(fp, "%s.%s %lu\n", tag, #name, i->stats.name)
+    DATA(bytes_in);
+    DATA(bytes_out);
+    DATA(reads);
+    DATA(writes);
+    DATA(flushes);
+    DATA(stalls);
+    DATA(stall_usecs);
+    DATA(escapes);
+    DATA(designations);
+    DATA(single_shifts);
+    DATA(unmapped);
+    DATA(invalid);
+#undef DATA
+#define DATA(name, permille) \
+    fprintf(fp, "%s.latency_%s_usecs %lu\n", tag, name, \
+	    latencyPercentile(lp, permille))
+    fprintf(fp, "%s.latency_count %lu\n", tag, lp->count);
+    DATA("p50", 500);
+    DATA("p90", 900);
+    DATA("p99", 990);
+    DATA("p999", 999);
+    fprintf(fp, "%s.latency_max_usecs %lu\n", tag, lp->max);
+#undef DATA
+    for (n = 0; n < LATENCY_BUCKETS; ++n) {
+	if (lp->bucket[n] != 0)
+	    fprintf(fp, "%s.latency_bucket_%lu %lu\n",
+		    tag, latencyLimit(n), lp->bucket[n]);
+    }
+}
+
 int
 initIso2022(const char *locale, const char *charset, Iso2022Ptr i)
 {
@@ -285,7 +539,9 @@ initIso2022(const char *locale, const char *charset, Iso2022Ptr i)
     int rc;
 
     TRACE(("initIso2022(locale=%s, charset=%s)\n", locale, NonNull(charset)));
+    profileBegin("getLocaleState", locale);
     rc = getLocaleState(locale, charset, &gl, &gr, &g0, &g1, &g2, &g3, &other);
+    profileEnd((rc < 0) ? "failed" : NULL);
     if (rc < 0) {
 	if (charset) {
 	    Warning("couldn't find charset %s; "
@@ -341,6 +597,7 @@ initIso2022(const char *locale, const char *charset, Iso2022Ptr i)
     if (i->grp == NULL) {
 	i->grp = &i->g[gr];
     }
+    i->engine = E_UNKNOWN;
     trace_iso2022("...initIso2022", i);
     return 0;
 }
@@ -362,6 +619,7 @@ mergeIso2022(Iso2022Ptr d, Iso2022Ptr s)
 	d->glp = &(d->g[identifyCharset(s, s->glp)]);
     if (d->grp == NULL)
 	d->grp = &(d->g[identifyCharset(s, s->grp)]);
+    d->engine = E_UNKNOWN;
     trace_iso2022("...mergeIso2022", d);
     return 0;
 }
@@ -406,14 +664,31 @@ fromUtf8(unsigned char *b)
 	return -1;
 }
 
+static void
+writeIn(Iso2022Ptr is, int fd, unsigned char *data, size_t size)
+{
+    int rc = (int) write(fd, data, size);
+
+    if (capturing)
+	captureChunk(CAP_TO_PROGRAM, data, size);
+    is->stats.writes++;
+    if (rc > 0)
+	is->stats.bytes_out += (unsigned long) rc;
+    else if (rc < 0 && errno == EAGAIN)
+	is->stats.stalls++;
+}
+
 void
 copyIn(Iso2022Ptr is, int fd, unsigned char *buf, int count)
 {
     unsigned char *c;
     int codepoint, rem;
+    unsigned long bytes_out = is->stats.bytes_out;
 
+    PROBE2(copyin_entry, fd, count);
     c = buf;
     rem = count;
+    is->stats.bytes_in += (unsigned long) count;
 
 #define NEXT do {c++; rem--;} while(0)
 
@@ -435,6 +710,7 @@ copyIn(Iso2022Ptr is, int fd, unsigned char *buf, int count)
 		is->parserState = P_NORMAL;
 	} else if (!(*c & 0x80)) {
 	    if (buffered_input_count > 0) {
+		is->stats.invalid += (unsigned long) buffered_input_count;
 		buffered_input_count = 0;
 		continue;
 	    } else {
@@ -445,6 +721,7 @@ copyIn(Iso2022Ptr is, int fd, unsigned char *buf, int count)
 	    }
 	} else if ((*c & 0x40)) {
 	    if (buffered_input_count > 0) {
+		is->stats.invalid += (unsigned long) buffered_input_count;
 		buffered_input_count = 0;
 		continue;
 	    } else {
@@ -454,6 +731,7 @@ copyIn(Iso2022Ptr is, int fd, unsigned char *buf, int count)
 	    }
 	} else {
 	    if (buffered_input_count <= 0) {
+		is->stats.invalid++;
 		buffered_input_count = 0;
 		NEXT;
 		continue;
@@ -463,6 +741,8 @@ copyIn(Iso2022Ptr is, int fd, unsigned char *buf, int count)
 		NEXT;
 		if (buffered_input_count >= utf8Count(buffered_input[0])) {
 		    codepoint = fromUtf8(buffered_input);
+		    if (codepoint < 0)
+			is->stats.invalid += (unsigned long) buffered_input_count;
 		    buffered_input_count = 0;
 		    if (codepoint == CSI)
 			is->parserState = P_CSI;
@@ -478,19 +758,19 @@ copyIn(Iso2022Ptr is, int fd, unsigned char *buf, int count)
 
 #define WRITE_1(i) do { \
 	    obuf[0] = UChar(i); \
-	    IGNORE_RC(write(fd, obuf, (size_t) 1)); \
+	    writeIn(is, fd, obuf, (size_t) 1); \
 	} while(0)
 #define WRITE_2(i) do { \
 	    obuf[0] = UChar(((i) >> 8) & 0xFF); \
 	    obuf[1] = UChar((i) & 0xFF); \
-	    IGNORE_RC(write(fd, obuf, (size_t) 2)); \
+	    writeIn(is, fd, obuf, (size_t) 2); \
 	} while(0)
 
 #define WRITE_3(i) do { \
 	    obuf[0] = UChar(((i) >> 16) & 0xFF); \
 	    obuf[1] = UChar(((i) >>  8) & 0xFF); \
 	    obuf[2] = UChar((i) & 0xFF); \
-	    IGNORE_RC(write(fd, obuf, (size_t) 3)); \
+	    writeIn(is, fd, obuf, (size_t) 3); \
 	} while(0)
 
 #define WRITE_4(i) do { \
@@ -498,20 +778,20 @@ copyIn(Iso2022Ptr is, int fd, unsigned char *buf, int count)
 	    obuf[1] = UChar(((i) >> 16) & 0xFF); \
 	    obuf[2] = UChar(((i) >>  8) & 0xFF); \
 	    obuf[3] = UChar((i) & 0xFF); \
-	    IGNORE_RC(write(fd, obuf, (size_t) 4)); \
+	    writeIn(is, fd, obuf, (size_t) 4); \
        } while(0)
 
 #define WRITE_1_P_8bit(p, i) { \
 	    obuf[0] = UChar(p); \
 	    obuf[1] = UChar(i); \
-	    IGNORE_RC(write(fd, obuf, (size_t) 2)); \
+	    writeIn(is, fd, obuf, (size_t) 2); \
 	}
 
 #define WRITE_1_P_7bit(p, i) { \
 	    obuf[0] = ESC; \
 	    obuf[1] = UChar((p) - 0x40); \
 	    obuf[2] = UChar(i); \
-	    IGNORE_RC(write(fd, obuf, (size_t) 3)); \
+	    writeIn(is, fd, obuf, (size_t) 3); \
 	}
 
 #define WRITE_1_P(p,i) do { \
@@ -524,7 +804,7 @@ copyIn(Iso2022Ptr is, int fd, unsigned char *buf, int count)
 	    obuf[0] = UChar(p); \
 	    obuf[1] = UChar(((i) >> 8) & 0xFF); \
 	    obuf[2] = UChar((i) & 0xFF); \
-	    IGNORE_RC(write(fd, obuf, (size_t) 3)); \
+	    writeIn(is, fd, obuf, (size_t) 3); \
 	}
 
 #define WRITE_2_P_7bit(p, i) { \
@@ -532,7 +812,7 @@ copyIn(Iso2022Ptr is, int fd, unsigned char *buf, int count)
 	    obuf[1] = UChar((p) - 0x40); \
 	    obuf[2] = UChar(((i) >> 8) & 0xFF); \
 	    obuf[3] = UChar((i) & 0xFF); \
-	    IGNORE_RC(write(fd, obuf, (size_t) 4)); \
+	    writeIn(is, fd, obuf, (size_t) 4); \
 	}
 
 #define WRITE_2_P(p,i) do { \
@@ -546,7 +826,7 @@ copyIn(Iso2022Ptr is, int fd, unsigned char *buf, int count)
 	    obuf[0] = UChar(p); \
 	    obuf[1] = UChar((i) & 0xFF); \
 	    obuf[2] = UChar(s); \
-	    IGNORE_RC(write(fd, obuf, (size_t) 3)); \
+	    writeIn(is, fd, obuf, (size_t) 3); \
 	} while(0)
 
 #define WRITE_2_P_S(p,i,s) do { \
@@ -554,7 +834,7 @@ copyIn(Iso2022Ptr is, int fd, unsigned char *buf, int count)
 	    obuf[1] = UChar(((i) >> 8) & 0xFF); \
 	    obuf[2] = UChar((i) & 0xFF); \
 	    obuf[3] = UChar(s); \
-	    IGNORE_RC(write(fd, obuf, (size_t) 4)); \
+	    writeIn(is, fd, obuf, (size_t) 4); \
 	} while(0)
 
 	    if (ucode < 0x20 ||
@@ -575,6 +855,8 @@ copyIn(Iso2022Ptr is, int fd, unsigned char *buf, int count)
 		    WRITE_2(c2);
 		else if (c2)
 		    WRITE_1(c2);
+		else
+		    is->stats.unmapped++;
 		continue;
 	    }
 	    i = (GL(is)->reverse) (ucode, GL(is));
@@ -662,6 +944,8 @@ copyIn(Iso2022Ptr is, int fd, unsigned char *buf, int count)
 	    }
 	    if (is->inputFlags & IF_SS) {
 		i = G3(is)->reverse(ucode, G3(is));
+		if (i < 0)
+		    is->stats.unmapped++;
 		switch (GR(is)->type) {
 		case T_94:
 		case T_96:
@@ -719,6 +1003,7 @@ copyIn(Iso2022Ptr is, int fd, unsigned char *buf, int count)
 		    continue;
 		}
 	    }
+	    is->stats.unmapped++;
 #undef WRITE_1
 #undef WRITE_2
 #undef WRITE_1_P
@@ -729,24 +1014,472 @@ copyIn(Iso2022Ptr is, int fd, unsigned char *buf, int count)
 #undef WRITE_2_P_8bit
 	}
     }
+    addLatency(is);
+    PROBE3(copyin_return, fd, count, is->stats.bytes_out - bytes_out);
 }
 
 #define PAIR(a,b) ((unsigned) ((a) << 8) | (b))
 
+/*
+ * The 8-bit string introducers and ST are recognized only when GR holds a
+ * single-byte set:  in a 94x94 or 94x192 set they may be the first byte of a
+ * character.
+ */
+#define C1_STRINGS(is) (OTHER(is) == NULL \
+			&& (GR(is)->type == T_94 || GR(is)->type == T_96))
+
+/*
+ * The payload of a DCS is not text in the current charsets, e.g., sixel data.
+ * Copy it through unchanged up to its terminator:  BEL, ST or ESC \.  CAN and
+ * SUB cancel the string.
+ *
+ * The other string controls (OSC, APC, PM and SOS) hold character strings in
+ * the locale's encoding, e.g., a window title.  Copy them the same way while
+ * they are ASCII, but convert the rest as usual from the first non-ASCII byte.
+ */
+static unsigned char *
+copyString(Iso2022Ptr is, int fd, unsigned char *s, unsigned char *end)
+{
+    int eightbit = C1_STRINGS(is);
+    int text = (is->parserState == P_TEXT);
+    unsigned char *p = s;
+
+    while (p < end) {
+	if (*p >= 0x20) {
+	    if (*p == ST && eightbit)
+		break;
+	    if (*p >= 0x80 && text) {
+		outbufBlock(is, fd, s, (size_t) (p - s));
+		is->parserState = P_NORMAL;
+		return p;
+	    }
+	} else if (*p == BEL || *p == ESC || *p == CAN || *p == SUB) {
+	    break;
+	}
+	++p;
+    }
+    outbufBlock(is, fd, s, (size_t) (p - s));
+
+    if (p < end) {
+	if (*p == ESC) {
+	    is->parserState = P_STRING_ESC;
+	} else {
+	    if (*p == ST)
+		outbufUTF8(is, fd, *p);
+	    else
+		outbufOne(is, fd, *p);
+	    is->parserState = P_NORMAL;
+	}
+	++p;
+    }
+    return p;
+}
+
+/*
+ * terminate() copies a control sequence unchanged, so one which is complete
+ * within the input need not be buffered.  Return the end of the sequence whose
+ * parameters begin at "s", or null if it continues past the end of the input.
+ */
+static unsigned char *
+scanCSI(unsigned char *s, unsigned char *end)
+{
+    while (s < end) {
+	if (IS_FINAL_CSI(*s))
+	    return s + 1;
+	++s;
+    }
+    return NULL;
+}
+
+#define IS_GL94(c) ((c) >= 0x21 && (c) <= 0x7E)
+#define IS_GR94(c) ((c) >= 0xA1 && (c) <= 0xFE)
+
+/*
+ * The forward mapping of a 94x94 set, for decoding runs of pairs.
+ */
+typedef struct {
+    const CharsetRec *charset;
+#ifdef USE_ICONV
+    const MappingData *table;
+    unsigned shift;
+    size_t size;
+#endif
+} RunTable;
+
+static void
+initRunTable(RunTable * rt, const CharsetRec * charset)
+{
+    rt->charset = charset;
+#ifdef USE_ICONV
+    rt->shift = 0;
+    rt->size = 0;
+    rt->table = getCharsetTable(charset, &rt->shift, &rt->size);
+#endif
+}
+
+/*
+ * Write the UTF-8 for a code as outbufUTF8() would, into space reserved in
+ * outbuf.  Returns the end of the text written.
+ */
+static unsigned char *
+putUTF8(unsigned c, unsigned char *out)
+{
+    if (c == 0) {
+	;
+    } else if (c <= 0x7F) {
+	*out++ = UChar(c);
+    } else if (c <= 0x7FF) {
+	*out++ = UChar(0xC0 | ((c >> 6) & 0x1F));
+	*out++ = UChar(0x80 | (c & 0x3F));
+    } else {
+	*out++ = UChar(0xE0 | ((c >> 12) & 0x0F));
+	*out++ = UChar(0x80 | ((c >> 6) & 0x3F));
+	*out++ = UChar(0x80 | (c & 0x3F));
+    }
+    return out;
+}
+
+/*
+ * Write the UTF-8 for a pair, using the table's text except where recode
+ * would differ.
+ */
+static unsigned char *
+putPair(const RunTable * rt, unsigned code, unsigned char *out)
+{
+#ifdef USE_ICONV
+    unsigned c;
+
+    if (rt->table != NULL
+	&& (code + rt->shift) < rt->size
+	&& (c = rt->table[code + rt->shift].ucs) != 0
+	&& c <= 0xFFFF) {
+	const MappingData *m = rt->table + code + rt->shift;
+	memcpy(out, m->text, (size_t) m->size);
+	return out + m->size;
+    }
+#endif
+    return putUTF8(rt->charset->recode(code, rt->charset), out);
+}
+
+/*
+ * ASCII text is copied a word at a time.  A word can be copied if none of its
+ * bytes has the high bit set, or is ESC, SO or SI.
+ */
+#define WORD_SIZE	sizeof(unsigned long)
+#define WORD_ONES	((unsigned long) -1 / 0xFF)
+#define WORD_HIGHS	(WORD_ONES * 0x80)
+#define WORD_HASZERO(w)	(((w) - WORD_ONES) & ~(w) & WORD_HIGHS)
+#define WORD_IS_TEXT(w)	(!((w) & WORD_HIGHS) \
+			 && !WORD_HASZERO((w) ^ (WORD_ONES * ESC)) \
+			 && !WORD_HASZERO(((w) & (WORD_ONES * 0xFE)) ^ (WORD_ONES * LS1)))
+#define IS_GL_TEXT(c)	((c) < 0x80 && (c) != ESC && (c) != LS0 && (c) != LS1)
+
+/*
+ * Copy ASCII text until reaching a byte which needs interpretation, or until
+ * the output passes "limit".  Returns the end of the text copied.
+ */
+static unsigned char *
+copyAscii(unsigned char *s, unsigned char *end,
+	  unsigned char **outp, unsigned char *limit)
+{
+    unsigned char *out = *outp;
+
+    while (out <= limit && s < end && IS_GL_TEXT(*s)) {
+	unsigned long w;
+
+	if ((size_t) (end - s) >= WORD_SIZE) {
+	    memcpy(&w, s, WORD_SIZE);
+	    if (WORD_IS_TEXT(w)) {
+		memcpy(out, s, WORD_SIZE);
+		out += WORD_SIZE;
+		s += WORD_SIZE;
+		continue;
+	    }
+	}
+	*out++ = *s++;
+    }
+    *outp = out;
+    return s;
+}
+
+/*
+ * The UTF-8 for each byte 0x80 to 0xFF of a 96- or 128-character set in GR,
+ * as the per-byte code in copyOut() would write it.  Bytes which are controls
+ * for a regular GR (CSI, SS2, SS3 and string introducers) are marked to stop
+ * a run.  ISO 8859-1 is recognized, and encoded directly.
+ */
+#define BYTE_STOP 0xFF
+
+typedef struct {
+    const CharsetRec *charset;
+    int latin1;
+    unsigned char size[128];
+    unsigned char text[128][3];
+} ByteTable;
+
+static ByteTable byteTables[4];
+static unsigned byteTableNext;
+
+static const ByteTable *
+getByteTable(const CharsetRec * charset)
+{
+    ByteTable *bt;
+    unsigned n;
+
+    for (n = 0; n < SizeOf(byteTables); ++n) {
+	if (byteTables[n].charset == charset)
+	    return &byteTables[n];
+    }
+
+    bt = &byteTables[byteTableNext++ % SizeOf(byteTables)];
+    bt->charset = charset;
+    bt->latin1 = 1;
+    for (n = 0; n < 128; ++n) {
+	unsigned ch = n + 0x80;
+	unsigned c;
+
+	if (CHARSET_REGULAR(charset)
+	    && (ch == CSI || ch == SS2 || ch == SS3 || IS_STRING_8(ch))) {
+	    bt->size[n] = BYTE_STOP;
+	    continue;
+	}
+	if (charset->type == T_96 && n < 0x20)
+	    c = ch;
+	else
+	    c = charset->recode(n, charset);
+	if (c != ch)
+	    bt->latin1 = 0;
+	bt->size[n] = UChar(putUTF8(c, bt->text[n]) - bt->text[n]);
+    }
+    return bt;
+}
+
+/*
+ * Returns the length of a complete UTF-8 sequence which stack_utf8() would
+ * decode and outbufUTF8() write back unchanged, or zero.  Four-byte sequences
+ * are not written back unchanged, since outbufUTF8() stops at U+FFFF.
+ */
+static int
+utf8Plain(unsigned char *s, unsigned char *end)
+{
+    if (s[0] < 0x80) {
+	return (s[0] != 0 && s[0] != ESC);
+    } else if (s[0] >= 0xC2 && s[0] <= 0xDF) {
+	if ((s + 1) < end
+	    && (s[1] & 0xC0) == 0x80)
+	    return 2;
+    } else if (s[0] >= 0xE0 && s[0] <= 0xEF) {
+	if ((s + 2) < end
+	    && (s[1] & 0xC0) == 0x80
+	    && (s[2] & 0xC0) == 0x80
+	    && (s[0] != 0xE0 || s[1] >= 0xA0))
+	    return 3;
+    }
+    return 0;
+}
+
+/*
+ * Choose the engine which copies text for the current GL, GR and OTHER.  This
+ * is done again only when a designation or locking shift changes them.
+ */
+static int
+selectEngine(Iso2022Ptr is)
+{
+    const CharsetRec *other = OTHER(is);
+    int result = E_GENERIC;
+
+    if (other != NULL) {
+	if (other->other_recode != NULL
+	    && other->other_stack != NULL
+	    && other->other_aux != NULL) {
+	    if (other->other_stack == stack_utf8
+		&& other->other_recode == mapping_utf8)
+		result = E_UTF8;
+	    else
+		result = E_OTHER;
+	}
+    } else if (GL(is)->type == T_9494) {
+	result = E_JIS;
+    } else if (GL(is)->type == T_94 && isIdentityCharset(GL(is))) {
+	switch (GR(is)->type) {
+	case T_9494:
+	    result = E_EUC;
+	    break;
+	case T_96:
+	case T_128:
+	    result = E_8BIT;
+	    break;
+	default:
+	    result = E_ASCII;
+	    break;
+	}
+    }
+    TRACE(("selectEngine(GL=%s, GR=%s) -> %d\n",
+	   NonNull(GL(is)->name), NonNull(GR(is)->name), result));
+    return result;
+}
+
+/*
+ * Copy a run of text with the given engine, writing directly into the space
+ * reserved in outbuf, until reaching a byte which the per-byte code in
+ * copyOut() must interpret:  an escape, a single or locking shift, a C1
+ * control or an incomplete sequence.  Returns the end of the run.
+ *
+ * copyText() expands this once per engine, with the engine as a constant, so
+ * that each copy keeps only the tests for its own engine.
+ */
+#if defined(__GNUC__)
+#define ENGINE_INLINE __inline__ __attribute__((always_inline))
+#else
+#define ENGINE_INLINE		/* nothing */
+#endif
+
+static ENGINE_INLINE unsigned char *
+copyRun(Iso2022Ptr is, int fd, int engine, unsigned char *s, unsigned char *end)
+{
+    const CharsetRec *other = OTHER(is);
+    const ByteTable *bt = NULL;
+    RunTable rt;
+
+    if (engine == E_EUC)
+	initRunTable(&rt, GR(is));
+    else if (engine == E_JIS)
+	initRunTable(&rt, GL(is));
+    else if (engine == E_8BIT)
+	bt = getByteTable(GR(is));
+
+    for (;;) {
+	unsigned char *out;
+	unsigned char *limit;
+
+	OUTBUF_MAKE_FREE(is, fd, WORD_SIZE);
+	out = is->outbuf + is->outbuf_count;
+	limit = is->outbuf + is->outbuf_size - WORD_SIZE;
+
+	while (out <= limit && s < end) {
+	    if (engine == E_UTF8 || engine == E_OTHER) {
+		int c;
+		int n;
+
+		if (*s == ESC)
+		    break;
+		if (engine == E_UTF8
+		    && other->other_aux->utf8.buf_ptr == 0
+		    && (n = utf8Plain(s, end)) != 0) {
+		    while (n-- != 0)
+			*out++ = *s++;
+		    continue;
+		}
+		c = other->other_stack(*s++, other->other_aux);
+		if (c >= 0)
+		    out = putUTF8(other->other_recode((unsigned) c,
+						      other->other_aux), out);
+	    } else if (engine == E_JIS) {
+		if ((s + 1) < end
+		    && IS_GL94(s[0])
+		    && IS_GL94(s[1])) {
+		    out = putPair(&rt, PAIR(s[0], s[1]), out);
+		    s += 2;
+		} else {
+		    break;
+		}
+	    } else if (IS_GL_TEXT(*s)) {
+		s = copyAscii(s, end, &out, limit);
+	    } else if (engine == E_EUC
+		       && IS_GR94(s[0])
+		       && (s + 1) < end
+		       && IS_GR94(s[1])) {
+		out = putPair(&rt, PAIR(s[0] & 0x7F, s[1] & 0x7F), out);
+		s += 2;
+	    } else if (engine == E_8BIT
+		       && *s >= 0x80
+		       && bt->size[*s - 0x80] != BYTE_STOP) {
+		if (bt->latin1) {
+		    *out++ = UChar(0xC0 | (*s >> 6));
+		    *out++ = UChar(0x80 | (*s & 0x3F));
+		} else {
+		    unsigned n = (unsigned) (*s - 0x80);
+		    memcpy(out, bt->text[n], (size_t) 3);
+		    out += bt->size[n];
+		}
+		++s;
+	    } else {
+		break;
+	    }
+	}
+	is->outbuf_count = (size_t) (out - is->outbuf);
+	if (out <= limit)
+	    break;
+    }
+    return s;
+}
+
+/*
+ * Copy a run of text with the engine for the current state, if there is one.
+ */
+static unsigned char *
+copyText(Iso2022Ptr is, int fd, unsigned char *s, unsigned char *end)
+{
+    if (is->engine == E_UNKNOWN)
+	is->engine = selectEngine(is);
+
+    switch (is->engine) {
+    case E_ASCII:
+	s = copyRun(is, fd, E_ASCII, s, end);
+	break;
+    case E_8BIT:
+	s = copyRun(is, fd, E_8BIT, s, end);
+	break;
+    case E_EUC:
+	s = copyRun(is, fd, E_EUC, s, end);
+	break;
+    case E_JIS:
+	s = copyRun(is, fd, E_JIS, s, end);
+	break;
+    case E_OTHER:
+	s = copyRun(is, fd, E_OTHER, s, end);
+	break;
+    case E_UTF8:
+	s = copyRun(is, fd, E_UTF8, s, end);
+	break;
+    }
+    return s;
+}
+
 void
 copyOut(Iso2022Ptr is, int fd, unsigned char *buf, unsigned count)
 {
     unsigned char *s = buf;
+    unsigned char *end = buf + count;
+    unsigned char *p;
+    unsigned long bytes_out = is->stats.bytes_out;
 
+    PROBE2(copyout_entry, fd, count);
     if (ilog >= 0)
-	IGNORE_RC(write(ilog, buf, (size_t) count));
+	writeLog(ilog, buf, (size_t) count);
+    if (recording)
+	flightChunk(CAP_PROGRAM, buf, (size_t) count);
 
-    while (s < buf + count) {
+    is->stats.bytes_in += count;
+    outbuf_reserve(is, (3 * (size_t) count) + is->buffered_count + OUTBUF_SLACK);
+
+    while (s < end) {
 	switch (is->parserState) {
 	case P_NORMAL:
 	  resynch:
 	    if (is->buffered_ku < 0) {
-		if (*s == ESC) {
+		if (is->shiftState == S_NORMAL
+		    && is->engine != E_GENERIC
+		    && (p = copyText(is, fd, s, end)) != s) {
+		    s = p;
+		} else if (*s == ESC
+		    && (s + 1) < end
+		    && s[1] == CSI_7
+		    && (p = scanCSI(s + 2, end)) != NULL) {
+		    is->stats.escapes++;
+		    outbufBlock(is, fd, s, (size_t) (p - s));
+		    s = p;
+		} else if (*s == ESC) {
 		    buffer(is, *s++);
 		    is->parserState = P_ESC;
 		} else if (OTHER(is) != NULL
@@ -761,9 +1494,19 @@ copyOut(Iso2022Ptr is, int fd, unsigned char *buf, unsigned count)
 			is->shiftState = S_NORMAL;
 		    }
 		    s++;
+		} else if (*s == CSI
+			   && CHARSET_REGULAR(GR(is))
+			   && (p = scanCSI(s + 1, end)) != NULL) {
+		    is->stats.escapes++;
+		    outbufBlock(is, fd, s, (size_t) (p - s));
+		    s = p;
 		} else if (*s == CSI && CHARSET_REGULAR(GR(is))) {
 		    buffer(is, *s++);
 		    is->parserState = P_CSI;
+		} else if (IS_STRING_8(*s) && C1_STRINGS(is)) {
+		    is->stats.escapes++;
+		    is->parserState = (*s == DCS) ? P_STRING : P_TEXT;
+		    outbufUTF8(is, fd, *s++);
 		} else if ((*s == SS2 ||
 			    *s == SS3 ||
 			    *s == LS0 ||
@@ -896,6 +1639,7 @@ copyOut(Iso2022Ptr is, int fd, unsigned char *buf, unsigned count)
 			is->buffered_ku = -1;
 			is->shiftState = S_NORMAL;
 		    } else {
+			is->stats.invalid++;
 			is->buffered_ku = -1;
 			is->shiftState = S_NORMAL;
 			goto resynch;
@@ -909,6 +1653,7 @@ copyOut(Iso2022Ptr is, int fd, unsigned char *buf, unsigned count)
 			is->buffered_ku = -1;
 			is->shiftState = S_NORMAL;
 		    } else {
+			is->stats.invalid++;
 			is->buffered_ku = -1;
 			is->shiftState = S_NORMAL;
 			goto resynch;
@@ -925,6 +1670,7 @@ copyOut(Iso2022Ptr is, int fd, unsigned char *buf, unsigned count)
 			is->buffered_ku = -1;
 			is->shiftState = S_NORMAL;
 		    } else {
+			is->stats.invalid++;
 			is->buffered_ku = -1;
 			is->shiftState = S_NORMAL;
 			goto resynch;
@@ -942,6 +1688,11 @@ copyOut(Iso2022Ptr is, int fd, unsigned char *buf, unsigned count)
 	    if (*s == CSI_7) {
 		buffer(is, *s++);
 		is->parserState = P_CSI;
+	    } else if (is->buffered_count == 1 && IS_STRING_7(*s)) {
+		is->stats.escapes++;
+		is->parserState = (*s == DCS_7) ? P_STRING : P_TEXT;
+		buffer(is, *s++);
+		outbuf_buffered(is, fd);
 	    } else if (IS_FINAL_ESC(*s)) {
 		buffer(is, *s++);
 		terminate(is, fd);
@@ -959,79 +1710,117 @@ copyOut(Iso2022Ptr is, int fd, unsigned char *buf, unsigned count)
 		buffer(is, *s++);
 	    }
 	    break;
+	case P_STRING:
+	case P_TEXT:
+	    s = copyString(is, fd, s, end);
+	    break;
+	case P_STRING_ESC:
+	    if (*s == ST_7) {
+		outbufOne(is, fd, ESC);
+		outbufOne(is, fd, *s++);
+		is->parserState = P_NORMAL;
+	    } else {
+		/* any other escape sequence ends the string */
+		buffer(is, ESC);
+		is->parserState = P_ESC;
+	    }
+	    break;
 	default:
 	    abort();
 	    /* NOTREACHED */
 	}
     }
     outbuf_flush(is, fd);
+    addLatency(is);
+    PROBE3(copyout_return, fd, count, is->stats.bytes_out - bytes_out);
 }
 
 static void
 terminate(Iso2022Ptr is, int fd)
 {
+    PROBE2(terminate, is->buffered[0], is->buffered_count);
     if (is->outputFlags & OF_PASSTHRU) {
+	is->stats.escapes++;
 	outbuf_buffered(is, fd);
 	return;
     }
 
     switch (is->buffered[0]) {
     case SS2:
+	is->stats.single_shifts++;
 	if (is->outputFlags & OF_SS)
 	    is->shiftState = S_SS2;
 	discard_buffered(is);
 	return;
     case SS3:
+	is->stats.single_shifts++;
 	if (is->outputFlags & OF_SS)
 	    is->shiftState = S_SS3;
 	discard_buffered(is);
 	return;
     case LS0:
-	if (is->outputFlags & OF_LS)
+	if (is->outputFlags & OF_LS) {
 	    is->glp = &G0(is);
+	    is->engine = E_UNKNOWN;
+	}
 	discard_buffered(is);
 	return;
     case LS1:
-	if (is->outputFlags & OF_LS)
+	if (is->outputFlags & OF_LS) {
 	    is->glp = &G1(is);
+	    is->engine = E_UNKNOWN;
+	}
 	discard_buffered(is);
 	return;
     case ESC:
 	assert(is->buffered_count >= 2);
+	is->stats.escapes++;
 	switch (is->buffered[1]) {
 	case SS2_7:
+	    is->stats.single_shifts++;
 	    if (is->outputFlags & OF_SS)
 		is->shiftState = S_SS2;
 	    discard_buffered(is);
 	    return;
 	case SS3_7:
+	    is->stats.single_shifts++;
 	    if (is->outputFlags & OF_SS)
 		is->shiftState = S_SS3;
 	    discard_buffered(is);
 	    return;
 	case LS2_7:
-	    if (is->outputFlags & OF_SS)
+	    if (is->outputFlags & OF_SS) {
 		is->glp = &G2(is);
+		is->engine = E_UNKNOWN;
+	    }
 	    discard_buffered(is);
 	    return;
 	case LS3_7:
-	    if (is->outputFlags & OF_LS)
+	    if (is->outputFlags & OF_LS) {
 		is->glp = &G3(is);
+		is->engine = E_UNKNOWN;
+	    }
 	    discard_buffered(is);
 	    return;
 	case LS1R_7:
-	    if (is->outputFlags & OF_LS)
+	    if (is->outputFlags & OF_LS) {
 		is->grp = &G1(is);
+		is->engine = E_UNKNOWN;
+	    }
 	    discard_buffered(is);
 	    return;
 	case LS2R_7:
-	    if (is->outputFlags & OF_LS)
+	    if (is->outputFlags & OF_LS) {
 		is->grp = &G2(is);
+		is->engine = E_UNKNOWN;
+	    }
 	    discard_buffered(is);
 	    return;
 	case LS3R_7:
-	    if (is->outputFlags & OF_LS)
+	    if (is->outputFlags & OF_LS) {
 		is->grp = &G3(is);
+		is->engine = E_UNKNOWN;
+	    }
 	    discard_buffered(is);
 	    return;
 	default:
@@ -1042,6 +1831,7 @@ terminate(Iso2022Ptr is, int fd)
 	}
 	return;
     default:
+	is->stats.escapes++;
 	outbuf_buffered(is, fd);
     }
 }
@@ -1051,6 +1841,8 @@ terminateEsc(Iso2022Ptr is, int fd, unsigned char *s_start, unsigned count)
 {
     const CharsetRec *charset;
 
+    PROBE3(escape, s_start[0], s_start[count - 1], count);
+
     /* ISO 2022 doesn't allow 2C, but Emacs/MULE uses it in 7-bit
        mode */
 
@@ -1059,6 +1851,7 @@ terminateEsc(Iso2022Ptr is, int fd, unsigned char *s_start, unsigned count)
 	 s_start[0] == 0x2C || s_start[0] == 0x2D ||
 	 s_start[0] == 0x2E || s_start[0] == 0x2F) &&
 	count >= 2) {
+	is->stats.designations++;
 	if (is->outputFlags & OF_SELECT) {
 	    if (s_start[0] <= 0x2B)
 		charset = getCharset(s_start[1], T_94);
@@ -1082,12 +1875,17 @@ terminateEsc(Iso2022Ptr is, int fd, unsigned char *s_start, unsigned count)
 		G3(is) = charset;
 		break;
 	    }
+	    is->engine = E_UNKNOWN;
+	    PROBE3(designate, (s_start[0] - 0x28) & 3, s_start[1], charset->name);
 	}
 	discard_buffered(is);
     } else if (s_start[0] == 0x24 && count == 2) {
+	is->stats.designations++;
 	if (is->outputFlags & OF_SELECT) {
 	    charset = getCharset(s_start[1], T_9494);
 	    G0(is) = charset;
+	    is->engine = E_UNKNOWN;
+	    PROBE3(designate, 0, s_start[1], charset->name);
 	}
 	discard_buffered(is);
     } else if (s_start[0] == 0x24 && count >= 2 &&
@@ -1096,6 +1894,7 @@ terminateEsc(Iso2022Ptr is, int fd, unsigned char *s_start, unsigned count)
 		s_start[1] == 0x2D || s_start[1] == 0x2E ||
 		s_start[1] == 0x2F) &&
 	       count >= 3) {
+	is->stats.designations++;
 	if (is->outputFlags & OF_SELECT) {
 	    if (s_start[1] <= 0x2B)
 		charset = getCharset(s_start[2], T_9494);
@@ -1118,6 +1917,8 @@ terminateEsc(Iso2022Ptr is, int fd, unsigned char *s_start, unsigned count)
 		G3(is) = charset;
 		break;
 	    }
+	    is->engine = E_UNKNOWN;
+	    PROBE3(designate, (s_start[1] - 0x28) & 3, s_start[2], charset->name);
 	}
 	discard_buffered(is);
     } else
@@ -44,13 +44,35 @@ THE SOFTWARE.
 #define LS1R_7 0x7E
 #define LS2R_7 0x7D
 #define LS3R_7 0x7C
+#define BEL    0x07
+#define CAN    0x18
+#define SUB    0x1A
+#define DCS    0x90
+#define DCS_7  'P'
+#define SOS    0x98
+#define SOS_7  'X'
+#define ST     0x9C
+#define ST_7   '\\'
+#define OSC    0x9D
+#define OSC_7  ']'
+#define PM     0x9E
+#define PM_7   '^'
+#define APC    0x9F
+#define APC_7  '_'
 
 #define IS_FINAL_ESC(x) (((x) & 0xF0 ) != 0x20)
 #define IS_FINAL_CSI(x) (((x) & 0xF0 ) != 0x20 && (((x) & 0xF0 ) != 0x30))
+#define IS_STRING_7(x) ((x) == DCS_7 || (x) == SOS_7 || (x) == OSC_7 || \
+			(x) == PM_7 || (x) == APC_7)
+#define IS_STRING_8(x) ((x) == DCS || (x) == SOS || (x) == OSC || \
+			(x) == PM || (x) == APC)
 
 #define P_NORMAL    0
 #define P_ESC       1
 #define P_CSI       2
+#define P_STRING    3		/* payload of DCS */
+#define P_STRING_ESC 4		/* ESC within a string, maybe ST */
+#define P_TEXT      5		/* payload of OSC, APC, PM or SOS, while ASCII */
 
 #define S_NORMAL    0
 #define S_SS2       1
@@ -66,6 +88,55 @@ THE SOFTWARE.
 #define OF_SELECT   4
 #define OF_PASSTHRU 8
 
+#define E_UNKNOWN   0		/* engine is chosen at the next copyOut */
+#define E_GENERIC   1		/* no run engine, e.g., DEC graphics in GL */
+#define E_ASCII     2		/* ASCII in GL */
+#define E_8BIT      3		/* ASCII, and a 96- or 128-character set in GR */
+#define E_EUC       4		/* ASCII, and a 94x94 set in GR */
+#define E_JIS       5		/* a 94x94 set in GL */
+#define E_OTHER     6		/* a stateful multibyte encoding, e.g., SJIS */
+#define E_UTF8      7		/* UTF-8 */
+
+#define OUTSPAN_MAX 16		/* pieces of output in one write */
+
+typedef struct {
+    unsigned char *data;
+    size_t size;
+} OutSpan;
+
+/*
+ * A histogram of latencies in microseconds, with LATENCY_SUB buckets for each
+ * power of two, so that each bucket is within 1/LATENCY_SUB of its values.
+ */
+#define LATENCY_SUB	8
+#define LATENCY_BUCKETS	(30 * LATENCY_SUB)
+
+typedef struct {
+    unsigned long count;
+    unsigned long max;
+    unsigned long bucket[LATENCY_BUCKETS];
+} Latency;
+
+/*
+ * Counters for one direction, reported by -stats and SIGUSR1.  Each is updated
+ * once per call or per sequence, not per byte of text.
+ */
+typedef struct {
+    unsigned long bytes_in;	/* bytes given to copyIn or copyOut */
+    unsigned long bytes_out;	/* bytes written */
+    unsigned long reads;	/* read calls, counted by the caller */
+    unsigned long writes;	/* write and writev calls */
+    unsigned long flushes;	/* flushes of pending output */
+    unsigned long stalls;	/* writes which returned EAGAIN */
+    unsigned long stall_usecs;	/* time spent in waitForOutput */
+    unsigned long escapes;	/* escape sequences, controls and strings */
+    unsigned long designations;	/* charset designations */
+    unsigned long single_shifts;	/* SS2 and SS3 */
+    unsigned long unmapped;	/* characters without a reverse mapping */
+    unsigned long invalid;	/* malformed bytes which were discarded */
+    Latency latency;		/* from a read to the end of its writes */
+} IsoStats;
+
 typedef struct _Iso2022 {
     const CharsetRec **glp;
     const CharsetRec **grp;
@@ -75,12 +146,20 @@ typedef struct _Iso2022 {
     int shiftState;
     int inputFlags;
     int outputFlags;
+    int engine;			/* copyOut engine for GL, GR and OTHER */
     unsigned char *buffered;
     size_t buffered_len;
     size_t buffered_count;
     int buffered_ku;
     unsigned char *outbuf;
+    size_t outbuf_size;
     size_t outbuf_count;
+    size_t outbuf_mark;		/* outbuf[] before this is in outspan[] */
+    OutSpan outspan[OUTSPAN_MAX];	/* output pending, in order */
+    unsigned outspan_count;
+    unsigned char *retired;	/* old buffered[], referenced by outspan[] */
+    IsoStats stats;
+    unsigned long read_usecs;	/* when the caller read this data, or 0 */
 } Iso2022Rec, *Iso2022Ptr;
 
 #define GL(i) (*(i)->glp)
@@ -97,11 +176,9 @@ Iso2022Ptr allocIso2022(void);
 int initIso2022(const char *, const char *, Iso2022Ptr);
 int mergeIso2022(Iso2022Ptr, Iso2022Ptr);
 void reportIso2022(const char *, Iso2022Ptr);
+void statsIso2022(FILE *, const char *, Iso2022Ptr);
 void copyIn(Iso2022Ptr, int, unsigned char *, int);
 void copyOut(Iso2022Ptr, int, unsigned char *, unsigned);
-
-#ifdef NO_LEAKS
 void destroyIso2022(Iso2022Ptr);
-#endif
 
 #endif /* LUIT_ISO2022_H */
@@ -0,0 +1,418 @@
+/*
+ * Copyright 2026 by the luit contributors
+ *
+ * All Rights Reserved
+ *
+ * Permission to use, copy, modify, and distribute this software and its
+ * documentation for any purpose and without fee is hereby granted,
+ * provided that the above copyright notice appear in all copies and that
+ * both that copyright notice and this permission notice appear in
+ * supporting documentation, and that the name of the above listed
+ * copyright holder(s) not be used in advertising or publicity pertaining
+ * to distribution of the software without specific, written prior
+ * permission.
+ *
+ * THE ABOVE LISTED COPYRIGHT HOLDER(S) DISCLAIM ALL WARRANTIES WITH REGARD
+ * TO THIS SOFTWARE, INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS, IN NO EVENT SHALL THE ABOVE LISTED COPYRIGHT HOLDER(S) BE
+ * LIABLE FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * Logs (-ilog, -olog and -capture) are written by a thread, so that the
+ * conversion does not wait for the disk.  Each log has a ring buffer which the
+ * main loop fills and the thread drains.  When a ring is full, the main loop
+ * waits for the thread, or with -log-drop discards the data and counts it.
+ *
+ * The thread writes a log when it has a chunk of data, or a tenth of a second
+ * after the data arrived, whichever is first.
+ *
+ * A log whose name ends with ".gz" is compressed with zlib as it is written.
+ * The compressed stream is flushed whenever the thread catches up, so that
+ * the file can be read up to that point if luit does not exit cleanly.
+ *
+ * Without threads, each log is written as the data arrives.
+ */
+
+#include <logfile.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <signal.h>
+
+#if defined(HAVE_PTHREAD_H) && defined(HAVE_LIBPTHREAD)
+#define USE_LOG_THREAD 1
+#include <pthread.h>
+#include <sys/time.h>
+#include <time.h>
+#endif
+
+#ifdef USE_ZLIB
+#define ZLIB_CONST
+#include <zlib.h>
+#endif
+
+#include <sys.h>
+
+#define MAX_LOGS	4
+#define LOG_RING	(1 << 20)	/* bytes buffered for each log */
+#define LOG_CHUNK	65536	/* bytes compressed or written at once */
+#define LOG_DELAY	100000L	/* microseconds before writing a partial chunk */
+
+typedef struct {
+    int fd;
+    int failed;			/* errno from a failed write, or zero */
+#ifdef USE_ZLIB
+    int compress;
+    z_stream zs;
+#endif
+    unsigned char *ring;
+    size_t head;		/* bytes added, modulo LOG_RING */
+    size_t tail;		/* bytes written, modulo LOG_RING */
+    size_t count;		/* bytes in the ring */
+    unsigned long bytes;	/* bytes logged */
+    unsigned long dropped;	/* bytes discarded because the ring was full */
+    unsigned long waits;	/* times the main loop waited for the thread */
+    unsigned long woken;	/* waits which the thread has answered */
+} LogRec;
+
+static LogRec logs[MAX_LOGS];
+static int log_count;
+static int log_drop;
+
+#ifdef USE_LOG_THREAD
+static pthread_t log_thread;
+static pthread_mutex_t log_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t log_ready = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t log_space = PTHREAD_COND_INITIALIZER;
+static int log_running;
+static int log_closing;
+static int log_idle;		/* the thread is waiting for data */
+static int log_waiting;		/* the thread is waiting for a chunk */
+static int log_due;		/* the wait for a chunk has timed out */
+#endif
+
+static void
+writeAll(LogRec * lp, const unsigned char *data, size_t size)
+{
+    while (size != 0 && !lp->failed) {
+	int rc = (int) write(lp->fd, data, size);
+	if (rc > 0) {
+	    data += rc;
+	    size -= (size_t) rc;
+	} else if (rc < 0 && errno == EINTR) {
+	    continue;
+	} else {
+	    lp->failed = (rc < 0) ? errno : EIO;
+	}
+    }
+}
+
+/*
+ * Write data to the file, compressing it if needed.  "flush" is Z_NO_FLUSH,
+ * Z_SYNC_FLUSH or Z_FINISH.
+ */
+static void
+writeData(LogRec * lp, const unsigned char *data, size_t size, int flush)
+{
+#ifdef USE_ZLIB
+    if (lp->compress) {
+	unsigned char out[LOG_CHUNK];
+
+	lp->zs.next_in = data;
+	lp->zs.avail_in = (uInt) size;
+	do {
+	    lp->zs.next_out = out;
+	    lp->zs.avail_out = (uInt) sizeof(out);
+	    if (deflate(&lp->zs, flush) == Z_STREAM_ERROR) {
+		lp->failed = EIO;
+		break;
+	    }
+	    writeAll(lp, out, sizeof(out) - lp->zs.avail_out);
+	} while (lp->zs.avail_out == 0);
+	return;
+    }
+#else
+    (void) flush;
+#endif
+    writeAll(lp, data, size);
+}
+
+#ifdef USE_ZLIB
+#define FLUSH_NONE	Z_NO_FLUSH
+#define FLUSH_SYNC	Z_SYNC_FLUSH
+#define FLUSH_FINISH	Z_FINISH
+#else
+#define FLUSH_NONE	0
+#define FLUSH_SYNC	0
+#define FLUSH_FINISH	0
+#endif
+
+/*
+ * Open a log, returning a handle for writeLog(), or -1.  Logs are opened
+ * before the fork, so keep the descriptor from the child's program.
+ */
+int
+openLog(const char *name, int mode)
+{
+    LogRec *lp;
+    size_t len = strlen(name);
+
+    if (log_count >= MAX_LOGS) {
+	errno = EMFILE;
+	return -1;
+    }
+    lp = &logs[log_count];
+    memset(lp, 0, sizeof(*lp));
+    if ((lp->fd = open(name, O_WRONLY | O_CREAT | O_TRUNC, mode)) < 0)
+	return -1;
+    (void) fcntl(lp->fd, F_SETFD, FD_CLOEXEC);
+#ifdef USE_ZLIB
+    if (len > 3 && !strcmp(name + len - 3, ".gz")) {
+	if (deflateInit2(&lp->zs, Z_BEST_SPEED, Z_DEFLATED,
+			 MAX_WBITS + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+	    close(lp->fd);
+	    errno = ENOMEM;
+	    return -1;
+	}
+	lp->compress = 1;
+    }
+#else
+    (void) len;
+#endif
+    return log_count++;
+}
+
+#ifdef USE_LOG_THREAD
+/*
+ * The thread waits for a ring to fill a chunk, or for LOG_DELAY after data
+ * arrives, so that it is not woken for each write.
+ */
+typedef enum {
+    lsEmpty,			/* nothing to write */
+    lsPending,			/* some data, but not yet a chunk */
+    lsReady			/* a chunk, a full ring, or closing */
+} LogState;
+
+static LogState
+logState(void)
+{
+    LogState result = lsEmpty;
+    int n;
+
+    for (n = 0; n < log_count; ++n) {
+	LogRec *lp = &logs[n];
+
+	if (lp->count >= LOG_CHUNK || lp->waits != lp->woken)
+	    result = lsReady;
+	else if (lp->count != 0 && result == lsEmpty)
+	    result = lsPending;
+    }
+    if (log_closing && result == lsPending)
+	result = lsReady;
+    return result;
+}
+
+/*
+ * Write each log's ring buffer until closeLogs() asks the thread to stop and
+ * the rings are empty.
+ */
+static void *
+logWriter(void *arg GCC_UNUSED)
+{
+    int n;
+
+    pthread_mutex_lock(&log_lock);
+    for (;;) {
+	LogState state = logState();
+
+	if (state == lsEmpty) {
+	    if (log_closing)
+		break;
+	    log_idle = 1;
+	    pthread_cond_wait(&log_ready, &log_lock);
+	    log_idle = 0;
+	    continue;
+	} else if (state == lsPending && !log_due) {
+	    struct timeval now;
+	    struct timespec until;
+
+	    gettimeofday(&now, NULL);
+	    until.tv_sec = now.tv_sec + (time_t) ((now.tv_usec + LOG_DELAY) / 1000000L);
+	    until.tv_nsec = ((now.tv_usec + LOG_DELAY) % 1000000L) * 1000L;
+	    log_waiting = 1;
+	    if (pthread_cond_timedwait(&log_ready, &log_lock, &until) != 0)
+		log_due = 1;
+	    log_waiting = 0;
+	    continue;
+	}
+
+	log_due = 0;
+	for (n = 0; n < log_count; ++n) {
+	    LogRec *lp = &logs[n];
+
+	    while (lp->count != 0) {
+		size_t size = lp->count;
+		int flush;
+
+		if (size > LOG_RING - lp->tail)
+		    size = LOG_RING - lp->tail;
+		if (size > LOG_CHUNK)
+		    size = LOG_CHUNK;
+		/* flush the compressed stream when this empties the ring */
+		flush = (size == lp->count) ? FLUSH_SYNC : FLUSH_NONE;
+		pthread_mutex_unlock(&log_lock);
+
+		writeData(lp, lp->ring + lp->tail, size, flush);
+
+		pthread_mutex_lock(&log_lock);
+		lp->tail = (lp->tail + size) % LOG_RING;
+		lp->count -= size;
+		if (lp->waits != lp->woken) {
+		    lp->woken = lp->waits;
+		    pthread_cond_signal(&log_space);
+		}
+	    }
+	}
+    }
+    pthread_mutex_unlock(&log_lock);
+    return NULL;
+}
+#endif
+
+/*
+ * Start writing logs from a thread.  Call this after any fork, since the
+ * child would have the thread's state but not the thread.  If "drop" is set,
+ * data which does not fit in a full ring is discarded rather than waited for.
+ */
+void
+startLogs(int drop)
+{
+    log_drop = drop;
+#ifdef USE_LOG_THREAD
+    if (log_count != 0 && !log_running) {
+	sigset_t all, old;
+	int n;
+
+	for (n = 0; n < log_count; ++n) {
+	    if ((logs[n].ring = malloc((size_t) LOG_RING)) == NULL)
+		FatalError("Couldn't allocate log buffer.\n");
+	}
+	/* signals such as SIGCHLD must interrupt the main loop, not this */
+	sigfillset(&all);
+	pthread_sigmask(SIG_BLOCK, &all, &old);
+	if (pthread_create(&log_thread, NULL, logWriter, NULL) == 0)
+	    log_running = 1;
+	pthread_sigmask(SIG_SETMASK, &old, NULL);
+    }
+#else
+    (void) drop;
+#endif
+}
+
+void
+writeLog(int handle, const void *data, size_t size)
+{
+    LogRec *lp = &logs[handle];
+    const unsigned char *s = (const unsigned char *) data;
+
+    lp->bytes += size;
+#ifdef USE_LOG_THREAD
+    if (log_running) {
+	pthread_mutex_lock(&log_lock);
+	if (log_drop && size > LOG_RING - lp->count) {
+	    lp->dropped += size;
+	    size = 0;
+	}
+	while (size != 0) {
+	    size_t part = LOG_RING - lp->count;
+
+	    if (part == 0) {
+		lp->waits++;
+		pthread_cond_signal(&log_ready);
+		while (lp->waits != lp->woken)
+		    pthread_cond_wait(&log_space, &log_lock);
+		continue;
+	    }
+	    if (part > size)
+		part = size;
+	    if (part > LOG_RING - lp->head)
+		part = LOG_RING - lp->head;
+	    memcpy(lp->ring + lp->head, s, part);
+	    lp->head = (lp->head + part) % LOG_RING;
+	    lp->count += part;
+	    s += part;
+	    size -= part;
+	}
+	if (log_idle || (log_waiting && lp->count >= LOG_CHUNK))
+	    pthread_cond_signal(&log_ready);
+	pthread_mutex_unlock(&log_lock);
+	return;
+    }
+#endif
+    writeData(lp, s, size, FLUSH_NONE);
+}
+
+/*
+ * Write everything which is pending, and close the logs.
+ */
+void
+closeLogs(void)
+{
+    int n;
+
+#ifdef USE_LOG_THREAD
+    if (log_running) {
+	pthread_mutex_lock(&log_lock);
+	log_closing = 1;
+	pthread_cond_signal(&log_ready);
+	pthread_mutex_unlock(&log_lock);
+	pthread_join(log_thread, NULL);
+	log_running = 0;
+    }
+#endif
+    for (n = 0; n < log_count; ++n) {
+	LogRec *lp = &logs[n];
+
+#ifdef USE_ZLIB
+	if (lp->compress) {
+	    writeData(lp, NULL, (size_t) 0, FLUSH_FINISH);
+	    deflateEnd(&lp->zs);
+	}
+#endif
+	if (lp->failed)
+	    Warning("Couldn't write log: %s\n", strerror(lp->failed));
+	close(lp->fd);
+	if (lp->ring != NULL)
+	    free(lp->ring);
+    }
+    log_count = 0;
+}
+
+void
+statsLogs(FILE *fp)
+{
+    unsigned long bytes = 0;
+    unsigned long dropped = 0;
+    unsigned long waits = 0;
+    int n;
+
+#ifdef USE_LOG_THREAD
+    pthread_mutex_lock(&log_lock);
+#endif
+    for (n = 0; n < log_count; ++n) {
+	bytes += logs[n].bytes;
+	dropped += logs[n].dropped;
+	waits += logs[n].waits;
+    }
+#ifdef USE_LOG_THREAD
+    pthread_mutex_unlock(&log_lock);
+#endif
+    fprintf(fp, "log.bytes %lu\n", bytes);
+    fprintf(fp, "log.dropped %lu\n", dropped);
+    fprintf(fp, "log.waits %lu\n", waits);
+}
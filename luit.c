@@ -31,11 +31,14 @@ THE SOFTWARE.
 #include <errno.h>
 #include <sys/ioctl.h>
 #include <signal.h>
+#include <time.h>
 
 #include <version.h>
 #include <sys.h>
 #include <parser.h>
 #include <iso2022.h>
+#include <capture.h>
+#include <logfile.h>
 
 static void parent(int, int);
 
@@ -47,63 +50,30 @@ static Iso2022Ptr inputState = NULL, outputState = NULL;
 
 static char *child_argv0 = NULL;
 static const char *locale_name = NULL;
+static const char *stats_file = NULL;
+static const char *capture_file = NULL;
+static const char *replay_file = NULL;
+static int replay_timed = 0;
+static int log_drop = 0;
+static int profile_startup = 0;
+static int exec_pipe[2] = {-1, -1};
+static size_t flight_size = 0;
+static char *flight_exit = NULL;
+static int flight_pid = 0;
 static int exitOnChild = 0;
 static int converter = 0;
 static int testonly = 0;
-static int warnings = 0;
-
-const char *locale_alias = LOCALE_ALIAS_FILE;
-
-int ilog = -1;
-int olog = -1;
-int verbose = 0;
-int ignore_locale = 0;
-int fill_fontenc = 0;
-
-#ifdef USE_ICONV
-UM_MODE lookup_order[] =
-{
-    umFONTENC, umBUILTIN, umICONV, umPOSIX, umNONE
-};
-#endif
 
 static volatile int sigwinch_queued = 0;
 static volatile int sigchld_queued = 0;
+static volatile int sigusr1_queued = 0;
+static volatile int sigusr2_queued = 0;
 
 static int convert(int, int);
+static int replay(const char *);
 static int condom(int, char **);
 static void child(char *, char *, char *const *);
 
-void
-Message(const char *f,...)
-{
-    va_list args;
-    va_start(args, f);
-    vfprintf(stderr, f, args);
-    va_end(args);
-}
-
-void
-Warning(const char *f,...)
-{
-    va_list args;
-    va_start(args, f);
-    fputs("Warning: ", stderr);
-    vfprintf(stderr, f, args);
-    va_end(args);
-    ++warnings;
-}
-
-void
-FatalError(const char *f,...)
-{
-    va_list args;
-    va_start(args, f);
-    vfprintf(stderr, f, args);
-    va_end(args);
-    ExitFailure();
-}
-
 static void
 help(const char *program, int fatal)
 {
@@ -118,8 +88,12 @@ help(const char *program, int fatal)
 	DATA("alias filename", -, "location of the locale alias file"),
 	DATA("argv0 name", -, "set child's name"),
 	DATA("c", -, "simple converter stdin/stdout"),
+	DATA("cache directory", -, "share conversion tables via files in this directory"),
+	DATA("capture filename", -, "record reads and writes with their times to this file"),
+	DATA("check-builtin", -, "check generated tables of built-in encodings"),
 	DATA("encoding encoding", -, "use this encoding rather than current locale's encoding"),
 	DATA("fill-fontenc", -, "fill in one-one mapping in -show-fontenc report"),
+	DATA("flight-recorder size", -, "keep recent traffic in memory, written on SIGUSR2"),
 	DATA("g0 set", -, "set output G0 charset (default ASCII)"),
 	DATA("g1 set", -, "set output G1 charset"),
 	DATA("g2 set", -, "set output G2 charset"),
@@ -142,6 +116,7 @@ help(const char *program, int fatal)
 	DATA("list-builtin", -, "list built-in encodings"),
 	DATA("list-fontenc", -, "list available \".enc\" encoding files"),
 	DATA("list-iconv", -, "list iconv-supported encodings"),
+	DATA("log-drop", -, "discard log data rather than wait when logging falls behind"),
 	DATA("olog filename", -, "log all output to this file"),
 	DATA("ols", +, "disable locking-shifts in output"),
 	DATA("osl", +, "disable charset-selection sequences in output"),
@@ -149,9 +124,13 @@ help(const char *program, int fatal)
 	DATA("ot", +, "disable interpretation of all sequences in output"),
 	DATA("p", -, "do parent/child handshake"),
 	DATA("prefer list", -, "override preference between fontenc/iconv lookups"),
+	DATA("profile-startup", -, "report the time taken by each startup phase on exit"),
+	DATA("replay filename", -, "convert the program output from a capture file"),
+	DATA("replay-timed", -, "replay with the captured timing"),
 	DATA("show-builtin enc", -, "show details of a given built-in encoding"),
 	DATA("show-fontenc enc", -, "show details of an \".enc\" encoding file"),
 	DATA("show-iconv enc", -, "show iconv encoding in \".enc\" format"),
+	DATA("stats filename", -, "append statistics to this file on SIGUSR1 and exit"),
 	DATA("t", -, "testing (initialize locale but no terminal)"),
 	DATA("v", -, "verbose (repeat to increase level)"),
 	DATA("x", -, "exit as soon as child dies"),
@@ -291,6 +270,7 @@ needIconvCfg(void)
     return EXIT_FAILURE;
 }
 
+#define checkBuiltinCharsets()   needIconvCfg()
 #define reportBuiltinCharsets()  needIconvCfg()
 #define reportIconvCharsets()    needIconvCfg()
 #define setLookupOrder(name)     needIconvCfg()
@@ -307,6 +287,32 @@ needParam(int argc, char **argv, int now)
 }
 #define getParam(now) needParam(argc, argv, now)
 
+/*
+ * Parse a size in bytes, with an optional "k" or "m" suffix.
+ */
+static size_t
+parseSize(const char *option, const char *value)
+{
+    char *next;
+    unsigned long result = strtoul(value, &next, 10);
+
+    switch (*next) {
+    case 'k':
+    case 'K':
+	result <<= 10;
+	++next;
+	break;
+    case 'm':
+    case 'M':
+	result <<= 20;
+	++next;
+	break;
+    }
+    if (next == value || *next != '\0' || result == 0)
+	FatalError("The argument of %s should be a size, e.g., 16m\n", option);
+    return (size_t) result;
+}
+
 static int
 parseOptions(int argc, char **argv)
 {
@@ -341,6 +347,8 @@ parseOptions(int argc, char **argv)
 	    ExitProgram(showFontencCharset(getParam(i)));
 	} else if (!strcmp(argv[i], "-show-iconv")) {
 	    ExitProgram(showIconvCharset(getParam(i)));
+	} else if (!strcmp(argv[i], "-check-builtin")) {
+	    ExitProgram(checkBuiltinCharsets());
 	} else if (!strcmp(argv[i], "-list-builtin")) {
 	    ExitProgram(reportBuiltinCharsets());
 	} else if (!strcmp(argv[i], "-list-fontenc")) {
@@ -461,26 +469,46 @@ parseOptions(int argc, char **argv)
 	    converter = 1;
 	    i++;
 	} else if (!strcmp(argv[i], "-ilog")) {
-	    if (ilog >= 0)
-		close(ilog);
-	    ilog = open(getParam(i), O_WRONLY | O_CREAT | O_TRUNC, 0777);
+	    ilog = openLog(getParam(i), 0777);
 	    if (ilog < 0) {
 		perror("Couldn't open input log");
 		ExitFailure();
 	    }
 	    i += 2;
 	} else if (!strcmp(argv[i], "-olog")) {
-	    if (olog >= 0)
-		close(olog);
-	    olog = open(getParam(i), O_WRONLY | O_CREAT | O_TRUNC, 0777);
+	    olog = openLog(getParam(i), 0777);
 	    if (olog < 0) {
 		perror("Couldn't open output log");
 		ExitFailure();
 	    }
 	    i += 2;
+	} else if (!strcmp(argv[i], "-capture")) {
+	    capture_file = getParam(i);
+	    i += 2;
+	} else if (!strcmp(argv[i], "-replay")) {
+	    replay_file = getParam(i);
+	    i += 2;
+	} else if (!strcmp(argv[i], "-flight-recorder")) {
+	    flight_size = parseSize(argv[i], getParam(i));
+	    i += 2;
+	} else if (!strcmp(argv[i], "-profile-startup")) {
+	    profile_startup = 1;
+	    i += 1;
+	} else if (!strcmp(argv[i], "-log-drop")) {
+	    log_drop = 1;
+	    i += 1;
+	} else if (!strcmp(argv[i], "-replay-timed")) {
+	    replay_timed = 1;
+	    i += 1;
+	} else if (!strcmp(argv[i], "-stats")) {
+	    stats_file = getParam(i);
+	    i += 2;
 	} else if (!strcmp(argv[i], "-alias")) {
 	    locale_alias = getParam(i);
 	    i += 2;
+	} else if (!strcmp(argv[i], "-cache")) {
+	    table_cache = getParam(i);
+	    i += 2;
 	} else if (!strcmp(argv[i], "-encoding")) {
 	    locale_name = getParam(i);
 	    ignore_locale = 1;
@@ -568,7 +596,9 @@ main(int argc, char **argv)
 	putenv(l);
 #endif
 
+    profileBegin("setlocale", NULL);
     l = setlocale(LC_ALL, "");
+    profileEnd(l ? NULL : "failed");
     if (!l)
 	Warning("couldn't set locale.\n");
     TRACE(("setlocale ->%s\n", NonNull(l)));
@@ -598,7 +628,9 @@ main(int argc, char **argv)
 	locale_name = "C";
     }
 
+    profileBegin("parseOptions", NULL);
     i = parseOptions(argc, argv);
+    profileEnd(NULL);
     if (i < 0)
 	FatalError("Couldn't parse options\n");
 
@@ -618,11 +650,21 @@ main(int argc, char **argv)
 	    rc += warnings;
 	}
     } else {
-	if (converter)
+	if (replay_file != NULL)
+	    rc = replay(replay_file);
+	else if (converter)
 	    rc = convert(0, 1);
 	else
 	    rc = condom(argc - i, argv + i);
     }
+    if (flight_exit != NULL) {
+	closeFlight();
+	free(flight_exit);
+	flight_exit = NULL;
+    }
+    closeLogs();
+    if (profile_startup)
+	reportProfile(stderr);
 
 #ifdef NO_LEAKS
     ExitProgram(rc);
@@ -630,6 +672,145 @@ main(int argc, char **argv)
     return rc;
 }
 
+/*
+ * Append the counters for both directions to the -stats file, or to stderr.
+ * This is called from the main loop, not from the signal handler.
+ */
+static void
+writeStats(void)
+{
+    FILE *fp = stderr;
+
+    if (stats_file != NULL && (fp = fopen(stats_file, "a")) == NULL) {
+	perror("Couldn't open statistics file");
+	return;
+    }
+    fprintf(fp, "# luit %ld %ld\n", (long) getpid(), (long) time(NULL));
+    statsIso2022(fp, "output", outputState);
+    statsIso2022(fp, "input", inputState);
+    statsLogs(fp);
+    if (fp != stderr)
+	fclose(fp);
+    else
+	fflush(fp);
+}
+
+static void
+sigusr1Handler(int sig GCC_UNUSED)
+{
+    sigusr1_queued = 1;
+}
+
+static void
+sigusr2Handler(int sig GCC_UNUSED)
+{
+    sigusr2_queued = 1;
+}
+
+/*
+ * The flight recorder is written to $TMPDIR, or /tmp, in a file named for the
+ * process and "suffix".
+ */
+static char *
+flightName(const char *suffix)
+{
+    const char *dir = getenv("TMPDIR");
+    char *result;
+
+    if (dir == NULL || *dir == '\0')
+	dir = "/tmp";
+    if ((result = malloc(strlen(dir) + strlen(suffix) + 40)) != NULL)
+	sprintf(result, "%s/luit-flight.%ld.%s", dir, (long) getpid(), suffix);
+    return result;
+}
+
+static int
+writeFlight(const char *name)
+{
+    int fd = open(name, O_WRONLY | O_CREAT | O_EXCL, 0600);
+    int rc = -1;
+
+    if (fd >= 0) {
+	rc = dumpFlight(fd);
+	close(fd);
+    }
+    return rc;
+}
+
+/*
+ * On SIGUSR2, write the flight recorder to a new file, numbered in sequence.
+ */
+static void
+saveFlight(void)
+{
+    static int serial;
+    char suffix[20];
+    char *name;
+
+    sprintf(suffix, "%d", ++serial);
+    if ((name = flightName(suffix)) != NULL) {
+	if (writeFlight(name) < 0)
+	    perror("Couldn't write flight recorder");
+	free(name);
+    }
+}
+
+/*
+ * If luit exits without finishing normally, e.g., with FatalError(), or if it
+ * crashes, write the flight recorder to the file named "exit".  main() stops
+ * the recorder before a normal exit.  The child process, before it runs the
+ * program, leaves the file alone.
+ */
+static void
+exitFlight(void)
+{
+    if (recording && flight_pid == (int) getpid()) {
+	recording = 0;
+	if (writeFlight(flight_exit) == 0)
+	    Message("Flight recorder written to %s\n", flight_exit);
+    }
+}
+
+static void
+crashHandler(int sig)
+{
+    if (recording && flight_pid == (int) getpid()) {
+	recording = 0;
+	(void) writeFlight(flight_exit);
+    }
+    installHandler(sig, SIG_DFL);
+    raise(sig);
+}
+
+/*
+ * Open the -capture file, after dropping privileges, and set up the flight
+ * recorder, if wanted.  The caller starts the thread which writes the logs
+ * with startLogs(), in condom() only after the fork.
+ */
+static void
+startLogging(void)
+{
+    if (capture_file != NULL && openCapture(capture_file) < 0) {
+	perror("Couldn't open capture file");
+	ExitFailure();
+    }
+
+    if (flight_size != 0) {
+	if (openFlight(flight_size) < 0
+	    || (flight_exit = flightName("exit")) == NULL)
+	    FatalError("Couldn't allocate flight recorder\n");
+	flight_pid = (int) getpid();
+	atexit(exitFlight);
+	installHandler(SIGSEGV, crashHandler);
+#ifdef SIGBUS
+	installHandler(SIGBUS, crashHandler);
+#endif
+	installHandler(SIGFPE, crashHandler);
+	installHandler(SIGILL, crashHandler);
+	installHandler(SIGABRT, crashHandler);
+    }
+}
+
 static int
 convert(int ifd, int ofd)
 {
@@ -641,18 +822,110 @@ convert(int ifd, int ofd)
 	perror("Couldn't drop privileges");
 	ExitFailure();
     }
+    startLogging();
+    startLogs(log_drop);
+    installHandler(SIGUSR1, sigusr1Handler);
+    if (recording)
+	installHandler(SIGUSR2, sigusr2Handler);
 
     while (1) {
 	i = (int) read(ifd, buf, (size_t) BUFFER_SIZE);
+	if (sigusr1_queued) {
+	    sigusr1_queued = 0;
+	    writeStats();
+	    flushCapture(1);
+	}
+	if (sigusr2_queued) {
+	    sigusr2_queued = 0;
+	    saveFlight();
+	}
 	if (i <= 0) {
 	    if (i < 0) {
+		if (errno == EINTR)
+		    continue;
 		perror("Read error");
 		ExitFailure();
 	    }
 	    break;
 	}
+	outputState->stats.reads++;
+	outputState->read_usecs = monotonicUsecs();
+	if (capturing)
+	    captureChunk(CAP_PROGRAM, buf, (size_t) i);
 	copyOut(outputState, ofd, buf, (unsigned) i);
+	flushCapture(0);
+    }
+    installHandler(SIGUSR1, SIG_DFL);
+    if (recording)
+	installHandler(SIGUSR2, SIG_DFL);
+    closeCapture();
+    if (stats_file != NULL)
+	writeStats();
+    return 0;
+}
+
+/*
+ * Convert the program output from a capture file to the standard output, and
+ * the keyboard input to /dev/null, as fast as possible or with the captured
+ * timing.
+ */
+static int
+replay(const char *name)
+{
+    CaptureRec rec;
+    ReplayFile *fp;
+    int sink;
+    int rc;
+    unsigned long due;
+
+    if ((fp = openReplay(name)) == NULL) {
+	perror("Couldn't open replay file");
+	ExitFailure();
+    }
+    if ((sink = open("/dev/null", O_WRONLY)) < 0) {
+	perror("Couldn't open /dev/null");
+	ExitFailure();
     }
+
+    startLogging();
+    startLogs(log_drop);
+
+    memset(&rec, 0, sizeof(rec));
+    due = monotonicUsecs();
+    while ((rc = readReplay(fp, &rec)) > 0) {
+	due += rec.delay;
+	if (replay_timed) {
+	    unsigned long now = monotonicUsecs();
+
+	    if ((long) (due - now) > 0) {
+		struct timespec ts;
+
+		ts.tv_sec = (time_t) ((due - now) / 1000000UL);
+		ts.tv_nsec = (long) ((due - now) % 1000000UL) * 1000L;
+		nanosleep(&ts, NULL);
+	    }
+	}
+	switch (rec.type) {
+	case CAP_PROGRAM:
+	    outputState->stats.reads++;
+	    outputState->read_usecs = monotonicUsecs();
+	    copyOut(outputState, 1, rec.data, (unsigned) rec.size);
+	    break;
+	case CAP_KEYBOARD:
+	    inputState->stats.reads++;
+	    inputState->read_usecs = monotonicUsecs();
+	    copyIn(inputState, sink, rec.data, (int) rec.size);
+	    break;
+	}
+    }
+    if (rc < 0)
+	Warning("Capture file %s is truncated or corrupt\n", name);
+
+    free(rec.data);
+    close(sink);
+    closeReplay(fp);
+    if (stats_file != NULL)
+	writeStats();
     return 0;
 }
 
@@ -681,6 +954,9 @@ setup_io(int pty)
     installHandler(SIGWINCH, sigwinchHandler);
 #endif
     installHandler(SIGCHLD, sigchldHandler);
+    installHandler(SIGUSR1, sigusr1Handler);
+    if (recording)
+	installHandler(SIGUSR2, sigusr2Handler);
 
     rc = copyTermios(0, pty);
     if (rc < 0)
@@ -713,6 +989,9 @@ cleanup_io(int pty)
     installHandler(SIGWINCH, SIG_DFL);
 #endif
     installHandler(SIGCHLD, SIG_DFL);
+    installHandler(SIGUSR1, SIG_DFL);
+    if (recording)
+	installHandler(SIGUSR2, SIG_DFL);
 
     val = fcntl(0, F_GETFL, 0);
     if (val >= 0) {
@@ -759,7 +1038,9 @@ condom(int argc, char **argv)
     if (rc < 0)
 	FatalError("Couldn't parse arguments\n");
 
+    profileBegin("allocatePty", NULL);
     rc = allocatePty(&pty, &line);
+    profileEnd(NULL);
     if (rc < 0) {
 	perror("Couldn't allocate pty");
 	ExitFailure();
@@ -770,13 +1051,22 @@ condom(int argc, char **argv)
 	perror("Couldn't drop privileges");
 	ExitFailure();
     }
+    startLogging();
 
     if (pipe_option) {
 	IGNORE_RC(pipe(p2c_waitpipe));
 	IGNORE_RC(pipe(c2p_waitpipe));
     }
 
+    /*
+     * To time the exec, the child holds a pipe which is closed by exec, or
+     * when the child exits.
+     */
+    if (profile_startup && pipe(exec_pipe) == 0)
+	(void) fcntl(exec_pipe[1], F_SETFD, FD_CLOEXEC);
+
     TRACE(("...forking to run %s(%s)\n", path, child_argv[0]));
+    profileBegin("fork", NULL);
     pid = fork();
     if (pid < 0) {
 	perror("Couldn't fork");
@@ -784,12 +1074,21 @@ condom(int argc, char **argv)
     }
 
     if (pid == 0) {
+	if (exec_pipe[0] >= 0)
+	    close(exec_pipe[0]);
 	close(pty);
 	if (pipe_option) {
 	    close_waitpipe(1);
 	}
 	child(line, path, child_argv);
     } else {
+	profileEnd(NULL);
+	/* the child must not inherit the writer thread or its lock */
+	startLogs(log_drop);
+	if (exec_pipe[0] >= 0) {
+	    close(exec_pipe[1]);
+	    profileBegin("exec", path);
+	}
 	if (pipe_option) {
 	    close_waitpipe(0);
 	}
@@ -872,6 +1171,17 @@ parent(int pid GCC_UNUSED, int pty)
 	close_waitpipe(1);
     }
 
+    if (exec_pipe[0] >= 0) {
+	char ch;
+
+	while (read(exec_pipe[0], &ch, (size_t) 1) < 0 && errno == EINTR) {
+	    ;
+	}
+	close(exec_pipe[0]);
+	exec_pipe[0] = -1;
+	profileEnd(NULL);
+    }
+
     for (;;) {
 	rc = waitForInput(0, pty);
 
@@ -880,6 +1190,17 @@ parent(int pid GCC_UNUSED, int pty)
 	    setWindowSize(0, pty);
 	}
 
+	if (sigusr1_queued) {
+	    sigusr1_queued = 0;
+	    writeStats();
+	    flushCapture(1);
+	}
+
+	if (sigusr2_queued) {
+	    sigusr2_queued = 0;
+	    saveFlight();
+	}
+
 	if (sigchld_queued && exitOnChild)
 	    break;
 
@@ -891,21 +1212,35 @@ parent(int pid GCC_UNUSED, int pty)
 		i = (int) read(pty, buf, (size_t) BUFFER_SIZE);
 		if ((i == 0) || ((i < 0) && (errno != EAGAIN)))
 		    break;
-		if (i > 0)
+		if (i > 0) {
+		    outputState->stats.reads++;
+		    outputState->read_usecs = monotonicUsecs();
+		    if (capturing)
+			captureChunk(CAP_PROGRAM, buf, (size_t) i);
 		    copyOut(outputState, 0, buf, (unsigned) i);
+		}
 	    }
 	    if (rc & IO_CanRead) {
 		i = (int) read(0, buf, (size_t) BUFFER_SIZE);
 		if ((i == 0) || ((i < 0) && (errno != EAGAIN)))
 		    break;
-		if (i > 0)
+		if (i > 0) {
+		    inputState->stats.reads++;
+		    inputState->read_usecs = monotonicUsecs();
+		    if (capturing)
+			captureChunk(CAP_KEYBOARD, buf, (size_t) i);
 		    copyIn(inputState, pty, buf, i);
+		}
 	    }
+	    flushCapture(0);
 	}
     }
+    closeCapture();
 
     restoreTermios();
     cleanup_io(pty);
+    if (stats_file != NULL)
+	writeStats();
 }
 
 #ifdef NO_LEAKS
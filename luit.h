@@ -49,6 +49,7 @@ THE SOFTWARE.
 #endif
 
 extern const char *locale_alias;
+extern const char *table_cache;
 extern int fill_fontenc;
 extern int ignore_locale;
 extern int iso2022;
@@ -56,6 +57,7 @@ extern int sevenbit;
 extern int ilog;
 extern int olog;
 extern int verbose;
+extern int warnings;
 
 #define MAXCOLS 78
 
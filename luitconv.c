@@ -26,12 +26,24 @@
 #include <iso2022.h>
 
 #include <sys.h>
+#include <version.h>
 
 #ifdef HAVE_LANGINFO_CODESET
 #include <locale.h>
 #include <langinfo.h>
 #endif
 
+#if defined(HAVE_MMAP) && defined(HAVE_SYS_MMAN_H)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define USE_TABLE_CACHE 1
+#if defined(__GLIBC__) && !defined(_LIBICONV_VERSION)
+#include <gnu/libc-version.h>
+#endif
+#endif
+
 /*
  * This uses a similar approach to vile's support for wide/narrow locales.
  *
@@ -46,6 +58,7 @@
 #define NO_ICONV  (iconv_t)(-1)
 
 static LuitConv *all_conversions;
+static LuitConv *last_conversion;	/* most recent luitMapCodeValue() */
 
 /******************************************************************************/
 static int
@@ -194,6 +207,18 @@ ConvToUTF8(UCHAR * target, UINT source, size_t limit)
 #undef CH
 }
 
+/*
+ * Store a code's Unicode value in the table, along with its UTF-8 equivalent.
+ * The text is kept in a fixed-size slot in the table entry, rather than
+ * allocating a string for each code.
+ */
+static void
+setMappingData(MappingData * target, UINT ucs)
+{
+    target->ucs = ucs;
+    target->size = (UCHAR) ConvToUTF8(target->text, ucs, sizeof(target->text));
+}
+
 /******************************************************************************/
 
 static LuitConv *
@@ -201,14 +226,38 @@ newLuitConv(size_t elts)
 {
     LuitConv *result = TypeCalloc(LuitConv);
     if (result != 0) {
+	size_t forward = elts * sizeof(MappingData);
+	size_t reverse = elts * sizeof(ReverseData);
+
 	TRACE(("newLuitConv(%u)\n", (unsigned) elts));
+	/*
+	 * The forward and reverse tables have fixed-size entries, so they are
+	 * allocated as a single chunk, which is freed as a unit.
+	 */
+	result->table_arena = calloc((size_t) 1, forward + reverse);
+	if (result->table_arena == 0) {
+	    free(result);
+	    return 0;
+	}
 	result->table_size = elts;
-	result->table_utf8 = TypeCallocN(MappingData, elts);
-	result->rev_index = TypeCallocN(ReverseData, elts);
+	result->table_utf8 = (MappingData *) result->table_arena;
+	result->rev_index = (ReverseData *) (void *) ((char *)
+						      result->table_arena
+						      + forward);
     }
     return result;
 }
 
+/*
+ * The tables are read-only once built, and may be shared.  These give the
+ * table-builders write-access to a newly allocated arena.
+ */
+#define WritableUTF8(data) \
+	((MappingData *) (data)->table_arena)
+#define WritableIndex(data) \
+	((ReverseData *) (void *) ((char *) (data)->table_arena \
+				   + (data)->table_size * sizeof(MappingData)))
+
 /*
  * Try to open a conversion from UTF-8 to the given encoding name.  This is
  * iconv(), and different implementations expect different syntax for the
@@ -465,6 +514,8 @@ static void
 initialize8bitTable(LuitConv * data)
 {
     unsigned n;
+    MappingData *table_utf8 = WritableUTF8(data);
+    ReverseData *rev_index = WritableIndex(data);
 
     TRACE(("initialize8bitTable\n"));
 
@@ -486,25 +537,19 @@ initialize8bitTable(LuitConv * data)
 	if (converted == (size_t) (-1)) {
 	    TRACE(("convert err %d\n", n));
 	} else {
-	    output[sizeof(output) - out_bytes] = 0;
-	    data->table_utf8[n].size = sizeof(output) - out_bytes;
-	    data->table_utf8[n].text = malloc(data->table_utf8[n].size);
-	    memcpy(data->table_utf8[n].text,
-		   output,
-		   data->table_utf8[n].size);
-	    if (ConvToUTF32((UINT *) 0,
-			    data->table_utf8[n].text,
-			    data->table_utf8[n].size)) {
-		ConvToUTF32(&(data->table_utf8[n].ucs),
-			    data->table_utf8[n].text,
-			    data->table_utf8[n].size);
+	    size_t have = sizeof(output) - out_bytes;
+	    UINT ucs;
+
+	    if (ConvToUTF32((UINT *) 0, output, have)) {
+		ConvToUTF32(&ucs, output, have);
+		setMappingData(&(table_utf8[n]), ucs);
 	    }
 	    trace_convert(data, (size_t) n, 0);
 
-	    data->rev_index[data->len_index].ucs = data->table_utf8[n].ucs;
-	    data->rev_index[data->len_index].ch = n;
+	    rev_index[data->len_index].ucs = table_utf8[n].ucs;
+	    rev_index[data->len_index].ch = n;
 
-	    if (n != data->table_utf8[n].ucs) {
+	    if (n != table_utf8[n].ucs) {
 		data->len_index++;
 	    }
 	}
@@ -611,19 +656,17 @@ initialize16bitTable(const char *charset, LuitConv ** datap, unsigned gmax)
 	    } else {
 		data = datap[gs];
 	    }
-	    if (data == 0) {
+	    if (data == 0 || my_code >= data->table_size) {
 		TRACE(("skip %d:%#x\n", gs, my_code));
 		continue;
 	    }
-	    data->table_utf8[my_code].size = strlen((char *) input);
-	    data->table_utf8[my_code].text = strmalloc((char *) input);
-	    data->table_utf8[my_code].ucs = n;
+	    setMappingData(&(WritableUTF8(data)[my_code]), n);
 
 	    trace_convert(data, (size_t) my_code, gs);
 
-	    data->rev_index[data->len_index].ucs = n;
-	    data->rev_index[data->len_index].ch = my_code;
-	    if (n != data->table_utf8[n].ucs) {
+	    if (n != my_code && data->len_index < data->table_size) {
+		WritableIndex(data)[data->len_index].ucs = n;
+		WritableIndex(data)[data->len_index].ch = my_code;
 		data->len_index++;
 	    }
 	}
@@ -715,9 +758,9 @@ initializeBuiltInTable(LuitConv * data,
 		       const BuiltInCharsetRec * builtIn,
 		       int enc_file)
 {
-    UCHAR buffer[20];
     size_t n;
-    size_t need;
+    MappingData *table_utf8 = WritableUTF8(data);
+    ReverseData *rev_index = WritableIndex(data);
 
     TRACE(("initializing %s '%s'\n",
 	   enc_file ? "external" : "built-in",
@@ -726,32 +769,23 @@ initializeBuiltInTable(LuitConv * data,
 
     data->len_index = 0;
 
-    for (n = 0; n < builtIn->length; ++n) {
-	data->table_utf8[n].ucs = (unsigned) n;
+    for (n = 0; n < builtIn->length && n < data->table_size; ++n) {
+	table_utf8[n].ucs = (unsigned) n;
     }
 
     for (n = 0; n < builtIn->length; ++n) {
 	if (builtIn->table[n].source < data->table_size) {
 	    size_t j = builtIn->table[n].source;
 
-	    data->table_utf8[j].ucs = builtIn->table[n].target;
-
-	    if ((need = (size_t) ConvToUTF8(buffer,
-					    data->table_utf8[j].ucs,
-					    sizeof(buffer) - 1)) != 0) {
-		data->table_utf8[j].text = malloc(need + 1);
-		data->table_utf8[j].size = need;
-		memcpy(data->table_utf8[j].text, buffer, need);
-	    }
+	    setMappingData(&(table_utf8[j]), builtIn->table[n].target);
 
 	    trace_convert(data, j, 0);
 
-	    data->rev_index[data->len_index].ucs = data->table_utf8[j].ucs;
-	    data->rev_index[data->len_index].ch = (unsigned) j;
-	    if (n != data->table_utf8[n].ucs) {
+	    if (j != table_utf8[j].ucs) {
+		rev_index[data->len_index].ucs = table_utf8[j].ucs;
+		rev_index[data->len_index].ch = (unsigned) j;
 		data->len_index++;
 	    }
-
 	}
     }
 }
@@ -821,7 +855,7 @@ luitGetFontEnc(const char *name, UM_MODE mode)
 	mq->len = (unsigned) lc->table_size;
 	mq->map = map;
 
-	for (n = 0; n < (int) lc->table_size; ++n) {
+	for (n = 0; n < (int) lc->len_index; ++n) {
 	    unsigned ch = lc->rev_index[n].ch;
 	    if (ch < mq->len) {
 		map[ch] = (UCode) lc->rev_index[n].ucs;
@@ -922,7 +956,24 @@ initLuitConv(const char *encoding_name,
     }
 
     TRACE(("initLuitConv(%s) %u\n", encoding_name, (unsigned) length));
-    if ((latest = newLuitConv(length)) != 0) {
+    PROBE2(table_build_start, encoding_name, length);
+    profileBegin("initLuitConv", encoding_name);
+    if (builtIn != 0 && builtIn->utf8 != 0 && length == MAX8) {
+	/*
+	 * make-tables generated the final forward/reverse tables for this
+	 * charset, so we can use them without copying.
+	 */
+	if ((latest = TypeCalloc(LuitConv)) != 0) {
+	    latest->encoding_name = strmalloc(encoding_name);
+	    latest->iconv_desc = my_desc;
+	    latest->table_size = MAX8;
+	    latest->table_utf8 = builtIn->utf8;
+	    latest->rev_index = builtIn->rev;
+	    latest->len_index = builtIn->rev_length;
+	    finishIconvTable(latest);
+	    result = &(latest->mapping);
+	}
+    } else if ((latest = newLuitConv(length)) != 0) {
 	latest->encoding_name = strmalloc(encoding_name);
 	latest->iconv_desc = my_desc;
 	if (builtIn != 0) {
@@ -937,12 +988,14 @@ initLuitConv(const char *encoding_name,
 
 	/* sort the reverse-index, to allow using bsearch */
 	if (result != 0) {
-	    qsort(latest->rev_index,
+	    qsort(WritableIndex(latest),
 		  latest->len_index,
 		  sizeof(latest->rev_index[0]),
 		  cmp_rindex);
 	}
     }
+    PROBE2(table_build_done, encoding_name, length);
+    profileEnd((length == MAX16) ? "16-bit" : "8-bit");
     return result;
 }
 
@@ -1130,6 +1183,345 @@ lookupIconv(const char **encoding_name, char **aliased, US_SIZE size)
     return result;
 }
 
+#ifdef USE_TABLE_CACHE
+/*
+ * A table file holds the forward and reverse tables of one LuitConv, exactly
+ * as they are laid out in memory.  Both tables use fixed-size entries with no
+ * pointers, so the file can be mapped read-only and shared by every luit
+ * process using the same encoding.
+ */
+#define TABLE_MAGIC	"luit-tbl"
+#define TABLE_VERSION	2
+#define TABLE_SUFFIX	".tbl"
+#define BYTE_ORDER_MARK	0x01020304
+
+typedef struct {
+    char magic[8];
+    unsigned version;
+    unsigned byte_order;	/* detect files copied from other hosts */
+    unsigned entry_sizes;	/* sizes of MappingData and ReverseData */
+    unsigned lookup_key;	/* lookup-order and mode used to build it */
+    unsigned source_key;	/* versions of the sources it was built from */
+    unsigned table_size;	/* length of table_utf8[] */
+    unsigned len_index;		/* length of rev_index[] */
+} TableFileHeader;
+
+#define ENTRY_SIZES ((unsigned) ((sizeof(MappingData) << 8) | sizeof(ReverseData)))
+
+/*
+ * The table's content depends upon which lookup method succeeds first, so
+ * record the order of the methods allowed by the mode.
+ */
+static unsigned
+tableLookupKey(UM_MODE mode, US_SIZE size)
+{
+    unsigned result = (unsigned) size;
+    int n;
+
+    for (n = 0; lookup_order[n] != umNONE; ++n) {
+	result = (result << 4) | (unsigned) (lookup_order[n] & mode);
+    }
+    return result;
+}
+
+static unsigned
+hashText(unsigned hash, const char *text)
+{
+    if (text != 0) {
+	while (*text != '\0')
+	    hash = (hash * 33) ^ UChar(*text++);
+    }
+    return (hash * 33) ^ 0xFF;
+}
+
+static unsigned
+hashFile(unsigned hash, const char *path)
+{
+    struct stat sb;
+
+    if (path != 0 && stat(path, &sb) == 0) {
+	hash = (hash * 33) ^ (unsigned) sb.st_mtime;
+	hash = (hash * 33) ^ (unsigned) sb.st_size;
+    }
+    return hashText(hash, path);
+}
+
+static const char *
+iconvVersion(void)
+{
+#if defined(_LIBICONV_VERSION)
+    static char result[20];
+
+    sprintf(result, "libiconv %d.%d",
+	    _libiconv_version >> 8,
+	    _libiconv_version & 0xFF);
+    return result;
+#elif defined(__GLIBC__)
+    return gnu_get_libc_version();
+#else
+    return "";
+#endif
+}
+
+/*
+ * Identify the sources which could supply the table, so that a table file is
+ * rebuilt when one of them changes:  luit itself, for the built-in tables,
+ * the iconv library, and the ".enc" file named in encodings.dir.
+ */
+static unsigned
+tableSourceKey(const char *encoding_name, UM_MODE mode)
+{
+    unsigned result = hashText(5381, LUIT_VERSION);
+
+    if (mode & umICONV)
+	result = hashText(result, iconvVersion());
+    if (mode & umFONTENC)
+	result = hashFile(result, fontencPath(encoding_name));
+    return result;
+}
+
+/*
+ * Construct the pathname for an encoding's table file.  Characters which
+ * lcStrCmp() ignores are dropped, so that equivalent names share a file.
+ */
+static char *
+tableFileName(const char *encoding_name, US_SIZE size)
+{
+    char *result;
+    size_t need = strlen(table_cache) + (3 * strlen(encoding_name)) + 20;
+
+    if ((result = malloc(need)) != 0) {
+	char *s = result;
+
+	s += strlen(strcpy(s, table_cache));
+	*s++ = '/';
+	while (*encoding_name != '\0') {
+	    int ch = UChar(*encoding_name++);
+
+	    if (isspace(ch) || ch == '-' || ch == '_' || ch == '/') {
+		continue;
+	    } else if (isalnum(ch) || ch == '.') {
+		*s++ = (char) tolower(ch);
+	    } else {
+		sprintf(s, "+%02X", ch);
+		s += 3;
+	    }
+	}
+	sprintf(s, "-%u%s", (unsigned) size, TABLE_SUFFIX);
+    }
+    return result;
+}
+
+/*
+ * Check every entry of a mapped file, since putPair() copies the UTF-8 text
+ * without checking it, and the reverse index selects entries of the forward
+ * table.
+ */
+static int
+validTables(const MappingData * forward, size_t size,
+	    const ReverseData * reverse, size_t length)
+{
+    size_t n;
+
+    for (n = 0; n < size; ++n) {
+	const MappingData *m = forward + n;
+
+	if (m->size > MAX_UTF8
+	    || (m->size != ConvToUTF8(0, m->ucs, sizeof(m->text))
+		&& (m->size != 0 || m->ucs != 0)))
+	    return 0;
+    }
+    for (n = 0; n < length; ++n) {
+	if (reverse[n].ch >= size)
+	    return 0;
+    }
+    return 1;
+}
+
+/*
+ * Map a table file, returning a LuitConv whose tables point into the shared,
+ * read-only mapping.
+ */
+static LuitConv *
+mapTableFile(const char *path, unsigned lookup_key, unsigned source_key)
+{
+    LuitConv *result = 0;
+    int fd;
+
+    if ((fd = open(path, O_RDONLY)) >= 0) {
+	struct stat sb;
+	void *addr = MAP_FAILED;
+	const TableFileHeader *hdr;
+
+	if (isTrustedFile(fd)
+	    && fstat(fd, &sb) == 0
+	    && (size_t) sb.st_size >= sizeof(TableFileHeader)
+	    && (addr = mmap(NULL,
+			    (size_t) sb.st_size,
+			    PROT_READ,
+			    MAP_SHARED,
+			    fd,
+			    (off_t) 0)) != MAP_FAILED) {
+	    size_t forward;
+	    size_t reverse;
+
+	    hdr = (const TableFileHeader *) addr;
+	    forward = (size_t) hdr->table_size * sizeof(MappingData);
+	    reverse = (size_t) hdr->len_index * sizeof(ReverseData);
+	    if (memcmp(hdr->magic, TABLE_MAGIC, sizeof(hdr->magic))
+		|| hdr->version != TABLE_VERSION
+		|| hdr->byte_order != BYTE_ORDER_MARK
+		|| hdr->entry_sizes != ENTRY_SIZES
+		|| hdr->lookup_key != lookup_key
+		|| hdr->source_key != source_key
+		|| hdr->len_index > hdr->table_size
+		|| (size_t) sb.st_size != sizeof(*hdr) + forward + reverse
+		|| !validTables((const MappingData *) (const void *) (hdr + 1),
+				(size_t) hdr->table_size,
+				(const ReverseData *) (const void *)
+				((const char *) (hdr + 1) + forward),
+				(size_t) hdr->len_index)
+		|| (result = TypeCalloc(LuitConv)) == 0) {
+		TRACE(("...ignoring table file %s\n", path));
+		munmap(addr, (size_t) sb.st_size);
+	    } else {
+		char *data = (char *) addr + sizeof(*hdr);
+
+		result->table_arena = addr;
+		result->table_mapped = (size_t) sb.st_size;
+		result->table_size = hdr->table_size;
+		result->len_index = hdr->len_index;
+		result->table_utf8 = (MappingData *) (void *) data;
+		result->rev_index = (ReverseData *) (void *) (data + forward);
+		TRACE(("...mapped table file %s\n", path));
+	    }
+	}
+	close(fd);
+    }
+    return result;
+}
+
+static int
+writeAll(int fd, const void *buffer, size_t length)
+{
+    const char *s = (const char *) buffer;
+
+    while (length != 0) {
+	ssize_t did = write(fd, s, length);
+	if (did <= 0)
+	    return 0;
+	s += did;
+	length -= (size_t) did;
+    }
+    return 1;
+}
+
+/*
+ * Write the tables to a temporary file in the cache directory, and rename it
+ * into place, so that concurrent processes never see a partial file.
+ */
+static int
+saveTableFile(const char *path, LuitConv * data,
+	      unsigned lookup_key, unsigned source_key)
+{
+    int result = 0;
+    char *temp;
+
+    if ((temp = malloc(strlen(path) + 8)) != 0) {
+	int fd;
+
+	sprintf(temp, "%s.XXXXXX", path);
+	if ((fd = mkstemp(temp)) >= 0) {
+	    TableFileHeader hdr;
+
+	    memset(&hdr, 0, sizeof(hdr));
+	    memcpy(hdr.magic, TABLE_MAGIC, sizeof(hdr.magic));
+	    hdr.version = TABLE_VERSION;
+	    hdr.byte_order = BYTE_ORDER_MARK;
+	    hdr.entry_sizes = ENTRY_SIZES;
+	    hdr.lookup_key = lookup_key;
+	    hdr.source_key = source_key;
+	    hdr.table_size = (unsigned) data->table_size;
+	    hdr.len_index = (unsigned) data->len_index;
+
+	    result = (writeAll(fd, &hdr, sizeof(hdr))
+		      && writeAll(fd, data->table_utf8,
+				  data->table_size * sizeof(MappingData))
+		      && writeAll(fd, data->rev_index,
+				  data->len_index * sizeof(ReverseData)));
+	    (void) fchmod(fd, 0644);
+	    if (close(fd) != 0 || !result || rename(temp, path) != 0) {
+		result = 0;
+		unlink(temp);
+	    }
+	}
+	free(temp);
+    }
+    TRACE(("saveTableFile(%s) %s\n", path, result ? "OK" : "FAIL"));
+    return result;
+}
+
+/*
+ * Look for a table file for the given encoding, generating it from the
+ * freshly-built tables if needed.
+ */
+static FontMapPtr
+lookupTableFile(const char *encoding_name, UM_MODE mode, US_SIZE size)
+{
+    FontMapPtr result = 0;
+    char *path;
+
+    if (isTrustedCache()
+	&& (path = tableFileName(encoding_name, size)) != 0) {
+	LuitConv *latest;
+	unsigned key = tableLookupKey(mode, size);
+	unsigned source = tableSourceKey(encoding_name, mode);
+
+	if ((latest = mapTableFile(path, key, source)) != 0) {
+	    latest->encoding_name = strmalloc(encoding_name);
+	    latest->iconv_desc = NO_ICONV;
+	    finishIconvTable(latest);
+	    result = &(latest->mapping);
+	}
+	free(path);
+    }
+    return result;
+}
+
+/*
+ * Replace the private tables of a newly-built LuitConv by a shared mapping
+ * of the table file written from them.
+ */
+static void
+shareTableFile(const char *encoding_name, UM_MODE mode, US_SIZE size,
+	       FontMapPtr mapping)
+{
+    LuitConv *latest;
+    LuitConv *shared;
+    char *path;
+
+    if ((latest = luitLookupEncoding(mapping)) != 0
+	&& latest->table_arena != 0
+	&& !latest->table_mapped
+	&& isTrustedCache()
+	&& (path = tableFileName(encoding_name, size)) != 0) {
+	unsigned key = tableLookupKey(mode, size);
+	unsigned source = tableSourceKey(encoding_name, mode);
+
+	if (saveTableFile(path, latest, key, source)
+	    && (shared = mapTableFile(path, key, source)) != 0) {
+	    free(latest->table_arena);
+	    latest->table_arena = shared->table_arena;
+	    latest->table_mapped = shared->table_mapped;
+	    latest->table_utf8 = shared->table_utf8;
+	    latest->rev_index = shared->rev_index;
+	    free(shared);
+	}
+	free(path);
+    }
+}
+#endif /* USE_TABLE_CACHE */
+
 FontMapPtr
 luitLookupMapping(const char *encoding_name, UM_MODE mode, US_SIZE size)
 {
@@ -1137,11 +1529,23 @@ luitLookupMapping(const char *encoding_name, UM_MODE mode, US_SIZE size)
     FontEncPtr fontenc;
     const BuiltInCharsetRec *builtIn;
     char *aliased = 0;
+    const char *how = "none";
+#ifdef USE_TABLE_CACHE
+    const char *original = encoding_name;
+#endif
 
     TRACE(("luitLookupMapping '%s' mode %u size %u\n", encoding_name, mode, size));
+    profileBegin("luitLookupMapping", encoding_name);
 
     if ((result = getFontMapByName(encoding_name)) != 0) {
 	TRACE(("...found in cache\n"));
+	how = "memory";
+#ifdef USE_TABLE_CACHE
+    } else if (table_cache != 0
+	       && (result = lookupTableFile(encoding_name, mode, size)) != 0) {
+	TRACE(("...found table file\n"));
+	how = "cache";
+#endif
     } else {
 	int n;
 
@@ -1153,6 +1557,7 @@ luitLookupMapping(const char *encoding_name, UM_MODE mode, US_SIZE size)
 		result = lookupIconv(&encoding_name, &aliased, size);
 		if (result != 0) {
 		    TRACE(("...lookupIconv succeeded\n"));
+		    how = "iconv";
 		}
 		break;
 	    case umFONTENC:
@@ -1160,6 +1565,7 @@ luitLookupMapping(const char *encoding_name, UM_MODE mode, US_SIZE size)
 		    result = convertFontEnc(fontenc);
 		    if (result != 0) {
 			TRACE(("...convertFontEnc succeeded\n"));
+			how = "fontenc";
 		    }
 		}
 		break;
@@ -1171,6 +1577,7 @@ luitLookupMapping(const char *encoding_name, UM_MODE mode, US_SIZE size)
 					  builtIn,
 					  0,
 					  us8BIT);
+		    how = "builtin";
 		}
 		break;
 	    case umPOSIX:
@@ -1193,6 +1600,7 @@ luitLookupMapping(const char *encoding_name, UM_MODE mode, US_SIZE size)
 					  &posix,
 					  0,
 					  us8BIT);
+		    how = "posix";
 		}
 		break;
 	    default:
@@ -1201,12 +1609,18 @@ luitLookupMapping(const char *encoding_name, UM_MODE mode, US_SIZE size)
 	    if (result != 0)
 		break;
 	}
+#ifdef USE_TABLE_CACHE
+	if (result != 0 && table_cache != 0) {
+	    shareTableFile(original, mode, size, result);
+	}
+#endif
     }
     if (aliased) {
 	free(aliased);
     }
 
     TRACE(("...luitLookupMapping ->%p\n", (void *) result));
+    profileEnd(result ? how : "none");
     return result;
 }
 
@@ -1234,21 +1648,23 @@ luitMapCodeValue(unsigned code, FontMapPtr fontmap_ptr)
     LuitConv *search;
 
     result = code;
-    for (search = all_conversions; search != 0; search = search->next) {
-	if (&(search->mapping) == fontmap_ptr) {
-	    if (code < search->table_size) {
-		result = search->table_utf8[code].ucs;
-		if (result == 0 && code != 0)
-		    result = code;
+    /* text runs map many codes through the same table */
+    search = last_conversion;
+    if (search == 0 || &(search->mapping) != fontmap_ptr) {
+	for (search = all_conversions; search != 0; search = search->next) {
+	    if (&(search->mapping) == fontmap_ptr) {
+		last_conversion = search;
+		break;
 	    }
-	    break;
 	}
     }
+    if (search != 0 && code < search->table_size) {
+	result = search->table_utf8[code].ucs;
+	if (result == 0 && code != 0)
+	    result = code;
+    }
 
-    TRACE2(("luitMapCodeValue 0x%04X '%c' 0x%04X\n",
-	    code,
-	    isprint(code) ? code : ' ',
-	    result));
+    TRACE2_EVENT(evMapCode, code, result, 0);
     return result;
 }
 
@@ -1305,6 +1721,85 @@ reportBuiltinCharsets(void)
     return EXIT_SUCCESS;
 }
 
+static int
+cmp_rindex2(const void *a, const void *b)
+{
+    const ReverseData *p = (const ReverseData *) a;
+    const ReverseData *q = (const ReverseData *) b;
+    int result = cmp_rindex(a, b);
+    if (result == 0)
+	result = (int) (p)->ch - (int) (q)->ch;
+    return result;
+}
+
+/*
+ * Verify that the tables which make-tables generated for each built-in
+ * encoding match the ones which initializeBuiltInTable() would build from
+ * the same data.
+ */
+int
+checkBuiltinCharsets(void)
+{
+    int rc = EXIT_SUCCESS;
+    size_t j, k;
+
+    for (j = 0; builtin_encodings[j].name != 0; ++j) {
+	BuiltInCharsetRec copy = builtin_encodings[j];
+	LuitConv *data;
+	int errors = 0;
+
+	if (copy.utf8 == 0) {
+	    printf("%s: no generated tables\n", copy.name);
+	    rc = EXIT_FAILURE;
+	    continue;
+	}
+	if ((data = newLuitConv((size_t) MAX8)) == 0)
+	    FatalError("cannot allocate table\n");
+
+	copy.utf8 = 0;
+	initializeBuiltInTable(data, &copy, 0);
+	qsort(WritableIndex(data), data->len_index,
+	      sizeof(data->rev_index[0]), cmp_rindex2);
+
+	for (k = 0; k < MAX8; ++k) {
+	    const MappingData *p = &(builtin_encodings[j].utf8[k]);
+	    const MappingData *q = &(data->table_utf8[k]);
+	    if (p->ucs != q->ucs
+		|| p->size != q->size
+		|| memcmp(p->text, q->text, (size_t) p->size)) {
+		printf("%s: forward %02X: generated %04X, built %04X\n",
+		       copy.name, (unsigned) k, p->ucs, q->ucs);
+		++errors;
+	    }
+	}
+	if (copy.rev_length != data->len_index) {
+	    printf("%s: reverse length: generated %u, built %u\n",
+		   copy.name,
+		   (unsigned) copy.rev_length,
+		   (unsigned) data->len_index);
+	    ++errors;
+	} else {
+	    for (k = 0; k < copy.rev_length; ++k) {
+		if (copy.rev[k].ucs != data->rev_index[k].ucs
+		    || copy.rev[k].ch != data->rev_index[k].ch) {
+		    printf("%s: reverse %u: generated %04X:%02X, built %04X:%02X\n",
+			   copy.name, (unsigned) k,
+			   copy.rev[k].ucs, copy.rev[k].ch,
+			   data->rev_index[k].ucs, data->rev_index[k].ch);
+		    ++errors;
+		}
+	    }
+	}
+	printf("%s: %s\n", copy.name, errors ? "FAIL" : "OK");
+	if (errors)
+	    rc = EXIT_FAILURE;
+
+	free(data->table_arena);
+	free(data);
+    }
+    return rc;
+}
+
 /*
  * Obtain a list of supported locales, and for each obtain the corresponding
  * charset.
@@ -1483,7 +1978,6 @@ void
 luitDestroyReverse(FontMapReversePtr reverse)
 {
     LuitConv *p, *q;
-    size_t n;
 
     for (p = all_conversions, q = 0; p != 0; q = p, p = p->next) {
 	if (&(p->reverse) == reverse) {
@@ -1492,19 +1986,19 @@ luitDestroyReverse(FontMapReversePtr reverse)
 	    if (p->iconv_desc != NO_ICONV)
 		iconv_close(p->iconv_desc);
 
-	    for (n = 0; n < p->table_size; ++n) {
-		if (p->table_utf8[n].text) {
-		    free(p->table_utf8[n].text);
-		}
-	    }
-
 	    /* delink and destroy */
+	    if (p == last_conversion)
+		last_conversion = 0;
 	    if (q != 0)
 		q->next = p->next;
 	    else
 		all_conversions = p->next;
-	    free(p->table_utf8);
-	    free(p->rev_index);
+#ifdef USE_TABLE_CACHE
+	    if (p->table_mapped)
+		munmap(p->table_arena, p->table_mapped);
+	    else
+#endif
+		free(p->table_arena);
 	    free(p);
 	    break;
 	}
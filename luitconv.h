@@ -71,10 +71,12 @@ typedef struct _FontEnc {
     int first_col;		/* first column in each row */
 } FontEncRec, *FontEncPtr;
 
+#define MAX_UTF8 4		/* enough for any Unicode value */
+
 typedef struct {
-    size_t size;		/* length of text[] */
-    char *text;			/* value, in UTF-8 */
     unsigned ucs;		/* corresponding Unicode value */
+    unsigned char size;		/* length of text[] */
+    unsigned char text[MAX_UTF8];	/* value, in UTF-8 */
 } MappingData;
 
 typedef struct {
@@ -86,9 +88,11 @@ typedef struct _LuitConv {
     struct _LuitConv *next;
     char *encoding_name;
     iconv_t iconv_desc;
-    /* internal tables for input/output */
-    MappingData *table_utf8;	/* UTF-8 equivalents of 8-bit codes */
-    ReverseData *rev_index;	/* reverse-index */
+    /* internal tables for input/output, allocated together */
+    void *table_arena;		/* the single allocation for both tables */
+    size_t table_mapped;	/* nonzero if arena is mmap'd from a file */
+    const MappingData *table_utf8;	/* UTF-8 equivalents of 8-bit codes */
+    const ReverseData *rev_index;	/* reverse-index */
     size_t len_index;		/* index length */
     size_t table_size;		/* length of table_utf8[] and rev_index[] */
     /* data expected by caller */
@@ -105,9 +109,14 @@ typedef struct _BuiltInCharset {
     const char *name;		/* table name, for lookups */
     const BuiltInMapping *table;
     size_t length;		/* length of table[] */
+    const MappingData *utf8;	/* precomputed forward table, if any */
+    const ReverseData *rev;	/* precomputed (sorted) reverse-index */
+    size_t rev_length;		/* length of rev[] */
 } BuiltInCharsetRec;
 
-extern UM_MODE lookup_order[];
+#define MAX_LOOKUP 5		/* each lookup mode, and umNONE */
+
+extern UM_MODE lookup_order[MAX_LOOKUP];
 
 extern FontEncPtr luitGetFontEnc(const char *, UM_MODE);
 extern FontMapPtr luitLookupMapping(const char *, UM_MODE, US_SIZE);
@@ -169,6 +178,8 @@ typedef struct _FontEncSimpleName {
 #define colOf(code) ((code) & 0xff)
 
 extern FontEncPtr lookupOneFontenc(const char *);
+extern const char *fontencPath(const char *);
+extern int checkBuiltinCharsets(void);
 extern int reportBuiltinCharsets(void);
 extern int reportFontencCharsets(void);
 extern int reportIconvCharsets(void);
@@ -26,33 +26,62 @@ THE SOFTWARE.
 #include <luit.h>
 
 #include <parser.h>
+#include <charset.h>
 #include <sys.h>
 #include <trace.h>
 
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
 #ifdef HAVE_LANGINFO_CODESET
 #include <langinfo.h>
 #endif
 
+#if defined(HAVE_MMAP) && defined(HAVE_SYS_MMAN_H)
+#include <sys/mman.h>
+#define USE_MMAP 1
+#endif
+
 static char keyword[MAX_KEYWORD_LENGTH];
 
+/*
+ * The locale.alias file is tokenized in memory, mapped if possible, rather
+ * than a character at a time with stdio.
+ */
+typedef struct {
+    char *data;			/* the file's contents */
+    size_t size;		/* ...and its length */
+    int mapped;			/* true if data[] is mmap'd */
+    const char *next;		/* the tokenizer's position in data[] */
+} AliasText;
+
+static int
+nextChar(AliasText * f)
+{
+    return ((f->next < f->data + f->size)
+	    ? (unsigned char) *(f->next)++
+	    : -1);
+}
+
 static void
-skipEndOfLine(FILE *f, int c)
+skipEndOfLine(AliasText * f, int c)
 {
     if (c == 0)
-	c = getc(f);
+	c = nextChar(f);
 
     for (;;)
 	if (c <= 0 || c == '\n')
 	    return;
 	else
-	    c = getc(f);
+	    c = nextChar(f);
 }
 
 static int
-drainWhitespace(FILE *f, int c)
+drainWhitespace(AliasText * f, int c)
 {
     if (c == 0)
-	c = getc(f);
+	c = nextChar(f);
 
     while (c > 0 && (c == '#' || c == ' ' || c == '\t')) {
 	if (c == '#') {
@@ -60,31 +89,31 @@ drainWhitespace(FILE *f, int c)
 	    c = '\n';
 	    break;
 	}
-	c = getc(f);
+	c = nextChar(f);
     }
 
     return (c > 0) ? c : 0;
 }
 
 static int
-getString(FILE *f, int string_end, int *c_return)
+getString(AliasText * f, int string_end, int *c_return)
 {
     int i = 0;
     int c;
 
-    c = getc(f);
+    c = nextChar(f);
     while (c > 0) {
 	if (c == string_end)
 	    break;
 	if (c == '\\') {
-	    c = getc(f);
+	    c = nextChar(f);
 	    if (c == '\n')
 		continue;
 	}
 	keyword[i++] = (char) c;
 	if (i >= MAX_KEYWORD_LENGTH)
 	    return TOK_ERROR;
-	c = getc(f);
+	c = nextChar(f);
     }
 
     if (c <= 0)
@@ -95,7 +124,7 @@ getString(FILE *f, int string_end, int *c_return)
 }
 
 static int
-getToken(FILE *f, int c, int parse_assignments, int *c_return)
+getToken(AliasText * f, int c, int parse_assignments, int *c_return)
 {
     int i;
     c = drainWhitespace(f, c);
@@ -118,14 +147,14 @@ getToken(FILE *f, int c, int parse_assignments, int *c_return)
     i = 0;
     while (c > 0 && c != ' ' && c != '\t' && c != '\n') {
 	if (c == '\\') {
-	    c = getc(f);
+	    c = nextChar(f);
 	    if (c == '\n')
 		continue;
 	}
 	keyword[i++] = (char) c;
 	if (i >= MAX_KEYWORD_LENGTH)
 	    return TOK_ERROR;
-	c = getc(f);
+	c = nextChar(f);
 	if (parse_assignments && c == '=')
 	    break;
     }
@@ -137,7 +166,7 @@ getToken(FILE *f, int c, int parse_assignments, int *c_return)
 
 /* Can parse both the old and new formats for locale.alias */
 static int
-parseTwoTokenLine(FILE *f, char *first, char *second)
+parseTwoTokenLine(AliasText * f, char *first, char *second)
 {
     int rc = 0;
     int c = 0;
@@ -154,7 +183,7 @@ parseTwoTokenLine(FILE *f, char *first, char *second)
 	rc = -2;
     } else {
 	len = strlen(keyword);
-	if (keyword[len - 1] == ':')
+	if (len != 0 && keyword[len - 1] == ':')
 	    keyword[len - 1] = '\0';
 	strcpy(first, keyword);
 
@@ -174,6 +203,58 @@ parseTwoTokenLine(FILE *f, char *first, char *second)
     return rc;
 }
 
+static int
+openAliasText(AliasText * f, struct stat *sb)
+{
+    int result = 0;
+    int fd;
+
+    memset(f, 0, sizeof(*f));
+    if ((fd = open(locale_alias, O_RDONLY)) >= 0) {
+	if (fstat(fd, sb) == 0) {
+	    f->size = (size_t) sb->st_size;
+#ifdef USE_MMAP
+	    if (f->size != 0) {
+		void *addr = mmap(NULL, f->size, PROT_READ, MAP_PRIVATE, fd,
+				  (off_t) 0);
+		if (addr != MAP_FAILED) {
+		    f->data = (char *) addr;
+		    f->mapped = 1;
+		}
+	    }
+#endif
+	    if (f->data == 0 && (f->data = malloc(f->size + 1)) != 0) {
+		size_t have = 0;
+		ssize_t got;
+
+		while (have < f->size
+		       && (got = read(fd, f->data + have, f->size - have)) > 0) {
+		    have += (size_t) got;
+		}
+		f->size = have;
+	    }
+	    if (f->data != 0) {
+		f->next = f->data;
+		result = 1;
+	    }
+	}
+	close(fd);
+    }
+    return result;
+}
+
+static void
+closeAliasText(AliasText * f)
+{
+#ifdef USE_MMAP
+    if (f->mapped) {
+	munmap(f->data, f->size);
+    } else
+#endif
+	free(f->data);
+    f->data = 0;
+}
+
 /*
  * Check if the result from locale.alias has the encoding specified.
  */
@@ -192,41 +273,388 @@ has_encoding(const char *locale)
     return result;
 }
 
-char *
-resolveLocale(const char *locale)
+/*
+ * If a cache directory is given, keep an index of the locale.alias file
+ * there.  It is a sorted array of the locales, with the corresponding
+ * locale.alias value, and the name of the LocaleCharsetRec which matches
+ * that, so that a lookup does not have to read the whole alias file.  The
+ * index is rebuilt when the alias file's pathname, size or modification time
+ * changes.
+ */
+#define INDEX_MAGIC	"luit-ali"
+#define INDEX_VERSION	1
+#define INDEX_NAME	"locale-alias.idx"
+
+typedef struct {
+    char magic[8];
+    unsigned version;
+    unsigned count;		/* number of AliasIndex entries */
+    unsigned long mtime;	/* the alias file's modification time */
+    unsigned long size;		/* ...and its size */
+    unsigned path;		/* offset of the alias file's pathname */
+    unsigned length;		/* total length of the index */
+} AliasIndexHeader;
+
+typedef struct {
+    unsigned locale;		/* offset of the locale name */
+    unsigned resolved;		/* offset of its locale.alias value */
+    unsigned record;		/* offset of the LocaleCharsetRec name, or 0 */
+} AliasIndex;
+
+typedef struct {
+    char *first;
+    char *second;
+    const char *record;
+    size_t line;
+} AliasEntry;
+
+#define IndexText(index, offset) ((const char *) (index) + (offset))
+
+static int
+compare_aliases(const void *a, const void *b)
+{
+    const AliasEntry *p = (const AliasEntry *) a;
+    const AliasEntry *q = (const AliasEntry *) b;
+    int result = strcmp(p->first, q->first);
+    if (result == 0)
+	result = (p->line > q->line) ? 1 : ((p->line < q->line) ? -1 : 0);
+    return result;
+}
+
+static char *
+aliasIndexName(void)
+{
+    char *result = 0;
+
+    if (isTrustedCache()
+	&& (result = malloc(strlen(table_cache) + sizeof(INDEX_NAME) + 1)) != 0) {
+	sprintf(result, "%s/%s", table_cache, INDEX_NAME);
+    }
+    return result;
+}
+
+#ifdef USE_MMAP
+/*
+ * Check that the entries fit in the index, and that each one points into the
+ * string area which follows them.  The header check ensures that the last
+ * string is terminated.
+ */
+static int
+validAliasIndex(const AliasIndexHeader * hdr)
+{
+    const AliasIndex *entry = (const AliasIndex *) (const void *) (hdr + 1);
+    size_t first = sizeof(*hdr);
+    unsigned n;
+
+    if (hdr->count > (hdr->length - first) / sizeof(AliasIndex))
+	return 0;
+    first += hdr->count * sizeof(AliasIndex);
+    for (n = 0; n < hdr->count; ++n) {
+	if (entry[n].locale < first
+	    || entry[n].locale >= hdr->length
+	    || entry[n].resolved < first
+	    || entry[n].resolved >= hdr->length
+	    || (entry[n].record != 0
+		&& (entry[n].record < first
+		    || entry[n].record >= hdr->length)))
+	    return 0;
+    }
+    return 1;
+}
+#endif
+
+/*
+ * Map the index, if it exists and matches the alias file.
+ */
+static AliasIndexHeader *
+mapAliasIndex(const char *path, const struct stat *sb)
 {
-    FILE *f;
+    AliasIndexHeader *result = 0;
+#ifdef USE_MMAP
+    int fd;
+
+    if ((fd = open(path, O_RDONLY)) >= 0) {
+	struct stat ib;
+	void *addr;
+
+	if (isTrustedFile(fd)
+	    && fstat(fd, &ib) == 0
+	    && (size_t) ib.st_size > sizeof(AliasIndexHeader)
+	    && (addr = mmap(NULL, (size_t) ib.st_size, PROT_READ, MAP_SHARED,
+			    fd, (off_t) 0)) != MAP_FAILED) {
+	    AliasIndexHeader *hdr = (AliasIndexHeader *) addr;
+
+	    if (memcmp(hdr->magic, INDEX_MAGIC, sizeof(hdr->magic))
+		|| hdr->version != INDEX_VERSION
+		|| hdr->length != (unsigned) ib.st_size
+		|| hdr->mtime != (unsigned long) sb->st_mtime
+		|| hdr->size != (unsigned long) sb->st_size
+		|| hdr->path >= hdr->length
+		|| ((const char *) addr)[hdr->length - 1] != '\0'
+		|| !validAliasIndex(hdr)
+		|| strcmp(IndexText(hdr, hdr->path), locale_alias)) {
+		TRACE(("...ignoring stale %s\n", path));
+		munmap(addr, (size_t) ib.st_size);
+	    } else {
+		result = hdr;
+	    }
+	}
+	close(fd);
+    }
+#else
+    (void) path;
+    (void) sb;
+#endif
+    return result;
+}
+
+static void
+freeAliasIndex(AliasIndexHeader * index, int mapped)
+{
+    if (index != 0) {
+#ifdef USE_MMAP
+	if (mapped)
+	    munmap((void *) index, (size_t) index->length);
+	else
+#endif
+	    free(index);
+    }
+}
+
+/*
+ * Tokenize the whole alias file, and construct an index from it.  As in the
+ * linear search, the first line for a given locale wins, and a syntax error
+ * ends the file.
+ */
+static AliasIndexHeader *
+buildAliasIndex(AliasText * f, const struct stat *sb)
+{
+    AliasIndexHeader *result = 0;
+    AliasEntry *list = 0;
+    size_t used = 0;
+    size_t need = 0;
+    size_t text = strlen(locale_alias) + 1;
     char first[MAX_KEYWORD_LENGTH];
     char second[MAX_KEYWORD_LENGTH];
-    char *resolved = NULL;
-    int rc;
-    int found = 0;
+    size_t n, k;
+
+    while (parseTwoTokenLine(f, first, second) == 0) {
+	if (used + 1 >= need) {
+	    need = (need * 2) + 256;
+	    list = realloc(list, need * sizeof(*list));
+	    if (list == 0)
+		FatalError("cannot allocate locale.alias index\n");
+	}
+	list[used].first = strmalloc(first);
+	list[used].second = strmalloc(second);
+	list[used].line = used;
+	text += strlen(first) + strlen(second) + 2;
+	++used;
+    }
+    if (list != 0)
+	qsort(list, used, sizeof(*list), compare_aliases);
 
-    TRACE(("resolveLocale(%s)\n", locale));
+    for (n = k = 0; n < used; ++n) {
+	if (k != 0 && !strcmp(list[k - 1].first, list[n].first)) {
+	    free(list[n].first);
+	    free(list[n].second);
+	} else {
+	    list[k++] = list[n];
+	}
+    }
+    used = k;
 
-    TRACE(("...looking in %s\n", locale_alias));
-    f = fopen(locale_alias, "r");
+    need = sizeof(*result) + (used * sizeof(AliasIndex)) + text;
+    for (n = 0; n < used; ++n) {
+	const char *charset = strrchr(list[n].second, '.');
+
+	list[n].record = 0;
+	if (has_encoding(list[n].second)
+	    && strchr(++charset, '@') == 0
+	    && (list[n].record = localeCharsetName(charset)) != 0) {
+	    need += strlen(list[n].record) + 1;
+	}
+    }
+
+    if ((result = calloc((size_t) 1, need)) != 0) {
+	AliasIndex *entry = (AliasIndex *) (void *) (result + 1);
+	char *base = (char *) result;
+	size_t offset = sizeof(*result) + (used * sizeof(AliasIndex));
+
+#define AddText(value) \
+	    strcpy(base + offset, value), \
+	    offset += strlen(value) + 1
+
+	memcpy(result->magic, INDEX_MAGIC, sizeof(result->magic));
+	result->version = INDEX_VERSION;
+	result->count = (unsigned) used;
+	result->mtime = (unsigned long) sb->st_mtime;
+	result->size = (unsigned long) sb->st_size;
+	result->length = (unsigned) need;
+	result->path = (unsigned) offset;
+	AddText(locale_alias);
+
+	for (n = 0; n < used; ++n) {
+	    entry[n].locale = (unsigned) offset;
+	    AddText(list[n].first);
+	    entry[n].resolved = (unsigned) offset;
+	    AddText(list[n].second);
+	    if (list[n].record != 0) {
+		entry[n].record = (unsigned) offset;
+		AddText(list[n].record);
+	    }
+	}
+#undef AddText
+    }
+
+    for (n = 0; n < used; ++n) {
+	free(list[n].first);
+	free(list[n].second);
+    }
+    free(list);
+    return result;
+}
+
+/*
+ * Write the index to a temporary file, and rename it into place.
+ */
+static void
+saveAliasIndex(const char *path, AliasIndexHeader * index)
+{
+    char *temp;
+
+    if ((temp = malloc(strlen(path) + 8)) != 0) {
+	int fd;
+
+	sprintf(temp, "%s.XXXXXX", path);
+	if ((fd = mkstemp(temp)) >= 0) {
+	    const char *data = (const char *) index;
+	    size_t length = index->length;
+	    int ok = 1;
+
+	    while (length != 0) {
+		ssize_t did = write(fd, data, length);
+		if (did <= 0) {
+		    ok = 0;
+		    break;
+		}
+		data += did;
+		length -= (size_t) did;
+	    }
+	    (void) fchmod(fd, 0644);
+	    if (close(fd) != 0 || !ok || rename(temp, path) != 0) {
+		unlink(temp);
+	    }
+	}
+	free(temp);
+    }
+}
+
+static const AliasIndex *
+findAliasIndex(const AliasIndexHeader * index, const char *locale)
+{
+    const AliasIndex *entry = (const AliasIndex *) (const void *) (index + 1);
+    const AliasIndex *result = 0;
+    size_t lo = 0;
+    size_t hi = index->count;
+
+    while (lo < hi) {
+	size_t mid = (lo + hi) / 2;
+	int cmp = strcmp(locale, IndexText(index, entry[mid].locale));
+	if (cmp == 0) {
+	    result = &entry[mid];
+	    break;
+	} else if (cmp < 0) {
+	    hi = mid;
+	} else {
+	    lo = mid + 1;
+	}
+    }
+    return result;
+}
+
+/*
+ * Look for the locale in the alias file, using the index if we have one.
+ * Returns true if the file was found.
+ */
+static int
+lookupAlias(const char *locale, char **resolved, char **record)
+{
+    int result = 0;
+    AliasText f;
+    struct stat sb;
+    char *path;
+
+    if (stat(locale_alias, &sb) != 0) {
+	TRACE(("...cannot stat %s\n", locale_alias));
+    } else if ((path = aliasIndexName()) != 0) {
+	AliasIndexHeader *index;
+	int mapped = 1;
+
+	if ((index = mapAliasIndex(path, &sb)) == 0
+	    && openAliasText(&f, &sb)) {
+	    TRACE(("...building index %s\n", path));
+	    mapped = 0;
+	    if ((index = buildAliasIndex(&f, &sb)) != 0)
+		saveAliasIndex(path, index);
+	    closeAliasText(&f);
+	}
+	if (index != 0) {
+	    const AliasIndex *entry;
+
+	    if ((entry = findAliasIndex(index, locale)) != 0) {
+		*resolved = strmalloc(IndexText(index, entry->resolved));
+		if (entry->record)
+		    *record = strmalloc(IndexText(index, entry->record));
+	    }
+	    freeAliasIndex(index, mapped);
+	    result = 1;
+	}
+	free(path);
+    } else if (openAliasText(&f, &sb)) {
+	char first[MAX_KEYWORD_LENGTH];
+	char second[MAX_KEYWORD_LENGTH];
+	int rc;
 
-    if (f != NULL) {
 	do {
-	    rc = parseTwoTokenLine(f, first, second);
+	    rc = parseTwoTokenLine(&f, first, second);
 	    if (rc < -1)
 		break;
 	    if (!strcmp(first, locale)) {
-		resolved = strmalloc(second);
-		found = 1;
+		*resolved = strmalloc(second);
 		break;
 	    }
 	} while (rc >= 0);
+	closeAliasText(&f);
+	result = 1;
+    }
+    return result;
+}
 
-	if (!found) {
-	    if (resolved == NULL) {
-		TRACE(("...not found in %s\n", locale_alias));
-		resolved = strmalloc(locale);
-	    }
-	}
+/*
+ * Resolve the locale, using locale.alias.  If the index provides it, return
+ * the name of the LocaleCharsetRec matching the result in *record.
+ */
+char *
+resolveLocale(const char *locale, char **record)
+{
+    char *resolved = NULL;
+    int opened;
+    int found = 0;
+
+    TRACE(("resolveLocale(%s)\n", locale));
+
+    TRACE(("...looking in %s\n", locale_alias));
+    *record = NULL;
+    opened = lookupAlias(locale, &resolved, record);
 
-	fclose(f);
+    if (opened) {
+	if (resolved != NULL) {
+	    found = 1;
+	} else {
+	    TRACE(("...not found in %s\n", locale_alias));
+	    resolved = strmalloc(locale);
+	}
     }
 
     /*
@@ -247,11 +675,17 @@ resolveLocale(const char *locale)
 	    resolved = strmalloc(improved);
 	} else
 #endif
-	if (f == 0 && (fopen(locale_alias, "r") == 0)) {
+	if (!opened) {
 	    perror(locale_alias);
 	}
+	if (*record != NULL) {
+	    free(*record);
+	    *record = NULL;
+	}
     }
 
-    TRACE(("...resolveLocale ->%s\n", resolved));
+    TRACE(("...resolveLocale ->%s%s%s\n", resolved,
+	   *record ? " record " : "",
+	   *record ? *record : ""));
     return resolved;
 }
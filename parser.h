@@ -37,6 +37,6 @@ THE SOFTWARE.
 #define TOK_EQUALS 1
 #define TOK_KEYWORD 2
 
-char *resolveLocale(const char *locale);
+char *resolveLocale(const char *locale, char **record);
 
 #endif /* LUIT_PARSER_H */
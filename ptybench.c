@@ -0,0 +1,609 @@
+/*
+ * Copyright 2026 by the luit contributors
+ *
+ * All Rights Reserved
+ *
+ * Permission to use, copy, modify, and distribute this software and its
+ * documentation for any purpose and without fee is hereby granted,
+ * provided that the above copyright notice appear in all copies and that
+ * both that copyright notice and this permission notice appear in
+ * supporting documentation, and that the name of the above listed
+ * copyright holder(s) not be used in advertising or publicity pertaining
+ * to distribution of the software without specific, written prior
+ * permission.
+ *
+ * THE ABOVE LISTED COPYRIGHT HOLDER(S) DISCLAIM ALL WARRANTIES WITH REGARD
+ * TO THIS SOFTWARE, INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS, IN NO EVENT SHALL THE ABOVE LISTED COPYRIGHT HOLDER(S) BE
+ * LIABLE FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * luit-ptybench measures luit end-to-end, through its relay loop and two
+ * pseudo-terminals, and compares that with the same workload written
+ * directly to a pseudo-terminal.
+ *
+ * The driver plays the terminal:  it holds the master side of a pty, and runs
+ * either a synthetic child on the slave side, or luit running that child.
+ * The child is this program, run with "-child".  Its workloads are
+ *
+ *	cat	bulk output, 64kB per write
+ *	log	one write per line, as when tailing a log
+ *	redraw	full-screen updates with cursor addressing and line-drawing
+ *	echo	keystrokes echoed one at a time, to measure round-trip latency
+ *
+ * Results are written to the standard output as tab-separated lines, after a
+ * header line starting with "#".  For echo, "bytes" is the number of
+ * keystrokes, and the latency percentiles are in microseconds.  CPU time is
+ * that of the child processes, i.e., luit and the synthetic child, or the
+ * synthetic child alone.
+ */
+
+#include <config.h>
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <termios.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <sys/ioctl.h>
+#include <sys/resource.h>
+#include <time.h>
+
+#ifdef HAVE_SYS_TIME_H
+#include <sys/time.h>
+#endif
+
+#if !defined(HAVE_GRANTPT) && defined(HAVE_OPENPTY)
+#ifdef HAVE_PTY_H
+#include <pty.h>
+#endif
+#ifdef HAVE_UTIL_H
+#include <util.h>
+#endif
+#ifdef HAVE_LIBUTIL_H
+#include <libutil.h>
+#endif
+#endif
+
+#define PTYBENCH_FORMAT 1	/* change when the columns change */
+
+#define BLOCK_SIZE	65536	/* write size for "cat" */
+#define TIMEOUT_MS	10000	/* give up if nothing arrives for this long */
+#define QUIT_KEY	'\004'	/* ends the echo workload */
+#define QUIT_KEY_S	"\004"
+
+#define SizeOf(v)        (sizeof(v) / sizeof(v[0]))
+
+static const char *const workloads[] =
+{
+    "cat", "log", "redraw", "echo"
+};
+
+static char *program;
+static const char *luit_path = "./luit";
+static const char *encoding = "ISO8859-1";
+static const char *text_file = NULL;
+static long total_size = 8 * 1024 * 1024;
+static int keys = 2000;
+
+static void
+failed(const char *what)
+{
+    fprintf(stderr, "luit-ptybench: %s: %s\n", what, strerror(errno));
+    exit(EXIT_FAILURE);
+}
+
+/*
+ * Use the monotonic clock where there is one, so that adjusting the time of
+ * day does not disturb the measurements.
+ */
+static double
+getSeconds(void)
+{
+#if defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0)
+	return (double) ts.tv_sec + ((double) ts.tv_nsec / 1e9);
+#endif
+    {
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return (double) tv.tv_sec + ((double) tv.tv_usec / 1e6);
+    }
+}
+
+static void
+makeRaw(int fd)
+{
+    struct termios tio;
+
+    if (tcgetattr(fd, &tio) < 0)
+	failed("tcgetattr");
+    tio.c_lflag &= (unsigned) ~(ECHO | ICANON | ISIG | IEXTEN);
+    tio.c_iflag &= (unsigned) ~(ICRNL | IXOFF | IXON | ISTRIP | INLCR);
+    tio.c_oflag &= (unsigned) ~OPOST;
+    tio.c_cc[VMIN] = 1;
+    tio.c_cc[VTIME] = 0;
+    if (tcsetattr(fd, TCSANOW, &tio) < 0)
+	failed("tcsetattr");
+}
+
+static void
+writeAll(int fd, const char *data, size_t count)
+{
+    while (count != 0) {
+	ssize_t rc = write(fd, data, count);
+
+	if (rc < 0) {
+	    if (errno == EINTR)
+		continue;
+	    failed("write");
+	}
+	data += rc;
+	count -= (size_t) rc;
+    }
+}
+
+/******************************************************************************
+ * The synthetic child.
+ */
+
+static char *
+loadText(size_t *sizep)
+{
+    static const char *const words[] =
+    {
+	"the", "quick", "brown", "fox", "jumps", "over", "lazy", "dog",
+	"caf\351", "na\357ve", "\340", "gar\347on", "r\351sum\351", "\374ber"
+    };
+    char *result;
+    size_t size = 0;
+
+    if (text_file != NULL) {
+	FILE *fp = fopen(text_file, "rb");
+	long length;
+
+	if (fp == NULL
+	    || fseek(fp, 0L, SEEK_END) < 0
+	    || (length = ftell(fp)) <= 0
+	    || fseek(fp, 0L, SEEK_SET) < 0)
+	    failed(text_file);
+	size = (size_t) length;
+	if ((result = malloc(size)) == NULL
+	    || fread(result, (size_t) 1, size, fp) != size)
+	    failed(text_file);
+	fclose(fp);
+    } else {
+	unsigned long state = 1;
+	size_t limit = 64 * 1024;
+	size_t column = 0;
+
+	if ((result = malloc(limit + 80)) == NULL)
+	    failed("malloc");
+	while (size < limit) {
+	    const char *word;
+
+	    state = state * 1103515245UL + 12345UL;
+	    word = words[((state >> 16) & 0x7FFF) % SizeOf(words)];
+	    if (column + strlen(word) + 1 > 78) {
+		memcpy(result + size, "\r\n", (size_t) 2);
+		size += 2;
+		column = 0;
+	    } else if (column != 0) {
+		result[size++] = ' ';
+		++column;
+	    }
+	    memcpy(result + size, word, strlen(word));
+	    size += strlen(word);
+	    column += strlen(word);
+	}
+	memcpy(result + size, "\r\n", (size_t) 2);
+	size += 2;
+    }
+    *sizep = size;
+    return result;
+}
+
+/*
+ * Returns the length of the next line, including its newline.
+ */
+static size_t
+lineLength(const char *text, size_t size, size_t offset)
+{
+    const char *p = memchr(text + offset, '\n', size - offset);
+
+    return p ? (size_t) (p - (text + offset)) + 1 : size - offset;
+}
+
+static void
+runChild(const char *workload)
+{
+    size_t size;
+    char *text = loadText(&size);
+    long sent = 0;
+    size_t offset = 0;
+
+    if (!strcmp(workload, "cat")) {
+	while (sent < total_size) {
+	    size_t count = size - offset;
+
+	    if (count > BLOCK_SIZE)
+		count = BLOCK_SIZE;
+	    writeAll(1, text + offset, count);
+	    sent += (long) count;
+	    offset = (offset + count) % size;
+	}
+    } else if (!strcmp(workload, "log")) {
+	while (sent < total_size) {
+	    size_t count = lineLength(text, size, offset);
+
+	    writeAll(1, text + offset, count);
+	    sent += (long) count;
+	    offset = (offset + count) % size;
+	}
+    } else if (!strcmp(workload, "redraw")) {
+	char frame[24 * 100 + 200];
+
+	while (sent < total_size) {
+	    size_t used = 0;
+	    int row;
+
+	    used += (size_t) sprintf(frame + used, "\033[H\033(0l%.*sk\033(B",
+				     76, "qqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqq"
+				     "qqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqq");
+	    for (row = 2; row < 24; ++row) {
+		size_t count = lineLength(text, size, offset);
+
+		while (count != 0 && strchr("\r\n", text[offset + count - 1]))
+		    --count;
+		if (count > 72)
+		    count = 72;
+		used += (size_t) sprintf(frame + used,
+					 "\033[%d;1H\033(0x\033(B%.*s\033[K",
+					 row, (int) count, text + offset);
+		offset = (offset + lineLength(text, size, offset)) % size;
+	    }
+	    writeAll(1, frame, used);
+	    sent += (long) used;
+	}
+    } else if (!strcmp(workload, "echo")) {
+	char ch;
+
+	makeRaw(0);
+	writeAll(1, "ready\r\n", (size_t) 7);
+	while (read(0, &ch, (size_t) 1) == 1 && ch != QUIT_KEY)
+	    writeAll(1, &ch, (size_t) 1);
+    } else {
+	fprintf(stderr, "luit-ptybench: unknown workload %s\n", workload);
+	exit(EXIT_FAILURE);
+    }
+    free(text);
+    exit(EXIT_SUCCESS);
+}
+
+/******************************************************************************
+ * The driver.
+ */
+
+static int
+openMaster(char **slave_name)
+{
+    int pty;
+
+#if defined(HAVE_GRANTPT)
+    if ((pty = posix_openpt(O_RDWR | O_NOCTTY)) < 0
+	|| grantpt(pty) < 0
+	|| unlockpt(pty) < 0
+	|| (*slave_name = ptsname(pty)) == NULL)
+	failed("posix_openpt");
+#elif defined(HAVE_OPENPTY)
+    static char name[80];
+    int tty;
+
+    if (openpty(&pty, &tty, name, NULL, NULL) < 0)
+	failed("openpty");
+    close(tty);
+    *slave_name = name;
+#else
+#error no way to allocate a pseudo-terminal
+#endif
+    return pty;
+}
+
+static char *
+copyText(const char *text)
+{
+    char *result = malloc(strlen(text) + 1);
+
+    if (result == NULL)
+	failed("malloc");
+    return strcpy(result, text);
+}
+
+/*
+ * Start the child on the slave side of a new pty, directly or through luit.
+ */
+static pid_t
+startChild(int use_luit, const char *workload, int *master)
+{
+    struct winsize ws;
+    char *slave_name;
+    char size_arg[40];
+    pid_t pid;
+
+    *master = openMaster(&slave_name);
+    memset(&ws, 0, sizeof(ws));
+    ws.ws_row = 24;
+    ws.ws_col = 80;
+    (void) ioctl(*master, TIOCSWINSZ, &ws);
+
+    sprintf(size_arg, "%ld", total_size);
+    if ((pid = fork()) < 0)
+	failed("fork");
+    if (pid == 0) {
+	char *argv[16];
+	int argc = 0;
+	int tty;
+
+	setsid();
+	if ((tty = open(slave_name, O_RDWR)) < 0)
+	    failed(slave_name);
+#ifdef TIOCSCTTY
+	(void) ioctl(tty, TIOCSCTTY, 0);
+#endif
+	makeRaw(tty);
+	dup2(tty, 0);
+	dup2(tty, 1);
+	close(tty);
+	close(*master);
+
+	if (use_luit) {
+	    argv[argc++] = copyText(luit_path);
+	    argv[argc++] = copyText("-encoding");
+	    argv[argc++] = copyText(encoding);
+	    argv[argc++] = copyText("--");
+	}
+	argv[argc++] = program;
+	argv[argc++] = copyText("-child");
+	argv[argc++] = copyText(workload);
+	argv[argc++] = copyText("-size");
+	argv[argc++] = size_arg;
+	if (text_file != NULL) {
+	    argv[argc++] = copyText("-text");
+	    argv[argc++] = copyText(text_file);
+	}
+	argv[argc] = NULL;
+	execv(argv[0], argv);
+	failed(argv[0]);
+    }
+    return pid;
+}
+
+/*
+ * Read what is available, waiting up to the timeout.  Returns the number of
+ * bytes read, or -1 at the end of the session.
+ */
+static long
+readMaster(int master, char *buffer, size_t size)
+{
+    struct pollfd pfd;
+    ssize_t rc;
+
+    pfd.fd = master;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+    rc = poll(&pfd, (nfds_t) 1, TIMEOUT_MS);
+    if (rc == 0) {
+	fprintf(stderr, "luit-ptybench: timed out\n");
+	exit(EXIT_FAILURE);
+    } else if (rc < 0) {
+	return (errno == EINTR) ? 0 : -1;
+    }
+    rc = read(master, buffer, size);
+    if (rc < 0 && errno == EINTR)
+	rc = 0;
+    else if (rc <= 0)
+	rc = -1;		/* EIO once the slave side is closed */
+    return (long) rc;
+}
+
+static int
+compareDoubles(const void *a, const void *b)
+{
+    double x = *(const double *) a;
+    double y = *(const double *) b;
+
+    return (x > y) - (x < y);
+}
+
+static double
+cpuSeconds(void)
+{
+    struct rusage ru;
+
+    getrusage(RUSAGE_CHILDREN, &ru);
+    return ((double) ru.ru_utime.tv_sec + (double) ru.ru_utime.tv_usec / 1e6
+	    + (double) ru.ru_stime.tv_sec + (double) ru.ru_stime.tv_usec / 1e6);
+}
+
+static void
+runDriver(int use_luit, const char *workload)
+{
+    char buffer[BLOCK_SIZE];
+    const char *mode = use_luit ? "luit" : "direct";
+    double cpu = cpuSeconds();
+    double started = 0.0;
+    double elapsed;
+    long bytes = 0;
+    long got;
+    int master;
+    int status;
+    pid_t pid;
+
+    pid = startChild(use_luit, workload, &master);
+
+    if (!strcmp(workload, "echo")) {
+	double *times = calloc((size_t) keys, sizeof(double));
+	int have = 0;
+	int n;
+
+	if (times == NULL)
+	    failed("calloc");
+
+	/* wait for the child to set up its terminal */
+	while (have < 7 && (got = readMaster(master, buffer, sizeof(buffer))) >= 0) {
+	    long k;
+	    for (k = 0; k < got; ++k) {
+		if (have < 7 && buffer[k] == "ready\r\n"[have])
+		    ++have;
+		else
+		    have = 0;
+	    }
+	}
+
+	started = getSeconds();
+	for (n = 0; n < keys; ++n) {
+	    char key = (char) ('a' + (n % 26));
+	    double sent = getSeconds();
+	    int found = 0;
+
+	    writeAll(master, &key, (size_t) 1);
+	    while (!found) {
+		long k;
+
+		if ((got = readMaster(master, buffer, sizeof(buffer))) < 0) {
+		    fprintf(stderr, "luit-ptybench: child exited\n");
+		    exit(EXIT_FAILURE);
+		}
+		for (k = 0; k < got; ++k)
+		    found |= (buffer[k] == key);
+	    }
+	    times[n] = (getSeconds() - sent) * 1e6;
+	}
+	elapsed = getSeconds() - started;
+	writeAll(master, QUIT_KEY_S, (size_t) 1);
+	while (readMaster(master, buffer, sizeof(buffer)) >= 0) {
+	    ;
+	}
+	waitpid(pid, &status, 0);
+	cpu = cpuSeconds() - cpu;
+
+	qsort(times, (size_t) keys, sizeof(double), compareDoubles);
+	printf("%s\t%s\t%s\t%d\t%.6f\t-\t%.3f\t-\t%.1f\t%.1f\t%.1f\t%.1f\n",
+	       mode, workload, encoding, keys, elapsed, cpu,
+	       times[keys / 2],
+	       times[(keys * 9) / 10],
+	       times[(keys * 99) / 100],
+	       times[keys - 1]);
+	free(times);
+    } else {
+	while ((got = readMaster(master, buffer, sizeof(buffer))) >= 0) {
+	    if (got != 0 && bytes == 0)
+		started = getSeconds();
+	    bytes += got;
+	}
+	elapsed = getSeconds() - started;
+	waitpid(pid, &status, 0);
+	cpu = cpuSeconds() - cpu;
+
+	printf("%s\t%s\t%s\t%ld\t%.6f\t%.2f\t%.3f\t%.3f\t-\t-\t-\t-\n",
+	       mode, workload, encoding, bytes, elapsed,
+	       (double) bytes / elapsed / 1e6,
+	       cpu, cpu / ((double) bytes / 1e6));
+    }
+    fflush(stdout);
+    close(master);
+}
+
+static void
+usage(void)
+{
+    static const char *const msg[] =
+    {
+	"Usage: luit-ptybench [options] [workload...]",
+	"",
+	"Run each workload (cat, log, redraw, echo) on a pty, directly and",
+	"through luit, and report throughput, CPU time and echo latency.",
+	"",
+	"Options:",
+	"  -encoding name  encoding passed to luit (ISO8859-1)",
+	"  -keys count     keystrokes for the echo workload (2000)",
+	"  -luit path      luit program to measure (./luit)",
+	"  -size bytes     output size for the other workloads (8388608)",
+	"  -text file      text to write, in the encoding (default: synthetic)",
+    };
+    unsigned n;
+
+    for (n = 0; n < SizeOf(msg); ++n)
+	fprintf(stderr, "%s\n", msg[n]);
+    exit(EXIT_FAILURE);
+}
+
+int
+main(int argc, char **argv)
+{
+    const char *child = NULL;
+    int n;
+
+    program = argv[0];
+    for (n = 1; n < argc && *argv[n] == '-'; n += 2) {
+	if (n + 1 >= argc)
+	    usage();
+	if (!strcmp(argv[n], "-child"))
+	    child = argv[n + 1];
+	else if (!strcmp(argv[n], "-encoding"))
+	    encoding = argv[n + 1];
+	else if (!strcmp(argv[n], "-keys"))
+	    keys = atoi(argv[n + 1]);
+	else if (!strcmp(argv[n], "-luit"))
+	    luit_path = argv[n + 1];
+	else if (!strcmp(argv[n], "-size"))
+	    total_size = atol(argv[n + 1]);
+	else if (!strcmp(argv[n], "-text"))
+	    text_file = argv[n + 1];
+	else
+	    usage();
+    }
+    if (keys <= 0 || total_size <= 0)
+	usage();
+
+    if (child != NULL)
+	runChild(child);
+
+    if (strchr(program, '/') == NULL) {
+	fprintf(stderr, "luit-ptybench: run this with a pathname, e.g., ./%s\n",
+		program);
+	exit(EXIT_FAILURE);
+    }
+    signal(SIGPIPE, SIG_IGN);
+
+    printf("# luit-ptybench %d\tmode\tworkload\tencoding\tbytes"
+	   "\tseconds\tMB/s\tcpu-s\tcpu-s/MB\tp50-us\tp90-us\tp99-us\tmax-us\n",
+	   PTYBENCH_FORMAT);
+    if (n < argc) {
+	for (; n < argc; ++n) {
+	    runDriver(0, argv[n]);
+	    runDriver(1, argv[n]);
+	}
+    } else {
+	unsigned k;
+
+	for (k = 0; k < SizeOf(workloads); ++k) {
+	    runDriver(0, workloads[k]);
+	    runDriver(1, workloads[k]);
+	}
+    }
+    return EXIT_SUCCESS;
+}
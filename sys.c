@@ -30,6 +30,7 @@ THE SOFTWARE.
 #include <sys/ioctl.h>
 #include <sys/stat.h>
 #include <sys/time.h>
+#include <time.h>
 #include <termios.h>
 #include <signal.h>
 #include <errno.h>
@@ -137,6 +138,124 @@ waitForOutput(int fd)
     return ret;
 }
 
+/*
+ * Returns microseconds from a monotonic clock if there is one, for measuring
+ * intervals.  Differences are correct across a wraparound.
+ */
+unsigned long
+monotonicUsecs(void)
+{
+#if defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0)
+	return ((unsigned long) ts.tv_sec * 1000000UL
+		+ (unsigned long) (ts.tv_nsec / 1000));
+#endif
+    {
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return ((unsigned long) tv.tv_sec * 1000000UL
+		+ (unsigned long) tv.tv_usec);
+    }
+}
+
+/*
+ * The startup profile records each phase begun with profileBegin(), e.g., a
+ * table lookup, with its nesting and time, until the matching profileEnd().
+ * The few calls made at startup cost little, so the phases are recorded
+ * whether or not -profile-startup asks for the report.
+ */
+#define PROFILE_MAX	200
+#define PROFILE_NEST	16
+
+typedef struct {
+    const char *phase;
+    char name[40];		/* e.g., the encoding name, truncated */
+    const char *result;		/* e.g., which lookup succeeded */
+    unsigned depth;
+    unsigned long start;	/* microseconds since the first phase */
+    unsigned long usecs;
+} ProfileRec;
+
+static ProfileRec profile_recs[PROFILE_MAX];
+static unsigned profile_count;
+static unsigned profile_stack[PROFILE_NEST];
+static unsigned profile_depth;
+static unsigned long profile_base;
+
+void
+profileBegin(const char *phase, const char *name)
+{
+    unsigned long now = monotonicUsecs();
+
+    if (profile_count == 0)
+	profile_base = now;
+    if (profile_depth < PROFILE_NEST) {
+	if (profile_count < PROFILE_MAX) {
+	    ProfileRec *p = &profile_recs[profile_count];
+
+	    p->phase = phase;
+	    if (name != NULL) {
+		strncpy(p->name, name, sizeof(p->name) - 1);
+		p->name[sizeof(p->name) - 1] = '\0';
+	    }
+	    p->depth = profile_depth;
+	    p->start = now - profile_base;
+	}
+	profile_stack[profile_depth] = profile_count++;
+    }
+    profile_depth++;
+}
+
+void
+profileEnd(const char *result)
+{
+    if (profile_depth == 0)
+	return;
+    if (--profile_depth < PROFILE_NEST) {
+	unsigned n = profile_stack[profile_depth];
+
+	if (n < PROFILE_MAX) {
+	    ProfileRec *p = &profile_recs[n];
+
+	    p->result = result;
+	    p->usecs = monotonicUsecs() - profile_base - p->start;
+	}
+    }
+}
+
+void
+reportProfile(FILE *fp)
+{
+    unsigned n;
+    unsigned long lookups = 0;
+    unsigned count = 0;
+
+    fprintf(fp, "# luit startup profile, in microseconds\n");
+    fprintf(fp, "#   start  elapsed  phase\n");
+    for (n = 0; n < profile_count && n < PROFILE_MAX; ++n) {
+	ProfileRec *p = &profile_recs[n];
+
+	fprintf(fp, "%9lu %8lu  %*s%s", p->start, p->usecs,
+		(int) (2 * p->depth), "", p->phase);
+	if (p->name[0] != '\0')
+	    fprintf(fp, " %s", p->name);
+	if (p->result != NULL)
+	    fprintf(fp, " -> %s", p->result);
+	fputc('\n', fp);
+	if (!strcmp(p->phase, "luitLookupMapping")) {
+	    lookups += p->usecs;
+	    ++count;
+	}
+    }
+    if (profile_count > PROFILE_MAX)
+	fprintf(fp, "# %u more phases not shown\n", profile_count - PROFILE_MAX);
+    if (count != 0)
+	fprintf(fp, "# %u mapping lookups took %lu microseconds\n", count, lookups);
+}
+
 int
 waitForInput(int fd1, int fd2)
 {
@@ -624,6 +743,50 @@ strmalloc(const char *value)
     return result;
 }
 
+/*
+ * Files shared through the -cache directory are mapped and used without
+ * rebuilding them, so they must belong to the user (or root), and no one else
+ * may be able to write them.
+ */
+static int
+trustedStat(const struct stat *sb)
+{
+    return ((sb->st_uid == getuid() || sb->st_uid == 0)
+	    && !(sb->st_mode & (S_IWGRP | S_IWOTH)));
+}
+
+int
+isTrustedFile(int fd)
+{
+    struct stat sb;
+
+    return (fstat(fd, &sb) == 0
+	    && S_ISREG(sb.st_mode)
+	    && trustedStat(&sb));
+}
+
+/*
+ * Check the -cache directory the same way, once.
+ */
+int
+isTrustedCache(void)
+{
+    static int result = -1;
+
+    if (result < 0) {
+	struct stat sb;
+
+	result = (table_cache != 0
+		  && stat(table_cache, &sb) == 0
+		  && S_ISDIR(sb.st_mode)
+		  && trustedStat(&sb));
+	if (table_cache != 0 && !result)
+	    Warning("ignoring cache directory %s, which others can change\n",
+		    table_cache);
+    }
+    return result;
+}
+
 #ifdef NO_LEAKS
 void
 ExitProgram(int code)
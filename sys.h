@@ -44,6 +44,10 @@ extern int ignore_unused;
 #define SizeOf(v)        (sizeof(v) / sizeof(v[0]))
 
 int waitForOutput(int fd);
+unsigned long monotonicUsecs(void);
+void profileBegin(const char *phase, const char *name);
+void profileEnd(const char *result);
+void reportProfile(FILE *fp);
 int waitForInput(int fd1, int fd2);
 int setWindowSize(int sfd, int dfd);
 int installHandler(int signum, void (*handler) (int));
@@ -55,6 +59,8 @@ int allocatePty(int *pty_return, char **line_return);
 int openTty(char *line);
 int droppriv(void);
 char *strmalloc(const char *value);
+int isTrustedFile(int fd);
+int isTrustedCache(void);
 
 #ifdef HAVE_STRCASECMP
 #define StrCaseCmp(a,b) strcasecmp(a,b)
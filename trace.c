@@ -25,7 +25,14 @@
 #include <config.h>
 
 #include <unistd.h>
+#include <fcntl.h>
 #include <trace.h>
+#include <sys.h>
+
+#if defined(HAVE_MMAP) && defined(HAVE_SYS_MMAN_H)
+#include <sys/mman.h>
+#define USE_MMAP 1
+#endif
 
 void
 Trace(const char *fmt,...)
@@ -44,3 +51,73 @@ Trace(const char *fmt,...)
     fflush(fp);
     va_end(ap);
 }
+
+/*
+ * Open the ring on the first event.  Without mmap, it is kept in memory and
+ * written at exit.
+ */
+static TraceHeader *trace_ring;
+static int trace_failed;
+
+#define TRACE_BYTES (sizeof(TraceHeader) + TRACE_RING * sizeof(TraceRecord))
+#define TRACE_RECORDS(ring) ((TraceRecord *) ((ring) + 1))
+
+#ifndef USE_MMAP
+static void
+saveTraceRing(void)
+{
+    FILE *fp;
+
+    if (trace_ring != 0 && (fp = fopen("Trace.ring", "wb")) != 0) {
+	fwrite(trace_ring, TRACE_BYTES, (size_t) 1, fp);
+	fclose(fp);
+    }
+}
+#endif
+
+static int
+openTraceRing(void)
+{
+#ifdef USE_MMAP
+    int fd;
+    void *addr;
+
+    if ((fd = open("Trace.ring", O_RDWR | O_CREAT | O_TRUNC, 0644)) < 0)
+	return 0;
+    if (ftruncate(fd, (off_t) TRACE_BYTES) < 0
+	|| (addr = mmap(NULL, TRACE_BYTES, PROT_READ | PROT_WRITE,
+			MAP_SHARED, fd, (off_t) 0)) == MAP_FAILED) {
+	close(fd);
+	return 0;
+    }
+    close(fd);
+    trace_ring = addr;
+#else
+    if ((trace_ring = calloc((size_t) 1, TRACE_BYTES)) == 0)
+	return 0;
+    atexit(saveTraceRing);
+#endif
+    memcpy(trace_ring->magic, TRACE_MAGIC, sizeof(trace_ring->magic));
+    trace_ring->size = TRACE_RING;
+    trace_ring->next = 0;
+    return 1;
+}
+
+void
+TraceEvent(TraceEventId id, long a, long b, long c)
+{
+    TraceRecord *rp;
+
+    if (trace_ring == 0) {
+	if (trace_failed || !openTraceRing()) {
+	    trace_failed = 1;
+	    return;
+	}
+    }
+    rp = TRACE_RECORDS(trace_ring) + (trace_ring->next++ % TRACE_RING);
+    rp->when = monotonicUsecs();
+    rp->id = (unsigned long) id;
+    rp->arg[0] = a;
+    rp->arg[1] = b;
+    rp->arg[2] = c;
+}
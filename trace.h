@@ -27,20 +27,80 @@
 
 #include <luit.h>
 
+/*
+ * Events for the binary trace ring, used in place of Trace() where it would
+ * be called for each character.  Each records up to three integer arguments,
+ * which luit-tracedump formats later using the format given here.
+ */
+#define TRACE_EVENTS \
+	EVENT(evRecode,  "FontencCharsetRecode %#lx ->%#lx") \
+	EVENT(evReverse, "FontencCharsetReverse %#lx ->%#lx") \
+	EVENT(evMapCode, "luitMapCodeValue 0x%04lX 0x%04lX")
+
+#define EVENT(id, format) id,
+typedef enum {
+    evNone = 0,
+    TRACE_EVENTS
+    evLast
+} TraceEventId;
+#undef EVENT
+
+/*
+ * The ring is a file, "Trace.ring", mapped into memory if possible, so that
+ * the records survive a crash.  It holds the most recent TRACE_RING records,
+ * the oldest at index "next" modulo "size".
+ */
+#define TRACE_MAGIC	"luittrc1"
+#define TRACE_RING	65536
+
+typedef struct {
+    unsigned long when;		/* monotonicUsecs() */
+    unsigned long id;
+    long arg[3];
+} TraceRecord;
+
+typedef struct {
+    char magic[8];
+    unsigned long size;		/* records in the ring */
+    unsigned long next;		/* count of records written */
+} TraceHeader;
+
 void Trace(const char *fmt,...) GCC_PRINTFLIKE(1,2);
+void TraceEvent(TraceEventId id, long a, long b, long c);
 
 #ifdef OPT_TRACE
 #define TRACE(params) Trace params
+#define TRACE_EVENT(id,a,b,c) TraceEvent(id, (long) (a), (long) (b), (long) (c))
 #if OPT_TRACE > 1
 #define TRACE2(params) Trace params
+#define TRACE2_EVENT(id,a,b,c) TRACE_EVENT(id, a, b, c)
 #else
 #define TRACE2(params)		/* nothing */
+#define TRACE2_EVENT(id,a,b,c)	/* nothing */
 #endif
 #else
 #define TRACE(params)		/* nothing */
 #define TRACE2(params)		/* nothing */
+#define TRACE_EVENT(id,a,b,c)	/* nothing */
+#define TRACE2_EVENT(id,a,b,c)	/* nothing */
 #endif
 
 #define TRACE_ERR(msg) TRACE((msg ": %s\n", strerror(errno)))
 
+/*
+ * Static probes (USDT), for tracing a production build with bpftrace or
+ * SystemTap, e.g.,
+ *	bpftrace -e 'usdt:/usr/bin/luit:luit:flush { @bytes = hist(arg1); }'
+ * Each is a no-op instruction until a tracer attaches to it.  Without
+ * <sys/sdt.h>, the arguments are discarded, and the compiler removes them.
+ */
+#ifdef HAVE_SYS_SDT_H
+#include <sys/sdt.h>
+#define PROBE2(name,a,b)	DTRACE_PROBE2(luit, name, a, b)
+#define PROBE3(name,a,b,c)	DTRACE_PROBE3(luit, name, a, b, c)
+#else
+#define PROBE2(name,a,b)	do { (void) (a); (void) (b); } while (0)
+#define PROBE3(name,a,b,c)	do { (void) (a); (void) (b); (void) (c); } while (0)
+#endif
+
 #endif /* TRACE_H */
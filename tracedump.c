@@ -0,0 +1,103 @@
+/*
+ * Copyright 2026 by the luit contributors
+ *
+ * All Rights Reserved
+ *
+ * Permission to use, copy, modify, and distribute this software and its
+ * documentation for any purpose and without fee is hereby granted,
+ * provided that the above copyright notice appear in all copies and that
+ * both that copyright notice and this permission notice appear in
+ * supporting documentation, and that the name of the above listed
+ * copyright holder(s) not be used in advertising or publicity pertaining
+ * to distribution of the software without specific, written prior
+ * permission.
+ *
+ * THE ABOVE LISTED COPYRIGHT HOLDER(S) DISCLAIM ALL WARRANTIES WITH REGARD
+ * TO THIS SOFTWARE, INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS, IN NO EVENT SHALL THE ABOVE LISTED COPYRIGHT HOLDER(S) BE
+ * LIABLE FOR ANY SPECIAL, INDIRECT OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * luit-tracedump formats the binary trace ring, "Trace.ring", which a luit
+ * built with --enable-trace writes for the events listed in trace.h.  Each
+ * record is shown oldest first, as microseconds since the first record and
+ * the difference from the previous one, followed by the event's message.
+ *
+ *	luit-tracedump [Trace.ring]
+ */
+
+#include <trace.h>
+#include <sys.h>
+
+#define EVENT(id, format) { #id, format },
+static const struct {
+    const char *name;
+    const char *format;
+} events[] = {
+    { "evNone", "?" },
+    TRACE_EVENTS
+};
+#undef EVENT
+
+int
+main(int argc, char *argv[])
+{
+    const char *name = (argc > 1) ? argv[1] : "Trace.ring";
+    FILE *fp;
+    TraceHeader header;
+    TraceRecord record;
+    unsigned long first;
+    unsigned long n;
+    unsigned long start = 0;
+    unsigned long last = 0;
+
+    if ((fp = fopen(name, "rb")) == NULL) {
+	perror(name);
+	return EXIT_FAILURE;
+    }
+    if (fread(&header, sizeof(header), (size_t) 1, fp) != 1
+	|| memcmp(header.magic, TRACE_MAGIC, sizeof(header.magic))
+	|| header.size == 0) {
+	fprintf(stderr, "%s: not a trace ring\n", name);
+	return EXIT_FAILURE;
+    }
+
+    first = (header.next > header.size) ? (header.next - header.size) : 0;
+    if (first != 0)
+	printf("# %lu records overwritten\n", first);
+    for (n = first; n < header.next; ++n) {
+	long offset = (long) (sizeof(header)
+			      + (n % header.size) * sizeof(record));
+
+	if (fseek(fp, offset, SEEK_SET) != 0
+	    || fread(&record, sizeof(record), (size_t) 1, fp) != 1) {
+	    fprintf(stderr, "%s: truncated\n", name);
+	    return EXIT_FAILURE;
+	}
+	if (n == first)
+	    start = last = record.when;
+	printf("%10lu %+8ld ",
+	       record.when - start,
+	       (long) (record.when - last));
+	last = record.when;
+	if (record.id < SizeOf(events)) {
+	    printf(events[record.id].format,
+		   record.arg[0],
+		   record.arg[1],
+		   record.arg[2]);
+	} else {
+	    printf("event %lu %ld %ld %ld",
+		   record.id,
+		   record.arg[0],
+		   record.arg[1],
+		   record.arg[2]);
+	}
+	putchar('\n');
+    }
+    fclose(fp);
+    return EXIT_SUCCESS;
+}